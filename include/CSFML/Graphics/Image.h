@@ -165,8 +165,9 @@ CSFML_GRAPHICS_API bool sfImage_saveToFile(const sfImage* image, const char* fil
 ///
 /// The format of the image must be specified.
 /// The supported image formats are bmp, png, tga and jpg.
-/// This function fails if the image is empty, or if
-/// the format was invalid.
+/// This function fails if the image is empty, if the
+/// format was invalid, or if the buffer couldn't allocate
+/// enough memory.
 ///
 /// \param image  Image object
 /// \param output Buffer to fill with encoded data
@@ -55,3 +55,40 @@ typedef struct
 ///
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API const sfRenderStates sfRenderStates_default;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a pre-converted copy of render states
+///
+/// Every draw function taking a `const sfRenderStates*` has to
+/// convert it to SFML's internal representation. When the same
+/// states are used for many draw calls, this conversion can be
+/// done once by creating a handle and passing it to the
+/// `*WithHandle` draw functions instead.
+///
+/// The handle keeps pointers to the texture and shader of
+/// the states, they must stay alive as long as the handle
+/// is used for drawing.
+///
+/// \param states Render states to convert (NULL to use the default states)
+///
+/// \return A new sfRenderStatesHandle object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderStatesHandle* sfRenderStatesHandle_create(const sfRenderStates* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing render states handle
+///
+/// \param handle Render states handle to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderStatesHandle_destroy(const sfRenderStatesHandle* handle);
+
+////////////////////////////////////////////////////////////
+/// \brief Replace the render states stored in a handle
+///
+/// \param handle Render states handle object
+/// \param states New render states (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderStatesHandle_update(sfRenderStatesHandle* handle, const sfRenderStates* states);
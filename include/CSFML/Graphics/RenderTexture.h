@@ -280,6 +280,27 @@ CSFML_GRAPHICS_API void sfRenderTexture_drawVertexBuffer(sfRenderTexture*      r
                                                          const sfVertexBuffer* object,
                                                          const sfRenderStates* states);
 
+////////////////////////////////////////////////////////////
+/// \brief Draw a list of sprites to the render-target
+///
+/// Consecutive sprites sharing the same texture are merged
+/// into a single draw call: their vertices are transformed on
+/// the CPU and submitted as one triangle list. Since all the
+/// sprites share the same render states, a new draw call is
+/// only issued when the texture changes, so sorting the sprites
+/// by texture gives the best results. NULL entries are skipped.
+///
+/// \param renderTexture Render texture object
+/// \param sprites       Array of pointers to the sprites to draw
+/// \param spriteCount   Number of sprites in the array
+/// \param states        Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_drawSprites(sfRenderTexture*       renderTexture,
+                                                    const sfSprite* const* sprites,
+                                                    size_t                 spriteCount,
+                                                    const sfRenderStates*  states);
+
 ////////////////////////////////////////////////////////////
 /// \brief Draw primitives defined by a vertex buffer.
 ///
@@ -297,6 +318,38 @@ CSFML_GRAPHICS_API void sfRenderTexture_drawVertexBufferRange(
     size_t                vertexCount,
     const sfRenderStates* states);
 
+////////////////////////////////////////////////////////////
+/// \brief Draw a vertex buffer several times with different transforms
+///
+/// The vertex buffer is drawn once for each element of
+/// \a transforms, combined with the transform of \a states.
+/// If \a colors is not NULL, the colors of the vertices are
+/// also modulated by the color of each instance.
+///
+/// SFML doesn't support hardware instancing. When the vertex
+/// buffer keeps a copy of its vertices (see
+/// sfVertexBuffer_setLocalCopyEnabled), small buffers of
+/// points, lines or triangles, and all the buffers drawn with
+/// per-instance colors, are expanded on the CPU into a single
+/// draw call. Other buffers are drawn with one draw call per
+/// instance, without converting the render states again;
+/// \a colors is ignored for buffers without a copy.
+///
+/// \param renderTexture Render texture object
+/// \param object        Vertex buffer object to draw
+/// \param transforms    Array of instance transforms
+/// \param colors        Array of instance colors (NULL to keep the vertex colors)
+/// \param instanceCount Number of instances to draw
+/// \param states        Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_drawVertexBufferInstanced(sfRenderTexture*      renderTexture,
+                                                                  const sfVertexBuffer* object,
+                                                                  const sfTransform*    transforms,
+                                                                  const sfColor*        colors,
+                                                                  size_t                instanceCount,
+                                                                  const sfRenderStates* states);
+
 ////////////////////////////////////////////////////////////
 /// \brief Draw primitives defined by an array of vertices to a render texture
 ///
@@ -314,6 +367,91 @@ CSFML_GRAPHICS_API void sfRenderTexture_drawPrimitives(
     sfPrimitiveType       type,
     const sfRenderStates* states);
 
+////////////////////////////////////////////////////////////
+/// \brief Draw a drawable object to the render-target using pre-converted render states
+///
+/// These functions behave like their counterparts taking a
+/// `const sfRenderStates*`, but skip the conversion of the
+/// render states, see sfRenderStatesHandle_create.
+///
+/// \param renderTexture Render texture object
+/// \param object        Object to draw
+/// \param states        Render states handle to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_drawSpriteWithHandle(sfRenderTexture*            renderTexture,
+                                                             const sfSprite*             object,
+                                                             const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawTextWithHandle(sfRenderTexture*            renderTexture,
+                                                           const sfText*               object,
+                                                           const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawShapeWithHandle(sfRenderTexture*            renderTexture,
+                                                            const sfShape*              object,
+                                                            const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawCircleShapeWithHandle(sfRenderTexture*            renderTexture,
+                                                                  const sfCircleShape*        object,
+                                                                  const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawConvexShapeWithHandle(sfRenderTexture*            renderTexture,
+                                                                  const sfConvexShape*        object,
+                                                                  const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawRectangleShapeWithHandle(sfRenderTexture*            renderTexture,
+                                                                     const sfRectangleShape*     object,
+                                                                     const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawVertexArrayWithHandle(sfRenderTexture*            renderTexture,
+                                                                  const sfVertexArray*        object,
+                                                                  const sfRenderStatesHandle* states);
+CSFML_GRAPHICS_API void sfRenderTexture_drawVertexBufferWithHandle(sfRenderTexture*            renderTexture,
+                                                                   const sfVertexBuffer*       object,
+                                                                   const sfRenderStatesHandle* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw primitives defined by a vertex buffer using pre-converted render states
+///
+/// \param renderTexture Render texture object
+/// \param object        Vertex buffer object to draw
+/// \param firstVertex   Index of the first vertex to render
+/// \param vertexCount   Number of vertices to render
+/// \param states        Render states handle to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_drawVertexBufferRangeWithHandle(sfRenderTexture*            renderTexture,
+                                                                        const sfVertexBuffer*       object,
+                                                                        size_t                      firstVertex,
+                                                                        size_t                      vertexCount,
+                                                                        const sfRenderStatesHandle* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw primitives defined by an array of vertices using pre-converted render states
+///
+/// \param renderTexture Render texture object
+/// \param vertices      Pointer to the vertices
+/// \param vertexCount   Number of vertices in the array
+/// \param type          Type of primitives to draw
+/// \param states        Render states handle to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_drawPrimitivesWithHandle(sfRenderTexture*            renderTexture,
+                                                                 const sfVertex*             vertices,
+                                                                 size_t                      vertexCount,
+                                                                 sfPrimitiveType             type,
+                                                                 const sfRenderStatesHandle* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a list of sprites using pre-converted render states
+///
+/// See sfRenderTexture_drawSprites.
+///
+/// \param renderTexture Render texture object
+/// \param sprites       Array of pointers to the sprites to draw
+/// \param spriteCount   Number of sprites in the array
+/// \param states        Render states handle to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_drawSpritesWithHandle(sfRenderTexture*            renderTexture,
+                                                              const sfSprite* const*      sprites,
+                                                              size_t                      spriteCount,
+                                                              const sfRenderStatesHandle* states);
+
 ////////////////////////////////////////////////////////////
 /// \brief Save the current OpenGL render states and matrices
 ///
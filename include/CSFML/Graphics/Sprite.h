@@ -36,6 +36,8 @@
 #include <CSFML/Graphics/Types.h>
 #include <CSFML/System/Vector2.h>
 
+#include <stddef.h>
+
 
 ////////////////////////////////////////////////////////////
 /// \brief Create a new sprite
@@ -218,6 +220,21 @@ CSFML_GRAPHICS_API sfTransform sfSprite_getTransform(const sfSprite* sprite);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfTransform sfSprite_getInverseTransform(const sfSprite* sprite);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the combined transforms of several sprites
+///
+/// This is equivalent to calling sfSprite_getTransform on
+/// each sprite, with a single call.
+///
+/// \param sprites     Array of pointers to the sprites
+/// \param spriteCount Number of sprites in the array
+/// \param transforms  Array receiving the transform of each sprite
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfSprite_getTransforms(const sfSprite* const* sprites,
+                                               size_t                 spriteCount,
+                                               sfTransform*           transforms);
+
 ////////////////////////////////////////////////////////////
 /// \brief Change the source texture of a sprite
 ///
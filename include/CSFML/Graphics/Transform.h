@@ -31,8 +31,11 @@
 
 #include <CSFML/Graphics/Rect.h>
 #include <CSFML/Graphics/Types.h>
+#include <CSFML/Graphics/Vertex.h>
 #include <CSFML/System/Vector2.h>
 
+#include <stddef.h>
+
 
 ////////////////////////////////////////////////////////////
 /// \brief Encapsulate a 3x3 transform matrix
@@ -112,6 +115,39 @@ CSFML_GRAPHICS_API sfTransform sfTransform_getInverse(const sfTransform* transfo
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfVector2f sfTransform_transformPoint(const sfTransform* transform, sfVector2f point);
 
+////////////////////////////////////////////////////////////
+/// \brief Apply a transform to an array of 2D points
+///
+/// This gives the same results as calling sfTransform_transformPoint
+/// on each point, but is much faster for large arrays.
+/// \a points and \a transformedPoints may point to the same array.
+///
+/// \param transform         Transform object
+/// \param points            Points to transform
+/// \param transformedPoints Array receiving the transformed points
+/// \param count             Number of points
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransform_transformPoints(const sfTransform* transform,
+                                                   const sfVector2f*  points,
+                                                   sfVector2f*        transformedPoints,
+                                                   size_t             count);
+
+////////////////////////////////////////////////////////////
+/// \brief Apply a transform to the positions of an array of vertices
+///
+/// The positions are transformed in place, colors and texture
+/// coordinates are left untouched.
+///
+/// \param transform   Transform object
+/// \param vertices    Vertices to transform
+/// \param vertexCount Number of vertices
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransform_transformVertices(const sfTransform* transform,
+                                                     sfVertex*          vertices,
+                                                     size_t             vertexCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Apply a transform to a rectangle
 ///
@@ -142,6 +178,26 @@ CSFML_GRAPHICS_API sfFloatRect sfTransform_transformRect(const sfTransform* tran
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfTransform_combine(sfTransform* transform, const sfTransform* other);
 
+////////////////////////////////////////////////////////////
+/// \brief Combine a transform with each transform of an array
+///
+/// results[i] receives \a transform combined with others[i],
+/// as computed by sfTransform_combine. This is typically used
+/// to compute the global transforms of all the children of
+/// a node in a scene graph in a single call.
+/// \a results may point to the same array as \a others.
+///
+/// \param transform Transform to combine the others to
+/// \param others    Transforms to combine to \a transform
+/// \param results   Array receiving the combined transforms
+/// \param count     Number of transforms in \a others and \a results
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransform_combineMany(const sfTransform* transform,
+                                               const sfTransform* others,
+                                               sfTransform*       results,
+                                               size_t             count);
+
 ////////////////////////////////////////////////////////////
 /// \brief Combine a transform with a translation
 ///
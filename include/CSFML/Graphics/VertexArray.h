@@ -88,6 +88,21 @@ CSFML_GRAPHICS_API size_t sfVertexArray_getVertexCount(const sfVertexArray* vert
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfVertex* sfVertexArray_getVertex(sfVertexArray* vertexArray, size_t index);
 
+////////////////////////////////////////////////////////////
+/// \brief Get access to the whole array of vertices
+///
+/// The vertices are stored contiguously, the returned pointer
+/// can be used to read or write all of them at once. It is
+/// invalidated by any function that changes the vertex count
+/// of the array.
+///
+/// \param vertexArray Vertex array object
+///
+/// \return Pointer to the first vertex, or NULL if the array is empty
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfVertex* sfVertexArray_getVertices(sfVertexArray* vertexArray);
+
 ////////////////////////////////////////////////////////////
 /// \brief Clear a vertex array
 ///
@@ -125,6 +140,35 @@ CSFML_GRAPHICS_API void sfVertexArray_resize(sfVertexArray* vertexArray, size_t
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfVertexArray_append(sfVertexArray* vertexArray, sfVertex vertex);
 
+////////////////////////////////////////////////////////////
+/// \brief Add several vertices to a vertex array
+///
+/// The array is grown once and the vertices are copied
+/// in a single pass. \a vertices may point into the array
+/// itself, for example to repeat its contents.
+///
+/// \param vertexArray Vertex array object
+/// \param vertices    Pointer to the vertices to add
+/// \param vertexCount Number of vertices to add
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_appendRange(sfVertexArray*  vertexArray,
+                                                  const sfVertex* vertices,
+                                                  size_t          vertexCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Preallocate memory for a vertex array
+///
+/// After this call, the array can grow up to \a vertexCount
+/// vertices without reallocating its memory. The vertex count
+/// of the array is not changed.
+///
+/// \param vertexArray Vertex array object
+/// \param vertexCount Number of vertices to allocate memory for
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_reserve(sfVertexArray* vertexArray, size_t vertexCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the type of primitives of a vertex array
 ///
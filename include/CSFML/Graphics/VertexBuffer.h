@@ -220,6 +220,37 @@ CSFML_GRAPHICS_API void sfVertexBuffer_setUsage(sfVertexBuffer* vertexBuffer, sf
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfVertexBufferUsage sfVertexBuffer_getUsage(const sfVertexBuffer* vertexBuffer);
 
+////////////////////////////////////////////////////////////
+/// \brief Enable or disable the copy of the vertices kept in system memory
+///
+/// The instanced draw functions of the render targets need
+/// the vertices in system memory to expand small buffers and
+/// to apply per-instance colors. The copy is disabled by
+/// default, so that vertex buffers only use graphics memory.
+///
+/// The copy only follows the updates made while it is
+/// enabled: enable it right after creating the buffer.
+/// Updating the buffer from another vertex buffer which
+/// doesn't keep a copy disables it.
+///
+/// \param vertexBuffer Vertex buffer object
+/// \param enabled      true to keep a copy of the vertices, false to release it
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexBuffer_setLocalCopyEnabled(sfVertexBuffer* vertexBuffer, bool enabled);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether a copy of the vertices is kept in system memory
+///
+/// \param vertexBuffer Vertex buffer object
+///
+/// \return true if the copy is enabled
+///
+/// \see sfVertexBuffer_setLocalCopyEnabled
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API bool sfVertexBuffer_isLocalCopyEnabled(const sfVertexBuffer* vertexBuffer);
+
 ////////////////////////////////////////////////////////////
 /// \brief Bind a vertex buffer for rendering
 ///
@@ -28,13 +28,19 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include <CSFML/Network/AsyncIo.h>
 #include <CSFML/Network/Ftp.h>
 #include <CSFML/Network/Http.h>
+#include <CSFML/Network/HttpClient.h>
 #include <CSFML/Network/IpAddress.h>
 #include <CSFML/Network/Packet.h>
+#include <CSFML/Network/PacketPool.h>
+#include <CSFML/Network/ReliableUdp.h>
+#include <CSFML/Network/SocketPoller.h>
 #include <CSFML/Network/SocketSelector.h>
 #include <CSFML/Network/SocketStatus.h>
 #include <CSFML/Network/TcpListener.h>
 #include <CSFML/Network/TcpSocket.h>
+#include <CSFML/Network/UdpFragmenter.h>
 #include <CSFML/Network/UdpSocket.h>
 #include <CSFML/System.h>
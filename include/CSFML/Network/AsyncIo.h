@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Export.h>
+
+#include <CSFML/Network/SocketStatus.h>
+#include <CSFML/Network/Types.h>
+#include <CSFML/System/Time.h>
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Kinds of operation handled by sfAsyncIo
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfAsyncIoSend,    ///< Send all the data to a TCP socket
+    sfAsyncIoReceive, ///< Receive some data from a TCP socket
+    sfAsyncIoAccept   ///< Accept a new connection on a TCP listener
+} sfAsyncIoOperation;
+
+////////////////////////////////////////////////////////////
+/// \brief Completed operation returned by sfAsyncIo_reap
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfAsyncIoOperation operation;   ///< Kind of operation
+    sfSocketStatus     status;      ///< Result of the operation
+    sfTcpSocket*       socket;      ///< Socket which sent or received, or newly accepted socket (NULL on failure)
+    sfTcpListener*     listener;    ///< Listener which accepted, or NULL
+    size_t             transferred; ///< Number of bytes sent or received
+    void*              userData;    ///< User data given when the operation was submitted
+} sfAsyncIoCompletion;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new asynchronous I/O queue
+///
+/// An asynchronous I/O queue runs socket operations in the
+/// background: operations are submitted along with a user data
+/// pointer, which identifies them once they complete, and
+/// completions are collected in batches by sfAsyncIo_reap.
+///
+/// On Linux, operations are run by the kernel through io_uring
+/// when it is available (Linux 5.11 and later, for both the
+/// running kernel and the headers CSFML was built with), and are
+/// otherwise emulated by waiting for the sockets to be ready
+/// and running the operations in sfAsyncIo_reap. Either way,
+/// operations which can't complete immediately are handed to
+/// the system in batches, by the next call to sfAsyncIo_reap.
+///
+/// Operations on the same socket and of the same kind complete
+/// in the order they were submitted. While operations are
+/// pending, a socket is owned by the queue: it must not be used
+/// directly, and its blocking state may be changed until its
+/// operations are cancelled.
+///
+/// \param emulate true to always emulate asynchronous operations
+///
+/// \return A new sfAsyncIo object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfAsyncIo* sfAsyncIo_create(bool emulate);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an asynchronous I/O queue
+///
+/// Pending operations are cancelled, and accepted sockets
+/// which were not reaped yet are destroyed.
+///
+/// \param asyncIo Asynchronous I/O queue to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfAsyncIo_destroy(const sfAsyncIo* asyncIo);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether an asynchronous I/O queue is emulated
+///
+/// \param asyncIo Asynchronous I/O queue object
+///
+/// \return true if operations are emulated, false if they are run by the system
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfAsyncIo_isEmulated(const sfAsyncIo* asyncIo);
+
+////////////////////////////////////////////////////////////
+/// \brief Submit an operation sending data to a TCP socket
+///
+/// The operation completes once all the data is sent, or the
+/// socket fails. \a data must stay valid until then.
+///
+/// \param asyncIo  Asynchronous I/O queue object
+/// \param socket   Connected socket to send to
+/// \param data     Pointer to the data to send
+/// \param size     Number of bytes to send
+/// \param userData Value returned with the completion
+///
+/// \return true if the operation was submitted, false if the socket is not connected
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfAsyncIo_send(sfAsyncIo*   asyncIo,
+                                      sfTcpSocket* socket,
+                                      const void*  data,
+                                      size_t       size,
+                                      void*        userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Submit an operation receiving data from a TCP socket
+///
+/// The operation completes as soon as some data is received,
+/// like sfTcpSocket_receive. \a data must stay valid until then.
+///
+/// \param asyncIo  Asynchronous I/O queue object
+/// \param socket   Connected socket to receive from
+/// \param data     Pointer to the buffer to fill
+/// \param size     Maximum number of bytes to receive
+/// \param userData Value returned with the completion
+///
+/// \return true if the operation was submitted, false if the socket is not connected
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfAsyncIo_receive(sfAsyncIo*   asyncIo,
+                                         sfTcpSocket* socket,
+                                         void*        data,
+                                         size_t       size,
+                                         void*        userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Submit an operation accepting a connection on a TCP listener
+///
+/// The accepted socket is returned in the completion, and must
+/// be destroyed with sfTcpSocket_destroy.
+///
+/// \param asyncIo  Asynchronous I/O queue object
+/// \param listener Listening TCP listener
+/// \param userData Value returned with the completion
+///
+/// \return true if the operation was submitted, false if the listener is not listening
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfAsyncIo_accept(sfAsyncIo* asyncIo, sfTcpListener* listener, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Cancel the pending operations of a TCP socket
+///
+/// The cancelled operations don't produce completions, and the
+/// socket gets back the blocking state it had before its first
+/// operation. This function must be called before a socket
+/// which was used with the queue is disconnected or destroyed.
+///
+/// Running operations are interrupted and waited for; if the
+/// system can't interrupt them within one second, the socket
+/// is shut down so that they complete.
+///
+/// \param asyncIo Asynchronous I/O queue object
+/// \param socket  Socket whose operations must be cancelled
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfAsyncIo_cancelTcpSocket(sfAsyncIo* asyncIo, sfTcpSocket* socket);
+
+////////////////////////////////////////////////////////////
+/// \brief Cancel the pending operations of a TCP listener
+///
+/// The cancelled operations don't produce completions, and the
+/// listener gets back the blocking state it had before its
+/// first operation. This function must be called before a
+/// listener which was used with the queue is closed or
+/// destroyed.
+///
+/// A running accept is interrupted and waited for; if the
+/// system can't interrupt it within one second, the listener
+/// is shut down so that it completes.
+///
+/// \param asyncIo  Asynchronous I/O queue object
+/// \param listener Listener whose operations must be cancelled
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfAsyncIo_cancelTcpListener(sfAsyncIo* asyncIo, sfTcpListener* listener);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of pending operations
+///
+/// \param asyncIo Asynchronous I/O queue object
+///
+/// \return Number of submitted operations which were not reaped yet
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfAsyncIo_getPendingCount(const sfAsyncIo* asyncIo);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait for operations to complete
+///
+/// This function returns as soon as at least one operation is
+/// complete, and fills \a completions with up to
+/// \a maxCompletions completed operations; the others are
+/// returned by the next calls. It returns immediately if there
+/// is no pending operation.
+///
+/// \param asyncIo        Asynchronous I/O queue object
+/// \param completions    Array to fill with the completed operations
+/// \param maxCompletions Number of elements in \a completions
+/// \param timeout        Maximum time to wait (`sfTime_Zero` for infinite)
+///
+/// \return Number of completions written to \a completions, 0 if the timeout is over
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfAsyncIo_reap(sfAsyncIo*           asyncIo,
+                                        sfAsyncIoCompletion* completions,
+                                        size_t               maxCompletions,
+                                        sfTime               timeout);
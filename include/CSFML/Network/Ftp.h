@@ -31,6 +31,8 @@
 
 #include <CSFML/Network/IpAddress.h>
 #include <CSFML/Network/Types.h>
+#include <CSFML/System/Buffer.h>
+#include <CSFML/System/InputStream.h>
 
 #include <stddef.h>
 
@@ -47,6 +49,31 @@ typedef enum
 } sfFtpTransferMode;
 
 
+////////////////////////////////////////////////////////////
+/// \brief Callback receiving the data of a download
+///
+/// \param data     Data received
+/// \param size     Size of the data, in bytes
+/// \param userData User data given to the download function
+///
+/// \return True to continue the download, false to abort it
+///
+////////////////////////////////////////////////////////////
+typedef bool (*sfFtpDataCallback)(const void* data, size_t size, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Callback reporting the progress of a transfer
+///
+/// \param transferred Number of bytes transferred so far
+/// \param total       Total number of bytes to transfer, or 0 if it is unknown
+/// \param userData    User data given to the transfer function
+///
+/// \return True to continue the transfer, false to abort it
+///
+////////////////////////////////////////////////////////////
+typedef bool (*sfFtpProgressCallback)(uint64_t transferred, uint64_t total, void* userData);
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Status codes possibly returned by a FTP response
 ///
@@ -220,8 +247,8 @@ CSFML_NETWORK_API const char* sfFtpDirectoryResponse_getMessage(const sfFtpDirec
 ////////////////////////////////////////////////////////////
 /// \brief Get the directory returned in a FTP directory response
 ///
-/// The returned const char* owns the string and must be freed to
-/// avoid memory leaks.
+/// The returned const char* owns the string and must be freed with
+/// sfFree to avoid memory leaks.
 ///
 /// \param ftpDirectoryResponse Ftp directory response
 ///
@@ -234,8 +261,8 @@ CSFML_NETWORK_API const char* sfFtpDirectoryResponse_getDirectory(const sfFtpDir
 ////////////////////////////////////////////////////////////
 /// \brief Get the directory returned in a FTP directory response
 ///
-/// The returned const sfChar32* owns the string and must be freed to
-/// avoid memory leaks.
+/// The returned const sfChar32* owns the string and must be freed with
+/// sfFree to avoid memory leaks.
 ///
 /// \param ftpDirectoryResponse Ftp directory response
 ///
@@ -302,6 +329,54 @@ CSFML_NETWORK_API sfFtp* sfFtp_create(void);
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API void sfFtp_destroy(const sfFtp* ftp);
 
+////////////////////////////////////////////////////////////
+/// \brief Give a FTP response back to a Ftp object for reuse
+///
+/// Instead of destroying the response, the Ftp object keeps
+/// it and returns it from a later function returning a
+/// sfFtpResponse, which then doesn't need to allocate a new
+/// response. \a ftpResponse must not be used after this call.
+///
+/// Only the allocation of the response object is saved: the
+/// message of the new response is moved into it, so the
+/// memory of the old message is not reused.
+///
+/// Released responses are destroyed with the Ftp object.
+///
+/// \param ftp         Ftp object
+/// \param ftpResponse Ftp response to release, can be NULL
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfFtp_releaseResponse(sfFtp* ftp, sfFtpResponse* ftpResponse);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a FTP directory response back to a Ftp object for reuse
+///
+/// The response is reused by a later call to
+/// sfFtp_getWorkingDirectory, like sfFtp_releaseResponse
+/// does for the functions returning a sfFtpResponse.
+/// \a ftpDirectoryResponse must not be used after this call.
+///
+/// \param ftp                  Ftp object
+/// \param ftpDirectoryResponse Ftp directory response to release, can be NULL
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfFtp_releaseDirectoryResponse(sfFtp* ftp, sfFtpDirectoryResponse* ftpDirectoryResponse);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a FTP listing response back to a Ftp object for reuse
+///
+/// The response is reused by a later call to
+/// sfFtp_getDirectoryListing, like sfFtp_releaseResponse
+/// does for the functions returning a sfFtpResponse.
+/// \a ftpListingResponse must not be used after this call.
+///
+/// \param ftp                Ftp object
+/// \param ftpListingResponse Ftp listing response to release, can be NULL
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfFtp_releaseListingResponse(sfFtp* ftp, sfFtpListingResponse* ftpListingResponse);
+
 ////////////////////////////////////////////////////////////
 /// \brief Connect to the specified FTP server
 ///
@@ -530,6 +605,112 @@ CSFML_NETWORK_API sfFtpResponse* sfFtp_upload(
     sfFtpTransferMode mode,
     bool              append);
 
+////////////////////////////////////////////////////////////
+/// \brief Download a file from a FTP server to a callback
+///
+/// The data of the file is passed to \a onData as it arrives,
+/// in parts of at most 16 KB, so that it can be processed
+/// without being stored. The filename of the distant file is
+/// relative to the current working directory of the server.
+///
+/// \a onProgress is called after each part with the number
+/// of bytes received so far. The total size of the file is
+/// asked to the server with the SIZE command, which not all
+/// servers support, and is only known in binary mode.
+///
+/// If a callback returns false, the download is aborted and
+/// the response has the status sfFtpTransferAborted. If the
+/// data connection fails before the end of the file, the
+/// response has the status sfFtpConnectionClosed, unless the
+/// server reports an error itself.
+///
+/// The transfer uses the connection and the login of the Ftp
+/// object, in the current working directory, and returns once
+/// the server has sent the reply ending it.
+///
+/// \param ftp        Ftp object
+/// \param remoteFile Filename of the distant file to download
+/// \param mode       Transfer mode
+/// \param onData     Callback receiving the data of the file, can be NULL
+/// \param onProgress Callback reporting the progress of the download, can be NULL
+/// \param userData   User data to pass to the callbacks
+///
+/// \return Server response to the request
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfFtpResponse* sfFtp_downloadToCallback(sfFtp*                ftp,
+                                                          const char*           remoteFile,
+                                                          sfFtpTransferMode     mode,
+                                                          sfFtpDataCallback     onData,
+                                                          sfFtpProgressCallback onProgress,
+                                                          void*                 userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Download a file from a FTP server to a buffer
+///
+/// The buffer is cleared, then filled with the data of the
+/// file as it arrives; if the download fails, it holds the
+/// data received before the failure. If the buffer can't
+/// grow, the download is aborted and the response has the
+/// status sfFtpInsufficientStorageSpace. See
+/// sfFtp_downloadToCallback for the progress reporting.
+///
+/// \param ftp        Ftp object
+/// \param remoteFile Filename of the distant file to download
+/// \param mode       Transfer mode
+/// \param buffer     Buffer to fill with the data of the file
+/// \param onProgress Callback reporting the progress of the download, can be NULL
+/// \param userData   User data to pass to \a onProgress
+///
+/// \return Server response to the request
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfFtpResponse* sfFtp_downloadToBuffer(sfFtp*                ftp,
+                                                        const char*           remoteFile,
+                                                        sfFtpTransferMode     mode,
+                                                        sfBuffer*             buffer,
+                                                        sfFtpProgressCallback onProgress,
+                                                        void*                 userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Upload the content of a stream to a FTP server
+///
+/// The stream is rewound if it has a seek function, then read
+/// to its end in parts of at most 16 KB, which are sent as
+/// they are read. The remote path is relative to the current
+/// directory of the FTP server.
+///
+/// \a onProgress is called after each part with the number
+/// of bytes sent so far, and the size of the stream as total.
+///
+/// If \a onProgress returns false, the upload is aborted and
+/// the response has the status sfFtpTransferAborted. If the
+/// stream can't be read, the upload is aborted and the
+/// response has the status sfFtpInvalidFile. If the data
+/// connection fails, the response has the status
+/// sfFtpConnectionClosed, unless the server reports an error
+/// itself. In all cases, the server may keep the part of the
+/// file it received.
+///
+/// \param ftp        Ftp object
+/// \param stream     Stream to upload
+/// \param remotePath Where to put to file on the server
+/// \param mode       Transfer mode
+/// \param append     Pass true to append to or false to overwrite the remote file if it already exists
+/// \param onProgress Callback reporting the progress of the upload, can be NULL
+/// \param userData   User data to pass to \a onProgress
+///
+/// \return Server response to the request
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfFtpResponse* sfFtp_uploadFromStream(sfFtp*                ftp,
+                                                        sfInputStream*        stream,
+                                                        const char*           remotePath,
+                                                        sfFtpTransferMode     mode,
+                                                        bool                  append,
+                                                        sfFtpProgressCallback onProgress,
+                                                        void*                 userData);
+
 ////////////////////////////////////////////////////////////
 /// \brief Send a command to the FTP server
 ///
@@ -32,6 +32,8 @@
 #include <CSFML/Network/Types.h>
 #include <CSFML/System/Time.h>
 
+#include <stddef.h>
+
 
 ////////////////////////////////////////////////////////////
 /// \brief Enumerate the available HTTP methods for a request
@@ -88,6 +90,33 @@ typedef enum
 } sfHttpStatus;
 
 
+////////////////////////////////////////////////////////////
+/// \brief Function receiving the header of a streamed HTTP response
+///
+/// \a response has the status, the version and the fields of
+/// the response, and an empty body.
+///
+/// \param response HTTP response, valid during the call only
+/// \param userData User data given to sfHttp_sendRequestStreaming
+///
+/// \return true to receive the body, false to close the connection without receiving it
+///
+////////////////////////////////////////////////////////////
+typedef bool (*sfHttpHeadersCallback)(const sfHttpResponse* response, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Function receiving a part of the body of a streamed HTTP response
+///
+/// \param data     Data of the part, valid during the call only
+/// \param size     Size of the part, in bytes
+/// \param userData User data given to sfHttp_sendRequestStreaming
+///
+/// \return true to continue receiving the body, false to close the connection
+///
+////////////////////////////////////////////////////////////
+typedef bool (*sfHttpBodyChunkCallback)(const void* data, size_t size, void* userData);
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new HTTP request
 ///
@@ -268,9 +297,11 @@ CSFML_NETWORK_API void sfHttp_destroy(const sfHttp* http);
 /// doesn't actually connect to it until you send a request.
 /// If the port is 0, it means that the HTTP client will use
 /// the right port according to the protocol used
-/// (80 for HTTP, 443 for HTTPS). You should
+/// (80 for HTTP). You should
 /// leave it like this unless you really need a port other
 /// than the standard one, or use an unknown protocol.
+/// HTTPS is not supported: a host starting with "https://"
+/// is cleared, so that the requests fail.
 ///
 /// \param http Http object
 /// \param host Web server to connect to
@@ -279,6 +310,26 @@ CSFML_NETWORK_API void sfHttp_destroy(const sfHttp* http);
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API void sfHttp_setHost(sfHttp* http, const char* host, unsigned short port);
 
+////////////////////////////////////////////////////////////
+/// \brief Keep the connection of a HTTP object open between requests
+///
+/// By default, every request opens a new connection to the
+/// host, which is closed after the response. In persistent
+/// mode, requests ask the server to keep the connection open
+/// with a "Connection: keep-alive" field (unless they set the
+/// field themselves), and the next requests reuse it for as
+/// long as the server allows. A new connection is opened
+/// transparently when the server closes it.
+///
+/// Changing the host, or leaving persistent mode, closes the
+/// connection.
+///
+/// \param http       Http object
+/// \param persistent True to keep the connection open, false to use a connection per request
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfHttp_setPersistent(sfHttp* http, bool persistent);
+
 ////////////////////////////////////////////////////////////
 /// \brief Send a HTTP request and return the server's response.
 ///
@@ -287,9 +338,10 @@ CSFML_NETWORK_API void sfHttp_setHost(sfHttp* http, const char* host, unsigned s
 /// with an appropriate value.
 /// Warning: this function waits for the server's response and may
 /// not return instantly; use a thread if you don't want to block your
-/// application, or use a timeout to limit the time to wait. A value
-/// of 0 means that the client will use the system default timeout
-/// (which is usually pretty long).
+/// application, or use a timeout to limit the time to connect and the
+/// time to wait for each part of the response. A value of 0 means
+/// that the client will use the system default timeout (which is
+/// usually pretty long).
 ///
 /// \param http    Http object
 /// \param request Request to send
@@ -299,3 +351,91 @@ CSFML_NETWORK_API void sfHttp_setHost(sfHttp* http, const char* host, unsigned s
 ///
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfHttpResponse* sfHttp_sendRequest(sfHttp* http, const sfHttpRequest* request, sfTime timeout);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a HTTP request and stream the body of the server's response
+///
+/// Instead of keeping the whole body in the response, which
+/// needs as much memory as its size, the body is passed to
+/// \a onBodyChunk in parts of at most 16 KB as it arrives, so
+/// that the memory used stays constant. Bodies with a
+/// Content-Length field, sent with the chunked transfer
+/// encoding, or ending with the connection are supported.
+///
+/// \a onHeaders is called first, once the header of the
+/// response has arrived, to inspect its status and fields
+/// before the body.
+///
+/// The request is sent over the persistent connection in
+/// persistent mode (see sfHttp_setPersistent), and over a
+/// connection of its own otherwise. The timeout limits the
+/// time to connect and the time to wait for each part of the
+/// response.
+///
+/// \param http        Http object
+/// \param request     Request to send
+/// \param onHeaders   Function receiving the header of the response (can be NULL)
+/// \param onBodyChunk Function receiving the parts of the body (can be NULL to ignore the body)
+/// \param userData    User data to pass to the callbacks
+/// \param timeout     Maximum time to wait
+///
+/// \return Server's response with an empty body, whose status is sfHttpConnectionFailed
+///         if the connection failed or \a onBodyChunk stopped it before the end of the body
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfHttpResponse* sfHttp_sendRequestStreaming(sfHttp*                 http,
+                                                              const sfHttpRequest*    request,
+                                                              sfHttpHeadersCallback   onHeaders,
+                                                              sfHttpBodyChunkCallback onBodyChunk,
+                                                              void*                   userData,
+                                                              sfTime                  timeout);
+
+////////////////////////////////////////////////////////////
+/// \brief Send several HTTP requests and return the server's responses
+///
+/// In persistent mode (see sfHttp_setPersistent), the
+/// requests are pipelined: consecutive GET, HEAD, PUT and
+/// DELETE requests are all written to the connection before
+/// their responses are read, which saves a round trip per
+/// request. If the connection closes before all of their
+/// responses arrived, the remaining requests are sent again
+/// on a new connection. POST requests are not idempotent, so
+/// each one is sent alone and is never sent twice; if its
+/// connection fails, its response has the status
+/// sfHttpConnectionFailed.
+///
+/// Otherwise, the requests are sent one after the other as
+/// with sfHttp_sendRequest.
+///
+/// \param http      Http object
+/// \param requests  Requests to send, in order
+/// \param count     Number of requests
+/// \param responses Array of \a count responses to fill, in the order of the requests
+/// \param timeout   Maximum time to wait
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfHttp_sendRequests(sfHttp*                     http,
+                                           const sfHttpRequest* const* requests,
+                                           size_t                      count,
+                                           sfHttpResponse**            responses,
+                                           sfTime                      timeout);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a HTTP response back to a Http object for reuse
+///
+/// Instead of destroying the response, the Http object keeps
+/// it and returns it from a later call to sfHttp_sendRequest,
+/// which then doesn't need to allocate a new response.
+/// \a httpResponse must not be used after this call.
+///
+/// The response is cleared when it is reused, which keeps the
+/// memory of its body: the body of the new response is received
+/// into it without a new allocation if it fits.
+///
+/// Released responses are destroyed with the Http object.
+///
+/// \param http         Http object
+/// \param httpResponse HTTP response to release, can be NULL
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfHttp_releaseResponse(sfHttp* http, sfHttpResponse* httpResponse);
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Export.h>
+
+#include <CSFML/Network/Http.h>
+#include <CSFML/Network/Types.h>
+#include <CSFML/System/Time.h>
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief States of a request submitted to a HTTP client
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfHttpFuturePending,  ///< The request is waiting for a worker
+    sfHttpFutureRunning,  ///< A worker is sending the request and waiting for its response
+    sfHttpFutureReady,    ///< The response is available
+    sfHttpFutureCancelled ///< The request was cancelled before its response was available
+} sfHttpFutureStatus;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new HTTP client
+///
+/// A HTTP client sends requests in the background, so that
+/// the thread submitting them doesn't wait for the server.
+/// It owns \a workerCount threads, each with its own
+/// persistent connection (see sfHttp_setPersistent): a worker
+/// takes the oldest request it is allowed to send, sends it
+/// and makes its response available through the future
+/// returned by sfHttpClient_submit.
+///
+/// At most \a maxConnectionsPerHost connections are open to
+/// the same host and port at any time. A worker whose
+/// connection is open to a host keeps it for the next
+/// requests to that host, and only closes it to send a
+/// request to another host, so that requests to a host which
+/// already has its maximum number of connections wait for
+/// one of them instead.
+///
+/// \param workerCount           Number of worker threads and connections (at least 1)
+/// \param maxConnectionsPerHost Maximum number of connections to a single host (at least 1)
+///
+/// \return A new sfHttpClient object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfHttpClient* sfHttpClient_create(size_t workerCount, size_t maxConnectionsPerHost);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a HTTP client
+///
+/// The requests which have no response yet are cancelled, and
+/// this function waits for the workers to stop. The futures
+/// returned by the client stay valid, and must still be
+/// destroyed with sfHttpFuture_destroy.
+///
+/// \param client HTTP client to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfHttpClient_destroy(const sfHttpClient* client);
+
+////////////////////////////////////////////////////////////
+/// \brief Submit a HTTP request to a HTTP client
+///
+/// The request is copied, so it can be modified or destroyed
+/// as soon as this function returns. \a host and \a port have
+/// the same meaning as in sfHttp_setHost; the host name is
+/// resolved by the worker which sends the request.
+///
+/// This function doesn't wait for the request to be sent.
+///
+/// \param client  HTTP client object
+/// \param host    Web server to connect to
+/// \param port    Port to use for connection, or 0 for the default port of the protocol
+/// \param request Request to send
+/// \param timeout Maximum time to wait for the server, or 0 for the system default
+///
+/// \return Future of the response, to destroy with sfHttpFuture_destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfHttpFuture* sfHttpClient_submit(sfHttpClient*        client,
+                                                    const char*          host,
+                                                    unsigned short       port,
+                                                    const sfHttpRequest* request,
+                                                    sfTime               timeout);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a future of a HTTP response
+///
+/// If the request has no response yet, it is cancelled.
+///
+/// \param future Future to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfHttpFuture_destroy(const sfHttpFuture* future);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the current state of the request of a future
+///
+/// This function doesn't wait.
+///
+/// \param future Future object
+///
+/// \return State of the request
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfHttpFutureStatus sfHttpFuture_getStatus(const sfHttpFuture* future);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until the response of a future is available
+///
+/// This function returns as soon as the request is ready or
+/// cancelled, or once \a timeout elapsed.
+///
+/// \param future  Future object
+/// \param timeout Maximum time to wait (use sfTime_Zero for infinity)
+///
+/// \return State of the request when the function returns
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfHttpFutureStatus sfHttpFuture_wait(sfHttpFuture* future, sfTime timeout);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the response of a future
+///
+/// The response belongs to the future, and is valid until the
+/// future is destroyed. Its status is sfHttpConnectionFailed
+/// if the worker couldn't reach the server.
+///
+/// \param future Future object
+///
+/// \return Response of the server, or NULL if the request isn't ready
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API const sfHttpResponse* sfHttpFuture_getResponse(const sfHttpFuture* future);
+
+////////////////////////////////////////////////////////////
+/// \brief Cancel the request of a future
+///
+/// A pending request is never sent. A running request is
+/// interrupted while its worker connects, sends it or waits
+/// for the server, and its worker then closes its connection,
+/// since it may still receive the response. Either way, the
+/// request is cancelled when this function returns.
+///
+/// The resolution of the host name can't be interrupted: a
+/// worker resolving it keeps doing so after the cancellation,
+/// before moving on to the next request. On Windows, neither
+/// can the connection and the sending, which are only limited
+/// by the timeout of the request.
+///
+/// \param future Future object
+///
+/// \return True if the request was cancelled, false if it was already ready or cancelled
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfHttpFuture_cancel(sfHttpFuture* future);
@@ -41,6 +41,20 @@ typedef struct
     char address[16];
 } sfIpAddress;
 
+////////////////////////////////////////////////////////////
+/// \brief IPv4 network address carrying its packed form
+///
+/// Sockets functions taking this type use the 32-bits
+/// integer directly, without parsing or formatting the
+/// string on every call.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfIpAddress address; ///< Address as a string, empty for invalid addresses
+    uint32_t    integer; ///< Address as a 32-bits integer (see sfIpAddress_toInteger)
+} sfIpAddressPacked;
+
 
 ////////////////////////////////////////////////////////////
 /// \brief Empty object that represents invalid addresses
@@ -141,6 +155,30 @@ CSFML_NETWORK_API void sfIpAddress_toString(sfIpAddress address, char* string);
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API uint32_t sfIpAddress_toInteger(sfIpAddress address);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the packed form of an address
+///
+/// The string of the address is parsed once, so that the
+/// result can be used with the sockets functions taking a
+/// sfIpAddressPacked.
+///
+/// \param address Address object
+///
+/// \return Packed address, with an empty string if \a address is invalid
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfIpAddressPacked sfIpAddress_toPacked(sfIpAddress address);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a packed address from a 32-bits integer
+///
+/// \param address 4 bytes of the address packed into a 32-bits integer
+///
+/// \return Resulting packed address
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfIpAddressPacked sfIpAddressPacked_fromInteger(uint32_t address);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the computer's local address
 ///
@@ -34,6 +34,31 @@
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief Callback transforming the data of a packet before it is sent
+///
+/// \param data     Data of the packet
+/// \param size     Size of the data, in bytes
+/// \param output   Empty packet to append the transformed data to
+/// \param userData User data given to sfPacket_setTransform
+///
+////////////////////////////////////////////////////////////
+typedef void (*sfPacketSendTransform)(const void* data, size_t size, sfPacket* output, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Callback restoring the data of a packet after it is received
+///
+/// \param data     Data received from the network
+/// \param size     Size of the data, in bytes
+/// \param output   Empty packet to append the restored data to
+/// \param userData User data given to sfPacket_setTransform
+///
+/// \return true if the data was restored, false if it is corrupted
+///
+////////////////////////////////////////////////////////////
+typedef bool (*sfPacketReceiveTransform)(const void* data, size_t size, sfPacket* output, void* userData);
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new packet
 ///
@@ -172,6 +197,129 @@ CSFML_NETWORK_API double   sfPacket_readDouble(sfPacket* packet);
 CSFML_NETWORK_API void     sfPacket_readString(sfPacket* packet, char* string);
 CSFML_NETWORK_API void     sfPacket_readWideString(sfPacket* packet, wchar_t* string);
 
+////////////////////////////////////////////////////////////
+/// \brief Extract a string from a packet without copying it
+///
+/// This function reads a string written by sfPacket_writeString
+/// and points to its characters in the packet's own storage,
+/// instead of copying them. The characters are not followed
+/// by a null character.
+///
+/// The pointer is valid until the packet is modified or
+/// destroyed. If there is no complete string to read, the
+/// packet becomes invalid, \a data is set to NULL and
+/// \a length to 0.
+///
+/// \param packet Packet object
+/// \param data   Receives a pointer to the first character
+/// \param length Receives the number of characters
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_readStringView(sfPacket* packet, const char** data, size_t* length);
+
+////////////////////////////////////////////////////////////
+/// \brief Extract a block of bytes from a packet without copying it
+///
+/// This function reads a block written by sfPacket_writeBlob
+/// and points to its bytes in the packet's own storage,
+/// instead of copying them.
+///
+/// The pointer is valid until the packet is modified or
+/// destroyed. If there is no complete block to read, the
+/// packet becomes invalid, \a data is set to NULL and
+/// \a size to 0.
+///
+/// \param packet Packet object
+/// \param data   Receives a pointer to the first byte
+/// \param size   Receives the number of bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_readBlob(sfPacket* packet, const void** data, size_t* size);
+
+////////////////////////////////////////////////////////////
+/// \brief Functions to extract arrays of data from a packet
+///
+/// Each function extracts \a count consecutive values, as
+/// inserted by the matching array function or by as many
+/// calls to the single value function, and converts them in
+/// one pass. If the packet doesn't contain enough data, it
+/// becomes invalid and \a values is left unchanged.
+///
+/// \param packet Packet object
+/// \param values Array to fill with the extracted values
+/// \param count  Number of values to extract
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_readInt8Array(sfPacket* packet, int8_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readUint8Array(sfPacket* packet, uint8_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readInt16Array(sfPacket* packet, int16_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readUint16Array(sfPacket* packet, uint16_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readInt32Array(sfPacket* packet, int32_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readUint32Array(sfPacket* packet, uint32_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readInt64Array(sfPacket* packet, int64_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readUint64Array(sfPacket* packet, uint64_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readFloatArray(sfPacket* packet, float* values, size_t count);
+CSFML_NETWORK_API void sfPacket_readDoubleArray(sfPacket* packet, double* values, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Extract a variable-length integer from a packet
+///
+/// See sfPacket_writeVarUint and sfPacket_writeVarInt. If the
+/// packet ends before the integer, or if the integer spans more
+/// than 10 bytes, the packet becomes invalid and 0 is returned.
+///
+/// \param packet Packet object
+///
+/// \return The extracted integer
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API uint64_t sfPacket_readVarUint(sfPacket* packet);
+CSFML_NETWORK_API int64_t  sfPacket_readVarInt(sfPacket* packet);
+
+////////////////////////////////////////////////////////////
+/// \brief Extract bits from a packet
+///
+/// The bits are taken from the byte holding the bits extracted
+/// last, as long as nothing else was extracted since, then from
+/// the next bytes. The read position advances by whole bytes:
+/// sfPacket_getReadPosition points past the byte holding the
+/// last extracted bit. Extracting bits past the end of the
+/// packet makes it invalid, see sfPacket_canRead.
+///
+/// \param packet   Packet object
+/// \param bitCount Number of bits to extract, up to 32
+///
+/// \return The extracted bits, as inserted by sfPacket_writeBits
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API uint32_t sfPacket_readBits(sfPacket* packet, unsigned int bitCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Extract a single bit from a packet, as a boolean
+///
+/// \param packet Packet object
+///
+/// \return The extracted boolean
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfPacket_readBit(sfPacket* packet);
+
+////////////////////////////////////////////////////////////
+/// \brief Extract a quantized float from a packet
+///
+/// \a min, \a max and \a bitCount must be the same as when the
+/// value was inserted with sfPacket_writeQuantizedFloat.
+///
+/// \param packet   Packet object
+/// \param min      Lowest value of the range
+/// \param max      Highest value of the range
+/// \param bitCount Number of bits of the value, from 1 to 32
+///
+/// \return The extracted value
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API float sfPacket_readQuantizedFloat(sfPacket* packet, float min, float max, unsigned int bitCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Functions to insert data into a packet
 ///
@@ -191,3 +339,159 @@ CSFML_NETWORK_API void sfPacket_writeFloat(sfPacket* packet, float);
 CSFML_NETWORK_API void sfPacket_writeDouble(sfPacket* packet, double);
 CSFML_NETWORK_API void sfPacket_writeString(sfPacket* packet, const char* string);
 CSFML_NETWORK_API void sfPacket_writeWideString(sfPacket* packet, const wchar_t* string);
+
+////////////////////////////////////////////////////////////
+/// \brief Insert a block of bytes into a packet, preceded by its size
+///
+/// Unlike sfPacket_append, this function writes the size of the
+/// block first, so that sfPacket_readBlob can extract it. A
+/// block of characters is encoded the same way as a string.
+///
+/// \param packet Packet object
+/// \param data   Pointer to the bytes to insert
+/// \param size   Number of bytes to insert
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_writeBlob(sfPacket* packet, const void* data, size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Functions to insert arrays of data into a packet
+///
+/// Each function inserts \a count consecutive values, encoded
+/// the same way as by as many calls to the single value
+/// function, but grows the packet only once and converts the
+/// values in one pass. The count itself is not inserted.
+///
+/// \param packet Packet object
+/// \param values Array of values to insert
+/// \param count  Number of values to insert
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_writeInt8Array(sfPacket* packet, const int8_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeUint8Array(sfPacket* packet, const uint8_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeInt16Array(sfPacket* packet, const int16_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeUint16Array(sfPacket* packet, const uint16_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeInt32Array(sfPacket* packet, const int32_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeUint32Array(sfPacket* packet, const uint32_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeInt64Array(sfPacket* packet, const int64_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeUint64Array(sfPacket* packet, const uint64_t* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeFloatArray(sfPacket* packet, const float* values, size_t count);
+CSFML_NETWORK_API void sfPacket_writeDoubleArray(sfPacket* packet, const double* values, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Insert a variable-length integer into a packet
+///
+/// The integer is encoded as LEB128: 7 bits per byte, lowest
+/// bits first, so that small values take fewer bytes (1 byte
+/// below 128, 2 bytes below 16384, up to 10 bytes).
+/// sfPacket_writeVarInt first maps signed values to unsigned
+/// ones with zigzag encoding (0, -1, 1, -2, ...), so that
+/// small negative values are small too.
+///
+/// \param packet Packet object
+/// \param value  Integer to insert
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_writeVarUint(sfPacket* packet, uint64_t value);
+CSFML_NETWORK_API void sfPacket_writeVarInt(sfPacket* packet, int64_t value);
+
+////////////////////////////////////////////////////////////
+/// \brief Insert bits into a packet
+///
+/// The bits are packed into the byte holding the bits inserted
+/// last, as long as nothing else was inserted since, then into
+/// new bytes, lowest bits first. Any other data inserted after
+/// bits starts on a new byte, so a packet must be read with the
+/// same sequence of calls as it was written.
+///
+/// This is useful to insert booleans or small enumerations
+/// without wasting a whole byte for each one.
+///
+/// \param packet   Packet object
+/// \param value    Bits to insert; bits above \a bitCount are ignored
+/// \param bitCount Number of bits to insert, up to 32
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_writeBits(sfPacket* packet, uint32_t value, unsigned int bitCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Insert a boolean into a packet, as a single bit
+///
+/// \param packet Packet object
+/// \param value  Boolean to insert
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_writeBit(sfPacket* packet, bool value);
+
+////////////////////////////////////////////////////////////
+/// \brief Insert a quantized float into a packet
+///
+/// The value is clamped to [\a min, \a max] and rounded to the
+/// nearest of 2^\a bitCount evenly spaced steps, then inserted
+/// as bits with sfPacket_writeBits. For example, a coordinate
+/// in a 1024 units wide world with 16 bits has a precision of
+/// 1/64 unit, and takes half the size of a float.
+///
+/// \param packet   Packet object
+/// \param value    Value to insert
+/// \param min      Lowest value of the range
+/// \param max      Highest value of the range, greater than \a min
+/// \param bitCount Number of bits to use, from 1 to 32
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_writeQuantizedFloat(sfPacket*    packet,
+                                                    float        value,
+                                                    float        min,
+                                                    float        max,
+                                                    unsigned int bitCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the callbacks transforming the data of a packet on the network
+///
+/// \a onSend is called each time the packet is sent by a
+/// socket, and what it appends to its output is sent instead of
+/// the data of the packet, which is left unchanged. \a onReceive
+/// is called each time data is received into the packet, and
+/// what it appends to its output, which is the packet itself,
+/// becomes the data of the packet. If it returns false, the
+/// packet is left empty and invalid, see sfPacket_canRead.
+///
+/// This allows compression or encryption of the packets, as long
+/// as the sender and the receiver use matching transforms.
+/// The transforms are kept by sfPacket_clear and sfPacket_copy.
+///
+/// \param packet    Packet object
+/// \param onSend    Callback called when the packet is sent, or NULL to send it as is
+/// \param onReceive Callback called when the packet is received, or NULL to receive it as is
+/// \param userData  Value passed to the callbacks
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_setTransform(sfPacket*                packet,
+                                             sfPacketSendTransform    onSend,
+                                             sfPacketReceiveTransform onReceive,
+                                             void*                    userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Built-in transforms compressing packets
+///
+/// The data is compressed in the LZ4 block format, which is
+/// very fast, and is well suited to packets with repetitive
+/// content such as state updates. Data which doesn't get
+/// smaller, such as small or already compressed packets, is
+/// sent as is, with one byte of overhead.
+///
+/// Use them on both ends of the connection:
+/// \code
+/// sfPacket_setTransform(packet, sfPacket_compress, sfPacket_decompress, NULL);
+/// \endcode
+///
+/// \param data     Data to transform
+/// \param size     Size of the data, in bytes
+/// \param output   Packet to append the transformed data to
+/// \param userData Unused
+///
+/// \return true if the data was decompressed, false if it is corrupted
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_compress(const void* data, size_t size, sfPacket* output, void* userData);
+CSFML_NETWORK_API bool sfPacket_decompress(const void* data, size_t size, sfPacket* output, void* userData);
@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Export.h>
+
+#include <CSFML/Network/Types.h>
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new packet pool
+///
+/// A packet pool recycles packets instead of destroying
+/// them, so that acquiring a packet does not allocate and
+/// its internal buffer keeps the capacity it grew to.
+///
+/// The pool is not thread-safe.
+///
+/// \param maxAvailable Maximum number of released packets kept
+///                     for reuse, 0 for no limit
+///
+/// \return A new sfPacketPool object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfPacketPool* sfPacketPool_create(size_t maxAvailable);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a packet pool
+///
+/// The packets kept by the pool are destroyed. Packets that
+/// are still acquired must be destroyed with sfPacket_destroy.
+///
+/// \param pool Packet pool to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacketPool_destroy(const sfPacketPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Get an empty packet from a pool
+///
+/// A released packet is reused if there is one, otherwise
+/// a new packet is created.
+///
+/// \param pool Packet pool object
+///
+/// \return An empty sfPacket object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfPacket* sfPacketPool_acquire(sfPacketPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a packet back to a pool
+///
+/// The packet is cleared and kept for a later call to
+/// sfPacketPool_acquire, or destroyed if the pool already
+/// keeps its maximum number of packets. \a packet must not
+/// be used after this call.
+///
+/// Any packet can be released, including packets created
+/// with sfPacket_create or acquired from another pool.
+///
+/// \param pool   Packet pool object
+/// \param packet Packet to release
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacketPool_release(sfPacketPool* pool, sfPacket* packet);
+
+////////////////////////////////////////////////////////////
+/// \brief Make sure a pool keeps a given number of packets
+///
+/// Creates packets until \a count packets are available,
+/// within the limit given to sfPacketPool_create.
+///
+/// \param pool  Packet pool object
+/// \param count Number of packets to keep available
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacketPool_reserve(sfPacketPool* pool, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of packets kept for reuse by a pool
+///
+/// \param pool Packet pool object
+///
+/// \return Number of packets available without allocation
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfPacketPool_getAvailableCount(const sfPacketPool* pool);
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Export.h>
+
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/SocketStatus.h>
+#include <CSFML/Network/Types.h>
+#include <CSFML/System/Time.h>
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Delivery guarantees of a message sent with sfReliableUdp_send
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfReliableUdpUnreliable,        ///< Sent once; may be lost, or delivered out of order
+    sfReliableUdpReliableUnordered, ///< Resent until acknowledged; delivered once, as soon as it arrives
+    sfReliableUdpReliableOrdered    ///< Resent until acknowledged; delivered once, in order within its channel
+} sfReliableUdpDelivery;
+
+////////////////////////////////////////////////////////////
+/// \brief Network conditions simulated on the outgoing datagrams
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float        lossRate; ///< Probability that an outgoing datagram is dropped, from 0 to 1
+    sfTime       latency;  ///< Delay added to every outgoing datagram
+    sfTime       jitter;   ///< Maximum random delay added on top of the latency, which may reorder datagrams
+    unsigned int seed;     ///< Seed of the random generator, for reproducible runs
+} sfReliableUdpSimulation;
+
+////////////////////////////////////////////////////////////
+/// \brief Statistics of the connection with a remote peer
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfTime   rtt;               ///< Smoothed round trip time
+    sfTime   rttVariance;       ///< Smoothed variation of the round trip time
+    float    lossRate;          ///< Recent ratio of the sent datagrams which were lost, from 0 to 1
+    uint64_t datagramsSent;     ///< Number of datagrams sent, acknowledgements only excluded
+    uint64_t datagramsReceived; ///< Number of datagrams received
+    uint64_t datagramsLost;     ///< Number of datagrams sent which were never acknowledged
+    uint64_t messagesResent;    ///< Number of times a reliable message was sent again
+    size_t   pendingCount;      ///< Number of reliable messages not acknowledged yet
+} sfReliableUdpStats;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a reliable UDP layer over a UDP socket
+///
+/// The layer exchanges messages made of the data of packets
+/// with any number of remote peers, identified by their
+/// address and port. Each datagram carries a sequence number
+/// and acknowledges the last 33 datagrams received from the
+/// peer, and reliable messages are sent again until a datagram
+/// carrying them is acknowledged, after a delay derived from
+/// the measured round trip time. Messages are grouped into
+/// datagrams of at most 1200 bytes, and at most 32 datagrams
+/// of reliable messages wait for acknowledgement at a time.
+///
+/// Each peer holds at most 16384 reliable messages received
+/// ahead of a missing one, which is more than the peer can
+/// have in flight.
+///
+/// The socket must be bound, and is made non-blocking. It is
+/// not destroyed with the layer, and it must not be used
+/// directly while the layer exists.
+///
+/// \param socket Bound UDP socket
+///
+/// \return A new sfReliableUdp object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfReliableUdp* sfReliableUdp_create(sfUdpSocket* socket);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a reliable UDP layer
+///
+/// Messages not sent or not acknowledged yet are discarded.
+///
+/// \param reliableUdp Reliable UDP layer to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfReliableUdp_destroy(const sfReliableUdp* reliableUdp);
+
+////////////////////////////////////////////////////////////
+/// \brief Simulate a lossy and slow network on the outgoing datagrams
+///
+/// This is meant to test an application, or the layer itself,
+/// over loopback. Set it on both ends to affect both
+/// directions.
+///
+/// \param reliableUdp Reliable UDP layer object
+/// \param simulation  Conditions to simulate, or NULL to send the datagrams normally
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfReliableUdp_setSimulation(sfReliableUdp*                 reliableUdp,
+                                                   const sfReliableUdpSimulation* simulation);
+
+////////////////////////////////////////////////////////////
+/// \brief Limit the number of peers that incoming datagrams can create
+///
+/// A datagram from an unknown address and port creates a new
+/// peer, which is kept until sfReliableUdp_disconnect is
+/// called. Since the source of a datagram can be spoofed,
+/// datagrams from unknown sources are ignored once there are
+/// \a maxPeers peers. Peers created by sfReliableUdp_send are
+/// not limited. The default limit is 1024 peers.
+///
+/// \param reliableUdp Reliable UDP layer object
+/// \param maxPeers    Number of peers above which datagrams from new peers are ignored
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfReliableUdp_setMaxPeers(sfReliableUdp* reliableUdp, size_t maxPeers);
+
+////////////////////////////////////////////////////////////
+/// \brief Queue a message for a remote peer
+///
+/// The message is a copy of the data of \a packet, transformed
+/// by its send transform if it has one (see
+/// sfPacket_setTransform). It is sent by the next call to
+/// sfReliableUdp_update.
+///
+/// Ordered messages are delivered in the order they were sent
+/// among the ordered messages of the same channel, so a lost
+/// message only delays the messages of its own channel.
+///
+/// \param reliableUdp   Reliable UDP layer object
+/// \param remoteAddress Address of the peer
+/// \param remotePort    Port of the peer
+/// \param channel       Channel of the message
+/// \param delivery      Delivery guarantees of the message
+/// \param packet        Packet containing the message
+///
+/// \return true if the message was queued, false if it is larger than sfReliableUdp_maxMessageSize()
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfReliableUdp_send(sfReliableUdp*        reliableUdp,
+                                          sfIpAddressPacked     remoteAddress,
+                                          unsigned short        remotePort,
+                                          uint8_t               channel,
+                                          sfReliableUdpDelivery delivery,
+                                          const sfPacket*       packet);
+
+////////////////////////////////////////////////////////////
+/// \brief Exchange datagrams with the remote peers
+///
+/// This function receives all the available datagrams,
+/// processes their acknowledgements and messages, then sends
+/// the queued messages, the reliable messages which were not
+/// acknowledged in time, and the pending acknowledgements.
+/// It never blocks; call it regularly, for example once per
+/// frame, even when there is nothing to send.
+///
+/// \param reliableUdp Reliable UDP layer object
+///
+/// \return Status code, sfSocketError if the socket failed
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfReliableUdp_update(sfReliableUdp* reliableUdp);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the next message received by a reliable UDP layer
+///
+/// The message becomes the data of \a packet, restored by its
+/// receive transform if it has one.
+///
+/// \param reliableUdp   Reliable UDP layer object
+/// \param packet        Packet to fill with the message
+/// \param remoteAddress Address of the peer that sent the message (can be NULL)
+/// \param remotePort    Port of the peer that sent the message (can be NULL)
+/// \param channel       Channel of the message (can be NULL)
+///
+/// \return true if a message was received, false if there is none left
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfReliableUdp_receive(sfReliableUdp*     reliableUdp,
+                                             sfPacket*          packet,
+                                             sfIpAddressPacked* remoteAddress,
+                                             unsigned short*    remotePort,
+                                             uint8_t*           channel);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the statistics of the connection with a remote peer
+///
+/// \param reliableUdp   Reliable UDP layer object
+/// \param remoteAddress Address of the peer
+/// \param remotePort    Port of the peer
+/// \param stats         Structure to fill with the statistics
+///
+/// \return true if the peer is known, false otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfReliableUdp_getStats(const sfReliableUdp* reliableUdp,
+                                              sfIpAddressPacked    remoteAddress,
+                                              unsigned short       remotePort,
+                                              sfReliableUdpStats*  stats);
+
+////////////////////////////////////////////////////////////
+/// \brief Forget a remote peer
+///
+/// Its pending messages and its statistics are discarded. If
+/// the peer sends datagrams again, it starts a new connection,
+/// whose sequence numbers don't match the ones the peer keeps.
+///
+/// \param reliableUdp   Reliable UDP layer object
+/// \param remoteAddress Address of the peer
+/// \param remotePort    Port of the peer
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfReliableUdp_disconnect(sfReliableUdp*    reliableUdp,
+                                                sfIpAddressPacked remoteAddress,
+                                                unsigned short    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Return the maximum size of a message
+///
+/// \return The maximum number of bytes of a message, so that it fits in a single datagram
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfReliableUdp_maxMessageSize(void);
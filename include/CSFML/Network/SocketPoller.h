@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Export.h>
+
+#include <CSFML/Network/SocketStatus.h>
+#include <CSFML/Network/Types.h>
+#include <CSFML/System/Time.h>
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief How a socket poller reports ready sockets
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfSocketPollerLevelTriggered, ///< A socket is reported by every wait as long as it has data to receive
+    sfSocketPollerEdgeTriggered   ///< A socket is reported once each time new data arrives
+} sfSocketPollerMode;
+
+////////////////////////////////////////////////////////////
+/// \brief Ready socket returned by sfSocketPoller_wait
+///
+/// Exactly one of the socket pointers is not NULL.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfTcpListener* tcpListener; ///< Listener ready to accept a connection, or NULL
+    sfTcpSocket*   tcpSocket;   ///< TCP socket ready to receive, or NULL
+    sfUdpSocket*   udpSocket;   ///< UDP socket ready to receive, or NULL
+    void*          userData;    ///< User data given when the socket was added
+} sfSocketPollerEvent;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new socket poller
+///
+/// A socket poller waits for data on many sockets at once,
+/// like sfSocketSelector, but is not limited in the number of
+/// sockets and returns the ready sockets directly, so that a
+/// wait only costs in proportion to the active sockets.
+/// It is backed by epoll on Linux, and by sfSocketSelector on
+/// other platforms, where it is always level-triggered.
+///
+/// In edge-triggered mode, make the sockets non-blocking and
+/// receive from a ready socket until it returns
+/// sfSocketNotReady, otherwise it won't be reported again.
+///
+/// \param mode How ready sockets are reported
+///
+/// \return A new sfSocketPoller object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketPoller* sfSocketPoller_create(sfSocketPollerMode mode);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a socket poller
+///
+/// The sockets are not destroyed.
+///
+/// \param poller Socket poller to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfSocketPoller_destroy(const sfSocketPoller* poller);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a new socket to a socket poller
+///
+/// The socket must already be bound, listening or connected,
+/// since it only gets a system handle at that point; it must be
+/// removed before being disconnected, unbound or destroyed.
+/// Adding a socket which is already in the poller updates its
+/// user data.
+///
+/// \param poller   Socket poller object
+/// \param socket   Pointer to the socket to add
+/// \param userData Value returned along with the socket when it is ready
+///
+/// \return true if the socket was added, false otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API bool sfSocketPoller_addTcpListener(sfSocketPoller* poller, sfTcpListener* socket, void* userData);
+CSFML_NETWORK_API bool sfSocketPoller_addTcpSocket(sfSocketPoller* poller, sfTcpSocket* socket, void* userData);
+CSFML_NETWORK_API bool sfSocketPoller_addUdpSocket(sfSocketPoller* poller, sfUdpSocket* socket, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove a socket from a socket poller
+///
+/// \param poller Socket poller object
+/// \param socket Pointer to the socket to remove
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfSocketPoller_removeTcpListener(sfSocketPoller* poller, sfTcpListener* socket);
+CSFML_NETWORK_API void sfSocketPoller_removeTcpSocket(sfSocketPoller* poller, sfTcpSocket* socket);
+CSFML_NETWORK_API void sfSocketPoller_removeUdpSocket(sfSocketPoller* poller, sfUdpSocket* socket);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of sockets in a socket poller
+///
+/// \param poller Socket poller object
+///
+/// \return Number of sockets added to the poller
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfSocketPoller_getSocketCount(const sfSocketPoller* poller);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until one or more sockets are ready to receive
+///
+/// This function returns as soon as at least one socket is
+/// ready, and fills \a events with up to \a maxEvents ready
+/// sockets. Sockets which did not fit are returned by the
+/// next wait (in edge-triggered mode, only if they were not
+/// reported yet). Disconnected sockets and sockets in error
+/// are reported as ready, so that the next receive returns
+/// their status.
+///
+/// A wait interrupted by a signal is resumed for the rest of
+/// the timeout. On platforms other than Linux, errors can't be
+/// told apart from timeouts and are reported as sfSocketNotReady.
+///
+/// \param poller     Socket poller object
+/// \param events     Array to fill with the ready sockets
+/// \param maxEvents  Number of elements in \a events
+/// \param eventCount Receives the number of ready sockets written to \a events
+/// \param timeout    Maximum time to wait (`sfTime_Zero` for infinite)
+///
+/// \return sfSocketDone if sockets are ready, sfSocketNotReady if the
+///         timeout is over, sfSocketError if the wait failed
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfSocketPoller_wait(sfSocketPoller*      poller,
+                                                     sfSocketPollerEvent* events,
+                                                     size_t               maxEvents,
+                                                     size_t*              eventCount,
+                                                     sfTime               timeout);
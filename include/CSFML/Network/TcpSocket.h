@@ -37,6 +37,17 @@
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief Contiguous block of data, for scatter/gather sends
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const void* data; ///< Pointer to the bytes
+    size_t      size; ///< Number of bytes
+} sfIoVec;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new TCP socket
 ///
@@ -181,6 +192,32 @@ CSFML_NETWORK_API sfSocketStatus sfTcpSocket_send(sfTcpSocket* socket, const voi
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfSocketStatus sfTcpSocket_sendPartial(sfTcpSocket* socket, const void* data, size_t size, size_t* sent);
 
+////////////////////////////////////////////////////////////
+/// \brief Send several blocks of data to the remote peer at once
+///
+/// The blocks are sent one after the other, as if they were
+/// concatenated, but without copying them: on systems which
+/// support it, they are handed to a single system call.
+///
+/// \a sent is both an input and an output: it must point to 0
+/// on the first call, and receives the total number of bytes
+/// sent. If the function returns sfSocketPartial, call it again
+/// with the same blocks and the same \a sent to send the rest.
+/// This function will fail if the socket is not connected.
+///
+/// \param socket TCP socket object
+/// \param vecs   Array of blocks to send
+/// \param count  Number of elements in \a vecs
+/// \param sent   Number of bytes of the blocks already sent (can be NULL)
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfTcpSocket_sendv(sfTcpSocket*   socket,
+                                                   const sfIoVec* vecs,
+                                                   size_t         count,
+                                                   size_t*        sent);
+
 ////////////////////////////////////////////////////////////
 /// \brief Receive raw data from the remote peer of a TCP socket
 ///
@@ -215,6 +252,35 @@ CSFML_NETWORK_API sfSocketStatus sfTcpSocket_receive(sfTcpSocket* socket, void*
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfSocketStatus sfTcpSocket_sendPacket(sfTcpSocket* socket, sfPacket* packet);
 
+////////////////////////////////////////////////////////////
+/// \brief Send several formatted packets to the remote peer at once
+///
+/// The packets are framed the same way as by sfTcpSocket_sendPacket,
+/// so that the remote peer receives them one by one with
+/// sfTcpSocket_receivePacket, but they are sent together without
+/// being copied. Packets with a send transform (see
+/// sfPacket_setTransform) are transformed again on each call.
+///
+/// \a sent is both an input and an output: it must point to 0
+/// on the first call, and receives the total number of bytes
+/// sent. If the function returns sfSocketPartial, call it again
+/// with the same unmodified packets and the same \a sent to send
+/// the rest.
+/// This function will fail if the socket is not connected.
+///
+/// \param socket  TCP socket object
+/// \param packets Array of packets to send
+/// \param count   Number of elements in \a packets
+/// \param sent    Number of bytes of the framed packets already sent (can be NULL)
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfTcpSocket_sendPacketsv(sfTcpSocket*           socket,
+                                                          const sfPacket* const* packets,
+                                                          size_t                 count,
+                                                          size_t*                sent);
+
 ////////////////////////////////////////////////////////////
 /// \brief Receive a formatted packet of data from the remote peer
 ///
@@ -25,6 +25,7 @@
 #pragma once
 
 
+typedef struct sfAsyncIo              sfAsyncIo;
 typedef struct sfFtpDirectoryResponse sfFtpDirectoryResponse;
 typedef struct sfFtpListingResponse   sfFtpListingResponse;
 typedef struct sfFtpResponse          sfFtpResponse;
@@ -32,8 +33,14 @@ typedef struct sfFtp                  sfFtp;
 typedef struct sfHttpRequest          sfHttpRequest;
 typedef struct sfHttpResponse         sfHttpResponse;
 typedef struct sfHttp                 sfHttp;
+typedef struct sfHttpClient           sfHttpClient;
+typedef struct sfHttpFuture           sfHttpFuture;
 typedef struct sfPacket               sfPacket;
+typedef struct sfPacketPool           sfPacketPool;
+typedef struct sfReliableUdp          sfReliableUdp;
+typedef struct sfSocketPoller         sfSocketPoller;
 typedef struct sfSocketSelector       sfSocketSelector;
 typedef struct sfTcpListener          sfTcpListener;
 typedef struct sfTcpSocket            sfTcpSocket;
+typedef struct sfUdpFragmenter        sfUdpFragmenter;
 typedef struct sfUdpSocket            sfUdpSocket;
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Export.h>
+
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/SocketStatus.h>
+#include <CSFML/Network/Types.h>
+#include <CSFML/System/Time.h>
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Limits on the messages reassembled by a UDP fragmenter
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t maxMessageSize; ///< Maximum size of a message, in bytes, both sent and received
+    size_t maxPeerMemory;  ///< Maximum memory used by the incomplete messages of a single remote peer, in bytes
+    size_t maxMemory;      ///< Maximum memory used by the incomplete messages of all the remote peers, in bytes
+    sfTime timeout;        ///< Time after which a message still incomplete is discarded
+} sfUdpFragmenterLimits;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a UDP fragmenter over a UDP socket
+///
+/// The fragmenter exchanges messages larger than a datagram
+/// with any number of remote peers, identified by their
+/// address and port. Each message is split into fragments of
+/// at most 1200 bytes, which carry the identifier of the
+/// message, its size and their position in it, and the
+/// fragments received are reassembled into the message.
+///
+/// Nothing is sent again: a message is lost if any of its
+/// fragments is lost. Incomplete messages are discarded after
+/// a timeout, and the memory they use is bounded per remote
+/// peer and in total, so that a peer sending fragments which
+/// never complete can't exhaust the memory (see
+/// sfUdpFragmenter_setLimits).
+///
+/// The socket is used in its current blocking mode. It is not
+/// destroyed with the fragmenter, and it must not be used
+/// directly while the fragmenter exists.
+///
+/// \param socket UDP socket, which must be bound to receive messages
+///
+/// \return A new sfUdpFragmenter object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfUdpFragmenter* sfUdpFragmenter_create(sfUdpSocket* socket);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a UDP fragmenter
+///
+/// Incomplete messages are discarded.
+///
+/// \param fragmenter UDP fragmenter to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfUdpFragmenter_destroy(const sfUdpFragmenter* fragmenter);
+
+////////////////////////////////////////////////////////////
+/// \brief Change the limits of a UDP fragmenter
+///
+/// The default limits are messages of 1 MB, 4 MB per remote
+/// peer, 64 MB in total and a timeout of 2 seconds. When a
+/// new message doesn't fit in the memory of its peer, the
+/// oldest incomplete messages of the peer are discarded to
+/// make room for it; when it doesn't fit in the total memory,
+/// it is ignored, so that a peer can't evict the messages of
+/// the other peers. The memory used by a message is its size
+/// plus a fixed overhead.
+///
+/// \param fragmenter UDP fragmenter object
+/// \param limits     New limits
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfUdpFragmenter_setLimits(sfUdpFragmenter* fragmenter, const sfUdpFragmenterLimits* limits);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the limits of a UDP fragmenter
+///
+/// \param fragmenter UDP fragmenter object
+///
+/// \return Current limits
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfUdpFragmenterLimits sfUdpFragmenter_getLimits(const sfUdpFragmenter* fragmenter);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a message to a remote peer
+///
+/// The message is the data of \a packet, transformed by its
+/// send transform if it has one (see sfPacket_setTransform).
+/// All its fragments are sent at once with
+/// sfUdpSocket_sendBatch. In non-blocking mode, if the socket
+/// can't take all of them, sfSocketPartial is returned and
+/// the message won't be complete on the other side.
+///
+/// \param fragmenter    UDP fragmenter object
+/// \param packet        Packet containing the message
+/// \param remoteAddress Address of the receiver
+/// \param remotePort    Port of the receiver
+///
+/// \return Status code, sfSocketError if the message is larger than the maximum size of the limits
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpFragmenter_send(sfUdpFragmenter*  fragmenter,
+                                                      const sfPacket*   packet,
+                                                      sfIpAddressPacked remoteAddress,
+                                                      unsigned short    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive a message from any remote peer
+///
+/// The fragments available are received and reassembled until
+/// a message is complete. The message becomes the data of
+/// \a packet, restored by its receive transform if it has one.
+/// In blocking mode, this function waits until a message is
+/// complete; in non-blocking mode, it returns sfSocketNotReady
+/// when no message is complete yet.
+///
+/// \param fragmenter    UDP fragmenter object
+/// \param packet        Packet to fill with the message
+/// \param remoteAddress Address of the peer that sent the message (can be NULL)
+/// \param remotePort    Port of the peer that sent the message (can be NULL)
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpFragmenter_receive(sfUdpFragmenter*   fragmenter,
+                                                         sfPacket*          packet,
+                                                         sfIpAddressPacked* remoteAddress,
+                                                         unsigned short*    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the memory used by the incomplete messages of a UDP fragmenter
+///
+/// \param fragmenter UDP fragmenter object
+///
+/// \return Number of bytes counted against the limits
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfUdpFragmenter_getPendingMemory(const sfUdpFragmenter* fragmenter);
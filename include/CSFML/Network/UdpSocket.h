@@ -36,6 +36,20 @@
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief One datagram of a batched UDP send or receive
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    void*             data;          ///< Bytes of the datagram
+    size_t            size;          ///< Number of bytes to send, or capacity of \a data when receiving
+    size_t            received;      ///< Number of bytes received, filled by sfUdpSocket_receiveBatch
+    sfIpAddressPacked remoteAddress; ///< Address of the receiver, or of the sender when receiving
+    unsigned short    remotePort;    ///< Port of the receiver, or of the sender when receiving
+} sfUdpDatagram;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new UDP socket
 ///
@@ -211,6 +225,143 @@ CSFML_NETWORK_API sfSocketStatus
 CSFML_NETWORK_API sfSocketStatus
     sfUdpSocket_receivePacket(sfUdpSocket* socket, sfPacket* packet, sfIpAddress* remoteAddress, unsigned short* remotePort);
 
+////////////////////////////////////////////////////////////
+/// \brief Send raw data to a remote peer given by its packed address
+///
+/// This is the same as sfUdpSocket_send, but the address is
+/// not parsed, which makes it cheaper when sending many
+/// datagrams: convert the address once with sfIpAddress_toPacked,
+/// or reuse the one filled by sfUdpSocket_receiveFrom.
+///
+/// \param socket        UDP socket object
+/// \param data          Pointer to the sequence of bytes to send
+/// \param size          Number of bytes to send
+/// \param remoteAddress Address of the receiver
+/// \param remotePort    Port of the receiver to send the data to
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_sendTo(sfUdpSocket*      socket,
+                                                    const void*       data,
+                                                    size_t            size,
+                                                    sfIpAddressPacked remoteAddress,
+                                                    unsigned short    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive raw data from a remote peer, along with its packed address
+///
+/// This is the same as sfUdpSocket_receive, but the address
+/// of the sender is returned in its packed form.
+///
+/// \param socket        UDP socket object
+/// \param data          Pointer to the array to fill with the received bytes
+/// \param size          Maximum number of bytes that can be received
+/// \param received      This variable is filled with the actual number of bytes received
+/// \param remoteAddress Address of the peer that sent the data
+/// \param remotePort    Port of the peer that sent the data
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_receiveFrom(sfUdpSocket*       socket,
+                                                         void*              data,
+                                                         size_t             size,
+                                                         size_t*            received,
+                                                         sfIpAddressPacked* remoteAddress,
+                                                         unsigned short*    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a formatted packet of data to a remote peer given by its packed address
+///
+/// This is the same as sfUdpSocket_sendPacket, but the
+/// address is not parsed.
+///
+/// \param socket        UDP socket object
+/// \param packet        Packet to send
+/// \param remoteAddress Address of the receiver
+/// \param remotePort    Port of the receiver to send the data to
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_sendPacketTo(sfUdpSocket*      socket,
+                                                          sfPacket*         packet,
+                                                          sfIpAddressPacked remoteAddress,
+                                                          unsigned short    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive a formatted packet of data from a remote peer, along with its packed address
+///
+/// This is the same as sfUdpSocket_receivePacket, but the
+/// address of the sender is returned in its packed form.
+///
+/// \param socket        UDP socket object
+/// \param packet        Packet to fill with the received data
+/// \param remoteAddress Address of the peer that sent the data
+/// \param remotePort    Port of the peer that sent the data
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_receivePacketFrom(sfUdpSocket*       socket,
+                                                               sfPacket*          packet,
+                                                               sfIpAddressPacked* remoteAddress,
+                                                               unsigned short*    remotePort);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive several datagrams at once with a UDP socket
+///
+/// Fills up to \a count datagrams, each into the buffer given
+/// by its \a data and \a size members. On Linux and FreeBSD
+/// the datagrams are received with as few system calls as
+/// possible; on other platforms they are received one by one.
+///
+/// In blocking mode, this function waits until at least one
+/// datagram is received, then returns the ones which are
+/// already available (on platforms without batched system
+/// calls, it returns after the first one).
+/// In non-blocking mode, sfSocketNotReady is returned if
+/// no datagram is available.
+///
+/// \param socket        UDP socket object
+/// \param datagrams     Array of datagrams to fill
+/// \param count         Number of elements in \a datagrams
+/// \param receivedCount This variable is filled with the number of datagrams received
+///
+/// \return Status code, sfSocketDone if at least one datagram was received
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_receiveBatch(sfUdpSocket*   socket,
+                                                          sfUdpDatagram* datagrams,
+                                                          size_t         count,
+                                                          size_t*        receivedCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Send several datagrams at once with a UDP socket
+///
+/// Sends the \a size first bytes of \a data of each datagram
+/// to its remote address and port. On Linux and FreeBSD the
+/// datagrams are sent with as few system calls as possible;
+/// on other platforms they are sent one by one.
+///
+/// Make sure that no datagram is larger than
+/// sfUdpSocket_maxDatagramSize(), otherwise this function
+/// fails and no data is sent.
+///
+/// \param socket    UDP socket object
+/// \param datagrams Array of datagrams to send
+/// \param count     Number of elements in \a datagrams
+/// \param sentCount This variable is filled with the number of datagrams sent
+///
+/// \return Status code, sfSocketPartial if only some of the datagrams were sent
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_sendBatch(sfUdpSocket*         socket,
+                                                       const sfUdpDatagram* datagrams,
+                                                       size_t               count,
+                                                       size_t*              sentCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Return the maximum number of bytes that can be
 ///        sent in a single UDP datagram
@@ -29,17 +29,161 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/System/Export.h>
 
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Function allocating \a size bytes of memory
+///
+/// The returned memory must be suitably aligned for any type,
+/// or NULL on failure.
+///
+////////////////////////////////////////////////////////////
+typedef void* (*sfAllocFunc)(size_t size, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Function resizing a block returned by the matching sfAllocFunc
+///
+////////////////////////////////////////////////////////////
+typedef void* (*sfReallocFunc)(void* ptr, size_t size, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Function releasing a block returned by the matching sfAllocFunc
+///
+////////////////////////////////////////////////////////////
+typedef void (*sfFreeFunc)(void* ptr, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Modules tracked by the allocation counters
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfAllocModuleSystem,   ///< Allocations made by the system module
+    sfAllocModuleWindow,   ///< Allocations made by the window module
+    sfAllocModuleGraphics, ///< Allocations made by the graphics module
+    sfAllocModuleAudio,    ///< Allocations made by the audio module
+    sfAllocModuleNetwork,  ///< Allocations made by the network module
+
+    sfAllocModuleCount ///< Keep last -- the total number of modules
+} sfAllocModule;
+
+////////////////////////////////////////////////////////////
+/// \brief Allocation counters of a module
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    uint64_t allocations;    ///< Number of blocks allocated
+    uint64_t deallocations;  ///< Number of blocks released
+    uint64_t allocatedBytes; ///< Total number of bytes allocated
+    uint64_t currentBytes;   ///< Number of bytes currently allocated
+} sfAllocationStats;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Change the functions used to allocate CSFML memory
+///
+/// The functions are used for every CSFML object returned by
+/// a _create or _copy function, for the contents of sfBuffer
+/// objects and for the strings and arrays that CSFML returns
+/// and the caller must release with sfFree.
+///
+/// \a reallocFunc is optional; when it is NULL, sfRealloc
+/// falls back to \a allocFunc and \a freeFunc. Passing NULL
+/// for \a allocFunc or \a freeFunc restores the C standard
+/// library functions.
+///
+/// This function must be called before anything is allocated
+/// by CSFML, or after everything has been released: memory
+/// must be released by the functions which allocated it.
+/// It is not thread-safe.
+///
+/// Memory allocated internally by SFML is not affected.
+///
+/// With the default functions, the memory returned by CSFML
+/// is allocated by malloc and can still be released with
+/// free; sfFree and sfRealloc also accept memory allocated by
+/// the C standard library. The allocation counters don't see
+/// the blocks released with free.
+///
+/// \param allocFunc   Function allocating memory
+/// \param reallocFunc Function resizing memory, can be NULL
+/// \param freeFunc    Function releasing memory
+/// \param userData    User data passed to the functions
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfSetAllocator(sfAllocFunc   allocFunc,
+                                     sfReallocFunc reallocFunc,
+                                     sfFreeFunc    freeFunc,
+                                     void*         userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Allocates memory
+///
+/// The memory is allocated with the functions given to
+/// sfSetAllocator and must be released with sfFree.
+///
+/// \param size Number of bytes to allocate
+///
+/// \return Pointer to the allocated memory, or NULL on failure
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void* sfMalloc(size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Resizes memory
+///
+/// \a ptr must have been returned by sfMalloc, sfRealloc or
+/// a CSFML function documenting that its result is released
+/// with sfFree, or have been allocated by the C standard
+/// library, in which case it is resized with realloc.
+/// If \a ptr is NULL this behaves like sfMalloc;
+/// if \a size is 0 the memory is released and NULL is returned.
+/// On failure NULL is returned and \a ptr is left untouched.
+///
+/// \param ptr  Pointer to the memory to resize
+/// \param size New size, in bytes
+///
+/// \return Pointer to the resized memory, or NULL
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void* sfRealloc(void* ptr, size_t size);
 
 ////////////////////////////////////////////////////////////
 /// \brief Deallocates memory
 ///
-/// This function deallocates the memory being pointed to
-/// using the free function from the C standard library.
+/// This function deallocates memory returned by sfMalloc,
+/// sfRealloc or a CSFML function documenting that its result
+/// is released with sfFree, using the functions given to
+/// sfSetAllocator.
 ///
-/// The memory must have been previously allocated using a call
-/// to malloc.
+/// Memory which was not allocated by CSFML, such as memory
+/// returned by malloc, is released with free.
 ///
-/// \param ptr Pointer to the memory to deallocate
+/// \param ptr Pointer to the memory to deallocate, can be NULL
 ///
 ////////////////////////////////////////////////////////////
 CSFML_SYSTEM_API void sfFree(void* ptr);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the allocation counters of a module
+///
+/// The counters are updated atomically and can be read
+/// from any thread.
+///
+/// \param module Module to query
+///
+/// \return Allocation counters of \a module
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfAllocationStats sfGetAllocationStats(sfAllocModule module);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the allocation counters of every module
+///
+/// The current number of allocated bytes is kept, since
+/// the memory it counts is still allocated.
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfResetAllocationStats(void);
@@ -29,11 +29,16 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/System/Export.h>
 
+#include <CSFML/System/Alloc.h>
 #include <CSFML/System/Types.h>
 
 #include <stddef.h>
 
 
+typedef sfAllocFunc sfBufferAllocFunc;
+typedef sfFreeFunc  sfBufferFreeFunc;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create an empty buffer
 ///
@@ -42,6 +47,25 @@
 ////////////////////////////////////////////////////////////
 CSFML_SYSTEM_API sfBuffer* sfBuffer_create(void);
 
+////////////////////////////////////////////////////////////
+/// \brief Create an empty buffer using custom memory functions
+///
+/// The contents of the buffer are allocated with \a allocFunc
+/// and released with \a freeFunc, for example to place them
+/// in a memory arena. \a allocFunc must return memory suitably
+/// aligned for any type, or NULL on failure.
+///
+/// \param allocFunc Function allocating memory for the contents of the buffer
+/// \param freeFunc  Function releasing memory returned by \a allocFunc
+/// \param userData  User data passed to both functions
+///
+/// \return A new sfBuffer object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBuffer* sfBuffer_createWithAllocator(sfBufferAllocFunc allocFunc,
+                                                        sfBufferFreeFunc  freeFunc,
+                                                        void*             userData);
+
 ////////////////////////////////////////////////////////////
 /// \brief Destroy an existing buffer
 ///
@@ -69,3 +93,38 @@ CSFML_SYSTEM_API size_t sfBuffer_getSize(const sfBuffer* buffer);
 ///
 ////////////////////////////////////////////////////////////
 CSFML_SYSTEM_API const uint8_t* sfBuffer_getData(const sfBuffer* buffer);
+
+////////////////////////////////////////////////////////////
+/// \brief Preallocate memory for the contents of a buffer
+///
+/// Functions writing to the buffer reuse its memory, so once
+/// enough memory is reserved they no longer allocate.
+///
+/// \param buffer Buffer object
+/// \param size   Number of bytes to allocate memory for
+///
+/// \return true on success, false if the memory couldn't be allocated
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API bool sfBuffer_reserve(sfBuffer* buffer, size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Return the number of bytes a buffer can hold without reallocating
+///
+/// \param buffer Buffer object
+///
+/// \return Capacity in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API size_t sfBuffer_getCapacity(const sfBuffer* buffer);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove the contents of a buffer
+///
+/// The memory of the buffer is not released, so that it
+/// can be reused by the next write.
+///
+/// \param buffer Buffer object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfBuffer_clear(sfBuffer* buffer);
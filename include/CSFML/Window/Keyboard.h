@@ -389,8 +389,8 @@ CSFML_WINDOW_API sfScancode sfKeyboard_delocalize(sfKeyCode key);
 /// interpret the scancode: for example, sfKeySemicolon is
 /// mapped to ";" for layout and to "é" for others.
 ///
-/// The returned const char* owns the string and must be freed to
-/// avoid memory leaks.
+/// The returned const char* owns the string and must be freed with
+/// sfFree to avoid memory leaks.
 ///
 /// \param code Scancode to describe
 ///
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Audio/SoundChannel.h>
 #include <CSFML/CallbackStream.hpp>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Audio/Music.hpp>
 
@@ -38,7 +39,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfMusic
 ////////////////////////////////////////////////////////////
-struct sfMusic : sf::Music
+struct sfMusic : sf::Music, Allocated<sfAllocModuleAudio>
 {
     mutable std::vector<sfSoundChannel> Channels;
     CallbackStream                      Stream;
@@ -72,7 +72,7 @@ const sfSoundBuffer* sfSoundBufferRecorder_getBuffer(const sfSoundBufferRecorder
 {
     assert(soundBufferRecorder);
 
-    soundBufferRecorder->SoundBuffer = sfSoundBuffer{soundBufferRecorder->getBuffer(), {}};
+    soundBufferRecorder->SoundBuffer = sfSoundBuffer{soundBufferRecorder->getBuffer(), {}, {}};
 
     return &soundBufferRecorder->SoundBuffer;
 }
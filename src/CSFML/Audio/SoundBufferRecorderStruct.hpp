@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Audio/SoundBufferStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Audio/SoundBufferRecorder.hpp>
 
@@ -35,7 +36,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundBufferRecorder
 ////////////////////////////////////////////////////////////
-struct sfSoundBufferRecorder : sf::SoundBufferRecorder
+struct sfSoundBufferRecorder : sf::SoundBufferRecorder, Allocated<sfAllocModuleAudio>
 {
     mutable sfSoundBuffer SoundBuffer;
     std::string           DeviceName;
@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Audio/SoundChannel.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Audio/SoundBuffer.hpp>
 
@@ -35,7 +36,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundBuffer
 ////////////////////////////////////////////////////////////
-struct sfSoundBuffer : sf::SoundBuffer
+struct sfSoundBuffer : sf::SoundBuffer, Allocated<sfAllocModuleAudio>
 {
     mutable std::vector<sfSoundChannel> Channels;
 };
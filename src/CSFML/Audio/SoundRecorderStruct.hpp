@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Audio/SoundRecorder.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Audio/SoundRecorder.hpp>
 
@@ -35,7 +36,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundRecorder
 ////////////////////////////////////////////////////////////
-struct sfSoundRecorder : sf::SoundRecorder
+struct sfSoundRecorder : sf::SoundRecorder, Allocated<sfAllocModuleAudio>
 {
 public:
     sfSoundRecorder(sfSoundRecorderStartCallback   onStart,
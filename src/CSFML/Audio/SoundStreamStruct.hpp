@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Audio/SoundChannel.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Audio/SoundStream.hpp>
 
@@ -35,7 +36,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundStream
 ////////////////////////////////////////////////////////////
-struct sfSoundStream : sf::SoundStream
+struct sfSoundStream : sf::SoundStream, Allocated<sfAllocModuleAudio>
 {
 public:
     sfSoundStream(sfSoundStreamGetDataCallback onGetData,
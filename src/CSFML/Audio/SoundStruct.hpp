@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Audio/SoundBufferStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Audio/Sound.hpp>
 
@@ -35,7 +36,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSound
 ////////////////////////////////////////////////////////////
-struct sfSound : sf::Sound
+struct sfSound : sf::Sound, Allocated<sfAllocModuleAudio>
 {
     using sf::Sound::Sound;
     const sfSoundBuffer* Buffer{};
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/TextureStruct.hpp>
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/CircleShape.hpp>
 
@@ -36,7 +37,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfCircleShape
 ////////////////////////////////////////////////////////////
-struct sfCircleShape : sf::CircleShape
+struct sfCircleShape : sf::CircleShape, Allocated<sfAllocModuleGraphics>
 {
     const sfTexture*    Texture{};
     mutable sfTransform Transform{};
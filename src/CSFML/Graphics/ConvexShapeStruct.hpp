@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/TextureStruct.hpp>
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/ConvexShape.hpp>
 
@@ -36,7 +37,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfConvexShape
 ////////////////////////////////////////////////////////////
-struct sfConvexShape : sf::ConvexShape
+struct sfConvexShape : sf::ConvexShape, Allocated<sfAllocModuleGraphics>
 {
     const sfTexture*    Texture{};
     mutable sfTransform Transform{};
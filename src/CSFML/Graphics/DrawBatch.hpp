@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Graphics/Color.h>
+#include <CSFML/Graphics/ConvertColor.hpp>
+#include <CSFML/Graphics/ConvertTransform.hpp>
+#include <CSFML/Graphics/SpriteStruct.hpp>
+#include <CSFML/Graphics/VertexBufferStruct.hpp>
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Draw a list of sprites, merging consecutive sprites that
+// use the same texture into a single triangle list
+////////////////////////////////////////////////////////////
+inline void drawSprites(sf::RenderTarget&        target,
+                        std::vector<sf::Vertex>& batch,
+                        const sfSprite* const*   sprites,
+                        std::size_t              spriteCount,
+                        const sf::RenderStates&  states)
+{
+    sf::RenderStates batchStates = states;
+    batchStates.coordinateType   = sf::CoordinateType::Pixels;
+    batchStates.texture          = nullptr;
+
+    const auto flush = [&]
+    {
+        if (!batch.empty())
+            target.draw(batch.data(), batch.size(), sf::PrimitiveType::Triangles, batchStates);
+        batch.clear();
+    };
+
+    batch.reserve(spriteCount * 6);
+
+    for (std::size_t i = 0; i < spriteCount; ++i)
+    {
+        const sf::Sprite* sprite = sprites[i];
+        if (!sprite)
+            continue;
+
+        // Texture changes break the batch
+        const sf::Texture* texture = &sprite->getTexture();
+        if (texture != batchStates.texture)
+        {
+            flush();
+            batchStates.texture = texture;
+        }
+
+        // Same geometry as sf::Sprite, expanded to two triangles and pre-transformed
+        const auto [position, size] = sf::FloatRect(sprite->getTextureRect());
+        const sf::Vector2f   absSize(std::abs(size.x), std::abs(size.y));
+        const sf::Transform& transform = sprite->getTransform();
+        const sf::Color      color     = sprite->getColor();
+
+        const sf::Vertex quad[4] = {
+            {transform.transformPoint({0.f, 0.f}), color, position},
+            {transform.transformPoint({0.f, absSize.y}), color, position + sf::Vector2f(0.f, size.y)},
+            {transform.transformPoint({absSize.x, 0.f}), color, position + sf::Vector2f(size.x, 0.f)},
+            {transform.transformPoint(absSize), color, position + size},
+        };
+
+        batch.insert(batch.end(), {quad[0], quad[1], quad[2], quad[2], quad[1], quad[3]});
+    }
+
+    flush();
+}
+
+
+////////////////////////////////////////////////////////////
+// Draw a vertex buffer once per instance transform
+////////////////////////////////////////////////////////////
+inline void drawVertexBufferInstanced(sf::RenderTarget&        target,
+                                      std::vector<sf::Vertex>& batch,
+                                      const sfVertexBuffer&    vertexBuffer,
+                                      const sfTransform*       transforms,
+                                      const sfColor*           colors,
+                                      std::size_t              instanceCount,
+                                      const sf::RenderStates&  states)
+{
+    // Small meshes such as tiles are cheaper to expand on the CPU into
+    // a single draw call than to draw with one call per instance
+    constexpr std::size_t maxExpandedVertexCount = 64;
+
+    const sf::PrimitiveType type        = vertexBuffer.getPrimitiveType();
+    const bool              mergeable   = type == sf::PrimitiveType::Points || type == sf::PrimitiveType::Lines ||
+                                          type == sf::PrimitiveType::Triangles;
+    const std::size_t       vertexCount = vertexBuffer.Vertices.size();
+
+    if (!vertexBuffer.LocalCopyEnabled || (!colors && (!mergeable || vertexCount > maxExpandedVertexCount)))
+    {
+        // Reuse the GPU buffer, only the transform changes between draw calls;
+        // without a CPU copy of the vertices, the instance colors can't be applied
+        sf::RenderStates instanceStates = states;
+        for (std::size_t i = 0; i < instanceCount; ++i)
+        {
+            instanceStates.transform = states.transform * convertTransform(transforms[i]);
+            target.draw(vertexBuffer, instanceStates);
+        }
+        return;
+    }
+
+    // Per-instance colors can only be applied to a copy of the vertices
+    batch.clear();
+    batch.reserve(mergeable ? vertexCount * instanceCount : vertexCount);
+
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        const sf::Transform transform = convertTransform(transforms[i]);
+        const sf::Color     color     = colors ? convertColor(colors[i]) : sf::Color::White;
+
+        for (const sf::Vertex& vertex : vertexBuffer.Vertices)
+            batch.push_back({transform.transformPoint(vertex.position), vertex.color * color, vertex.texCoords});
+
+        // Strips and fans can't be concatenated, they need one draw call per instance
+        if (!mergeable)
+        {
+            target.draw(batch.data(), batch.size(), type, states);
+            batch.clear();
+        }
+    }
+
+    if (!batch.empty())
+        target.draw(batch.data(), batch.size(), type, states);
+    batch.clear();
+}
@@ -60,7 +60,7 @@ sfFont* sfFont_createFromStream(sfInputStream* stream)
 {
     assert(stream);
 
-    auto font = std::make_unique<sfFont>(sfFont{{}, {}, {stream}});
+    auto font = std::make_unique<sfFont>(sfFont{{}, {}, {}, {stream}});
     if (!font->openFromStream(font->Stream))
         return nullptr;
 
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/CallbackStream.hpp>
 #include <CSFML/Graphics/TextureStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/Font.hpp>
 
@@ -38,7 +39,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFont
 ////////////////////////////////////////////////////////////
-struct sfFont : sf::Font
+struct sfFont : sf::Font, Allocated<sfAllocModuleGraphics>
 {
     std::map<unsigned int, sfTexture> Textures;
     CallbackStream                    Stream;
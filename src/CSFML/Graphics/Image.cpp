@@ -37,21 +37,21 @@
 ////////////////////////////////////////////////////////////
 sfImage* sfImage_create(sfVector2u size)
 {
-    return new sfImage{sf::Image(convertVector2(size))};
+    return new sfImage{sf::Image(convertVector2(size)), {}};
 }
 
 
 ////////////////////////////////////////////////////////////
 sfImage* sfImage_createFromColor(sfVector2u size, sfColor color)
 {
-    return new sfImage{sf::Image(convertVector2(size), convertColor(color))};
+    return new sfImage{sf::Image(convertVector2(size), convertColor(color)), {}};
 }
 
 
 ////////////////////////////////////////////////////////////
 sfImage* sfImage_createFromPixels(sfVector2u size, const uint8_t* data)
 {
-    return new sfImage{sf::Image(convertVector2(size), data)};
+    return new sfImage{sf::Image(convertVector2(size), data), {}};
 }
 
 
@@ -126,8 +126,16 @@ bool sfImage_saveToMemory(const sfImage* image, sfBuffer* output, const char* fo
 
     if (auto data = image->saveToMemory(format))
     {
-        *output = sfBuffer{std::move(*data)};
-        return true;
+        // Copy into the existing storage to keep the allocator and capacity of the buffer
+        try
+        {
+            output->assign(data->begin(), data->end());
+            return true;
+        }
+        catch (const std::bad_alloc&)
+        {
+            output->clear();
+        }
     }
 
     return false;
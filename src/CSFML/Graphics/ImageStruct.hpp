@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Graphics/Image.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfImage
 ////////////////////////////////////////////////////////////
-struct sfImage : sf::Image
+struct sfImage : sf::Image, Allocated<sfAllocModuleGraphics>
 {
 };
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/TextureStruct.hpp>
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -36,7 +37,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfRectangleShape
 ////////////////////////////////////////////////////////////
-struct sfRectangleShape : sf::RectangleShape
+struct sfRectangleShape : sf::RectangleShape, Allocated<sfAllocModuleGraphics>
 {
     const sfTexture*    Texture{};
     mutable sfTransform Transform{};
@@ -25,7 +25,9 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/Graphics/ConvertRenderStates.hpp>
 #include <CSFML/Graphics/RenderStates.h>
+#include <CSFML/Graphics/RenderStatesHandleStruct.hpp>
 
 
 ////////////////////////////////////////////////////////////
@@ -37,3 +39,25 @@ const sfRenderStates sfRenderStates_default = {
     nullptr,
     nullptr,
 };
+
+
+////////////////////////////////////////////////////////////
+sfRenderStatesHandle* sfRenderStatesHandle_create(const sfRenderStates* states)
+{
+    return new sfRenderStatesHandle{{}, convertRenderStates(states)};
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderStatesHandle_destroy(const sfRenderStatesHandle* handle)
+{
+    delete handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderStatesHandle_update(sfRenderStatesHandle* handle, const sfRenderStates* states)
+{
+    assert(handle);
+    handle->This = convertRenderStates(states);
+}
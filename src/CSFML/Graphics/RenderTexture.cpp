@@ -31,7 +31,9 @@
 #include <CSFML/Graphics/ConvertRenderStates.hpp>
 #include <CSFML/Graphics/ConvertStencil.hpp>
 #include <CSFML/Graphics/ConvexShapeStruct.hpp>
+#include <CSFML/Graphics/DrawBatch.hpp>
 #include <CSFML/Graphics/RectangleShapeStruct.hpp>
+#include <CSFML/Graphics/RenderStatesHandleStruct.hpp>
 #include <CSFML/Graphics/RenderTexture.h>
 #include <CSFML/Graphics/RenderTextureStruct.hpp>
 #include <CSFML/Graphics/ShapeStruct.hpp>
@@ -55,8 +57,8 @@ sfRenderTexture* sfRenderTexture_create(sfVector2u size, const sfContextSettings
         return nullptr;
 
     renderTexture->Target      = std::make_unique<sfTexture>(const_cast<sf::Texture*>(&renderTexture->getTexture()));
-    renderTexture->DefaultView = sfView{renderTexture->getDefaultView()};
-    renderTexture->CurrentView = sfView{renderTexture->getView()};
+    renderTexture->DefaultView = sfView{renderTexture->getDefaultView(), {}};
+    renderTexture->CurrentView = sfView{renderTexture->getView(), {}};
 
     return renderTexture.release();
 }
@@ -244,6 +246,18 @@ void sfRenderTexture_drawVertexBuffer(sfRenderTexture* renderTexture, const sfVe
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawSprites(sfRenderTexture*       renderTexture,
+                                 const sfSprite* const* sprites,
+                                 size_t                 spriteCount,
+                                 const sfRenderStates*  states)
+{
+    assert(renderTexture);
+    assert(sprites || spriteCount == 0);
+    drawSprites(*renderTexture, renderTexture->VertexBatch, sprites, spriteCount, convertRenderStates(states));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_drawVertexBufferRange(sfRenderTexture*      renderTexture,
                                            const sfVertexBuffer* object,
@@ -257,6 +271,27 @@ void sfRenderTexture_drawVertexBufferRange(sfRenderTexture*      renderTexture,
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawVertexBufferInstanced(sfRenderTexture*      renderTexture,
+                                               const sfVertexBuffer* object,
+                                               const sfTransform*    transforms,
+                                               const sfColor*        colors,
+                                               size_t                instanceCount,
+                                               const sfRenderStates* states)
+{
+    assert(renderTexture);
+    assert(object);
+    assert(transforms || instanceCount == 0);
+    drawVertexBufferInstanced(*renderTexture,
+                              renderTexture->VertexBatch,
+                              *object,
+                              transforms,
+                              colors,
+                              instanceCount,
+                              convertRenderStates(states));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_drawPrimitives(sfRenderTexture*      renderTexture,
                                     const sfVertex*       vertices,
@@ -272,6 +307,113 @@ void sfRenderTexture_drawPrimitives(sfRenderTexture*      renderTexture,
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawSpriteWithHandle(sfRenderTexture*            renderTexture,
+                                          const sfSprite*             object,
+                                          const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawTextWithHandle(sfRenderTexture*            renderTexture,
+                                        const sfText*               object,
+                                        const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawShapeWithHandle(sfRenderTexture*            renderTexture,
+                                         const sfShape*              object,
+                                         const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawCircleShapeWithHandle(sfRenderTexture*            renderTexture,
+                                               const sfCircleShape*        object,
+                                               const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawConvexShapeWithHandle(sfRenderTexture*            renderTexture,
+                                               const sfConvexShape*        object,
+                                               const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawRectangleShapeWithHandle(sfRenderTexture*            renderTexture,
+                                                  const sfRectangleShape*     object,
+                                                  const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawVertexArrayWithHandle(sfRenderTexture*            renderTexture,
+                                               const sfVertexArray*        object,
+                                               const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+void sfRenderTexture_drawVertexBufferWithHandle(sfRenderTexture*            renderTexture,
+                                                const sfVertexBuffer*       object,
+                                                const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, getRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawVertexBufferRangeWithHandle(sfRenderTexture*            renderTexture,
+                                                     const sfVertexBuffer*       object,
+                                                     size_t                      firstVertex,
+                                                     size_t                      vertexCount,
+                                                     const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(object);
+    renderTexture->draw(*object, firstVertex, vertexCount, getRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawPrimitivesWithHandle(sfRenderTexture*            renderTexture,
+                                              const sfVertex*             vertices,
+                                              size_t                      vertexCount,
+                                              sfPrimitiveType             type,
+                                              const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    renderTexture->draw(reinterpret_cast<const sf::Vertex*>(vertices),
+                        vertexCount,
+                        static_cast<sf::PrimitiveType>(type),
+                        getRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawSpritesWithHandle(sfRenderTexture*            renderTexture,
+                                           const sfSprite* const*      sprites,
+                                           size_t                      spriteCount,
+                                           const sfRenderStatesHandle* states)
+{
+    assert(renderTexture);
+    assert(sprites || spriteCount == 0);
+    drawSprites(*renderTexture, renderTexture->VertexBatch, sprites, spriteCount, getRenderStates(states));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_pushGLStates(sfRenderTexture* renderTexture)
 {
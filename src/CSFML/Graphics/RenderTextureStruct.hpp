@@ -29,18 +29,22 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/TextureStruct.hpp>
 #include <CSFML/Graphics/ViewStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 #include <memory>
+#include <vector>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfRenderTexture
 ////////////////////////////////////////////////////////////
-struct sfRenderTexture : sf::RenderTexture
+struct sfRenderTexture : sf::RenderTexture, Allocated<sfAllocModuleGraphics>
 {
     std::unique_ptr<const sfTexture> Target;
     sfView                           DefaultView;
     sfView                           CurrentView;
+    std::vector<sf::Vertex>          VertexBatch;
 };
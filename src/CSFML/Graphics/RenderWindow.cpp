@@ -31,8 +31,10 @@
 #include <CSFML/Graphics/ConvertRenderStates.hpp>
 #include <CSFML/Graphics/ConvertStencil.hpp>
 #include <CSFML/Graphics/ConvexShapeStruct.hpp>
+#include <CSFML/Graphics/DrawBatch.hpp>
 #include <CSFML/Graphics/ImageStruct.hpp>
 #include <CSFML/Graphics/RectangleShapeStruct.hpp>
+#include <CSFML/Graphics/RenderStatesHandleStruct.hpp>
 #include <CSFML/Graphics/RenderWindow.h>
 #include <CSFML/Graphics/RenderWindowStruct.hpp>
 #include <CSFML/Graphics/ShapeStruct.hpp>
@@ -62,8 +64,8 @@ sfRenderWindow* sfRenderWindow_create(sfVideoMode              mode,
     // Create the window
     auto* renderWindow = new sfRenderWindow;
     renderWindow->create(convertVideoMode(mode), title, style, static_cast<sf::State>(state), params);
-    renderWindow->DefaultView = sfView{renderWindow->getDefaultView()};
-    renderWindow->CurrentView = sfView{renderWindow->getView()};
+    renderWindow->DefaultView = sfView{renderWindow->getDefaultView(), {}};
+    renderWindow->CurrentView = sfView{renderWindow->getView(), {}};
 
     return renderWindow;
 }
@@ -86,8 +88,8 @@ sfRenderWindow* sfRenderWindow_createUnicode(
                          style,
                          static_cast<sf::State>(state),
                          params);
-    renderWindow->DefaultView = sfView{renderWindow->getDefaultView()};
-    renderWindow->CurrentView = sfView{renderWindow->getView()};
+    renderWindow->DefaultView = sfView{renderWindow->getDefaultView(), {}};
+    renderWindow->CurrentView = sfView{renderWindow->getView(), {}};
 
     return renderWindow;
 }
@@ -102,8 +104,8 @@ sfRenderWindow* sfRenderWindow_createFromHandle(sfWindowHandle handle, const sfC
     // Create the window
     auto* renderWindow = new sfRenderWindow;
     renderWindow->create(handle, params);
-    renderWindow->DefaultView = sfView{renderWindow->getDefaultView()};
-    renderWindow->CurrentView = sfView{renderWindow->getView()};
+    renderWindow->DefaultView = sfView{renderWindow->getDefaultView(), {}};
+    renderWindow->CurrentView = sfView{renderWindow->getView(), {}};
 
     return renderWindow;
 }
@@ -502,6 +504,18 @@ void sfRenderWindow_drawVertexBuffer(sfRenderWindow* renderWindow, const sfVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawSprites(sfRenderWindow*        renderWindow,
+                                const sfSprite* const* sprites,
+                                size_t                 spriteCount,
+                                const sfRenderStates*  states)
+{
+    assert(renderWindow);
+    assert(sprites || spriteCount == 0);
+    drawSprites(*renderWindow, renderWindow->VertexBatch, sprites, spriteCount, convertRenderStates(states));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_drawVertexBufferRange(sfRenderWindow*       renderWindow,
                                           const sfVertexBuffer* object,
@@ -515,6 +529,27 @@ void sfRenderWindow_drawVertexBufferRange(sfRenderWindow*       renderWindow,
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawVertexBufferInstanced(sfRenderWindow*       renderWindow,
+                                              const sfVertexBuffer* object,
+                                              const sfTransform*    transforms,
+                                              const sfColor*        colors,
+                                              size_t                instanceCount,
+                                              const sfRenderStates* states)
+{
+    assert(renderWindow);
+    assert(object);
+    assert(transforms || instanceCount == 0);
+    drawVertexBufferInstanced(*renderWindow,
+                              renderWindow->VertexBatch,
+                              *object,
+                              transforms,
+                              colors,
+                              instanceCount,
+                              convertRenderStates(states));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_drawPrimitives(sfRenderWindow*       renderWindow,
                                    const sfVertex*       vertices,
@@ -530,6 +565,113 @@ void sfRenderWindow_drawPrimitives(sfRenderWindow*       renderWindow,
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawSpriteWithHandle(sfRenderWindow*             renderWindow,
+                                         const sfSprite*             object,
+                                         const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawTextWithHandle(sfRenderWindow*             renderWindow,
+                                       const sfText*               object,
+                                       const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawShapeWithHandle(sfRenderWindow*             renderWindow,
+                                        const sfShape*              object,
+                                        const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawCircleShapeWithHandle(sfRenderWindow*             renderWindow,
+                                              const sfCircleShape*        object,
+                                              const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawConvexShapeWithHandle(sfRenderWindow*             renderWindow,
+                                              const sfConvexShape*        object,
+                                              const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawRectangleShapeWithHandle(sfRenderWindow*             renderWindow,
+                                                 const sfRectangleShape*     object,
+                                                 const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawVertexArrayWithHandle(sfRenderWindow*             renderWindow,
+                                              const sfVertexArray*        object,
+                                              const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+void sfRenderWindow_drawVertexBufferWithHandle(sfRenderWindow*             renderWindow,
+                                               const sfVertexBuffer*       object,
+                                               const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, getRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawVertexBufferRangeWithHandle(sfRenderWindow*             renderWindow,
+                                                    const sfVertexBuffer*       object,
+                                                    size_t                      firstVertex,
+                                                    size_t                      vertexCount,
+                                                    const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(object);
+    renderWindow->draw(*object, firstVertex, vertexCount, getRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawPrimitivesWithHandle(sfRenderWindow*             renderWindow,
+                                             const sfVertex*             vertices,
+                                             size_t                      vertexCount,
+                                             sfPrimitiveType             type,
+                                             const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    renderWindow->draw(reinterpret_cast<const sf::Vertex*>(vertices),
+                       vertexCount,
+                       static_cast<sf::PrimitiveType>(type),
+                       getRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawSpritesWithHandle(sfRenderWindow*             renderWindow,
+                                          const sfSprite* const*      sprites,
+                                          size_t                      spriteCount,
+                                          const sfRenderStatesHandle* states)
+{
+    assert(renderWindow);
+    assert(sprites || spriteCount == 0);
+    drawSprites(*renderWindow, renderWindow->VertexBatch, sprites, spriteCount, getRenderStates(states));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_pushGLStates(sfRenderWindow* renderWindow)
 {
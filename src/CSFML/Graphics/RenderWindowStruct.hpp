@@ -28,15 +28,20 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/ViewStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfRenderWindow
 ////////////////////////////////////////////////////////////
-struct sfRenderWindow : sf::RenderWindow
+struct sfRenderWindow : sf::RenderWindow, Allocated<sfAllocModuleGraphics>
 {
-    sfView DefaultView;
-    sfView CurrentView;
+    sfView                  DefaultView;
+    sfView                  CurrentView;
+    std::vector<sf::Vertex> VertexBatch;
 };
@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Graphics/Shader.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfShader
 ////////////////////////////////////////////////////////////
-struct sfShader : sf::Shader
+struct sfShader : sf::Shader, Allocated<sfAllocModuleGraphics>
 {
 };
@@ -54,6 +54,8 @@ void sfShape_setPosition(sfShape* shape, sfVector2f position)
 {
     assert(shape);
     shape->setPosition(convertVector2(position));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -62,6 +64,8 @@ void sfShape_setRotation(sfShape* shape, float angle)
 {
     assert(shape);
     shape->setRotation(sf::degrees(angle));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -70,6 +74,8 @@ void sfShape_setScale(sfShape* shape, sfVector2f scale)
 {
     assert(shape);
     shape->setScale(convertVector2(scale));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -78,6 +84,8 @@ void sfShape_setOrigin(sfShape* shape, sfVector2f origin)
 {
     assert(shape);
     shape->setOrigin(convertVector2(origin));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -118,6 +126,8 @@ void sfShape_move(sfShape* shape, sfVector2f offset)
 {
     assert(shape);
     shape->move(convertVector2(offset));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -126,6 +136,8 @@ void sfShape_rotate(sfShape* shape, float angle)
 {
     assert(shape);
     shape->rotate(sf::degrees(angle));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -134,6 +146,8 @@ void sfShape_scale(sfShape* shape, sfVector2f factors)
 {
     assert(shape);
     shape->scale(convertVector2(factors));
+    shape->TransformNeedUpdate        = true;
+    shape->InverseTransformNeedUpdate = true;
 }
 
 
@@ -141,7 +155,11 @@ void sfShape_scale(sfShape* shape, sfVector2f factors)
 sfTransform sfShape_getTransform(const sfShape* shape)
 {
     assert(shape);
-    shape->Transform = convertTransform(shape->getTransform());
+    if (shape->TransformNeedUpdate)
+    {
+        shape->Transform           = convertTransform(shape->getTransform());
+        shape->TransformNeedUpdate = false;
+    }
     return shape->Transform;
 }
 
@@ -150,7 +168,11 @@ sfTransform sfShape_getTransform(const sfShape* shape)
 sfTransform sfShape_getInverseTransform(const sfShape* shape)
 {
     assert(shape);
-    shape->InverseTransform = convertTransform(shape->getInverseTransform());
+    if (shape->InverseTransformNeedUpdate)
+    {
+        shape->InverseTransform           = convertTransform(shape->getInverseTransform());
+        shape->InverseTransformNeedUpdate = false;
+    }
     return shape->InverseTransform;
 }
 
@@ -30,6 +30,7 @@
 #include <CSFML/Graphics/Shape.h>
 #include <CSFML/Graphics/TextureStruct.hpp>
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 #include <CSFML/System/ConvertVector2.hpp>
 
 #include <SFML/Graphics/Shape.hpp>
@@ -38,7 +39,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfShape
 ////////////////////////////////////////////////////////////
-struct sfShape : sf::Shape
+struct sfShape : sf::Shape, Allocated<sfAllocModuleGraphics>
 {
     sfShape(sfShapeGetPointCountCallback getPointCount, sfShapeGetPointCallback getPoint, void* userData) :
     myGetPointCountCallback(getPointCount),
@@ -65,4 +66,6 @@ struct sfShape : sf::Shape
     const sfTexture*             Texture{};
     mutable sfTransform          Transform{};
     mutable sfTransform          InverseTransform{};
+    mutable bool                 TransformNeedUpdate{true};
+    mutable bool                 InverseTransformNeedUpdate{true};
 };
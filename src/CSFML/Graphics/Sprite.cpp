@@ -67,6 +67,8 @@ void sfSprite_setPosition(sfSprite* sprite, sfVector2f position)
 {
     assert(sprite);
     sprite->setPosition(convertVector2(position));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -75,6 +77,8 @@ void sfSprite_setRotation(sfSprite* sprite, float angle)
 {
     assert(sprite);
     sprite->setRotation(sf::degrees(angle));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -83,6 +87,8 @@ void sfSprite_setScale(sfSprite* sprite, sfVector2f scale)
 {
     assert(sprite);
     sprite->setScale(convertVector2(scale));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -91,6 +97,8 @@ void sfSprite_setOrigin(sfSprite* sprite, sfVector2f origin)
 {
     assert(sprite);
     sprite->setOrigin(convertVector2(origin));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -131,6 +139,8 @@ void sfSprite_move(sfSprite* sprite, sfVector2f offset)
 {
     assert(sprite);
     sprite->move(convertVector2(offset));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -139,6 +149,8 @@ void sfSprite_rotate(sfSprite* sprite, float angle)
 {
     assert(sprite);
     sprite->rotate(sf::degrees(angle));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -147,6 +159,8 @@ void sfSprite_scale(sfSprite* sprite, sfVector2f factors)
 {
     assert(sprite);
     sprite->scale(convertVector2(factors));
+    sprite->TransformNeedUpdate        = true;
+    sprite->InverseTransformNeedUpdate = true;
 }
 
 
@@ -154,7 +168,11 @@ void sfSprite_scale(sfSprite* sprite, sfVector2f factors)
 sfTransform sfSprite_getTransform(const sfSprite* sprite)
 {
     assert(sprite);
-    sprite->Transform = convertTransform(sprite->getTransform());
+    if (sprite->TransformNeedUpdate)
+    {
+        sprite->Transform           = convertTransform(sprite->getTransform());
+        sprite->TransformNeedUpdate = false;
+    }
     return sprite->Transform;
 }
 
@@ -163,11 +181,29 @@ sfTransform sfSprite_getTransform(const sfSprite* sprite)
 sfTransform sfSprite_getInverseTransform(const sfSprite* sprite)
 {
     assert(sprite);
-    sprite->InverseTransform = convertTransform(sprite->getInverseTransform());
+    if (sprite->InverseTransformNeedUpdate)
+    {
+        sprite->InverseTransform           = convertTransform(sprite->getInverseTransform());
+        sprite->InverseTransformNeedUpdate = false;
+    }
     return sprite->InverseTransform;
 }
 
 
+////////////////////////////////////////////////////////////
+void sfSprite_getTransforms(const sfSprite* const* sprites, size_t spriteCount, sfTransform* transforms)
+{
+    assert(sprites || spriteCount == 0);
+    assert(transforms || spriteCount == 0);
+
+    for (std::size_t i = 0; i < spriteCount; ++i)
+    {
+        assert(sprites[i]);
+        transforms[i] = sfSprite_getTransform(sprites[i]);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfSprite_setTexture(sfSprite* sprite, const sfTexture* texture, bool resetRect)
 {
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/TextureStruct.hpp>
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/Sprite.hpp>
 
@@ -36,10 +37,12 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSprite
 ////////////////////////////////////////////////////////////
-struct sfSprite : sf::Sprite
+struct sfSprite : sf::Sprite, Allocated<sfAllocModuleGraphics>
 {
     using sf::Sprite::Sprite;
     const sfTexture*    Texture{};
     mutable sfTransform Transform{};
     mutable sfTransform InverseTransform{};
+    mutable bool        TransformNeedUpdate{true};
+    mutable bool        InverseTransformNeedUpdate{true};
 };
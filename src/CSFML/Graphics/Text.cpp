@@ -66,6 +66,8 @@ void sfText_setPosition(sfText* text, sfVector2f position)
 {
     assert(text);
     text->setPosition(convertVector2(position));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -74,6 +76,8 @@ void sfText_setRotation(sfText* text, float angle)
 {
     assert(text);
     text->setRotation(sf::degrees(angle));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -82,6 +86,8 @@ void sfText_setScale(sfText* text, sfVector2f scale)
 {
     assert(text);
     text->setScale(convertVector2(scale));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -90,6 +96,8 @@ void sfText_setOrigin(sfText* text, sfVector2f origin)
 {
     assert(text);
     text->setOrigin(convertVector2(origin));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -130,6 +138,8 @@ void sfText_move(sfText* text, sfVector2f offset)
 {
     assert(text);
     text->move(convertVector2(offset));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -138,6 +148,8 @@ void sfText_rotate(sfText* text, float angle)
 {
     assert(text);
     text->rotate(sf::degrees(angle));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -146,6 +158,8 @@ void sfText_scale(sfText* text, sfVector2f factors)
 {
     assert(text);
     text->scale(convertVector2(factors));
+    text->TransformNeedUpdate        = true;
+    text->InverseTransformNeedUpdate = true;
 }
 
 
@@ -153,7 +167,11 @@ void sfText_scale(sfText* text, sfVector2f factors)
 sfTransform sfText_getTransform(const sfText* text)
 {
     assert(text);
-    text->Transform = convertTransform(text->getTransform());
+    if (text->TransformNeedUpdate)
+    {
+        text->Transform           = convertTransform(text->getTransform());
+        text->TransformNeedUpdate = false;
+    }
     return text->Transform;
 }
 
@@ -162,7 +180,11 @@ sfTransform sfText_getTransform(const sfText* text)
 sfTransform sfText_getInverseTransform(const sfText* text)
 {
     assert(text);
-    text->InverseTransform = convertTransform(text->getInverseTransform());
+    if (text->InverseTransformNeedUpdate)
+    {
+        text->InverseTransform           = convertTransform(text->getInverseTransform());
+        text->InverseTransformNeedUpdate = false;
+    }
     return text->InverseTransform;
 }
 
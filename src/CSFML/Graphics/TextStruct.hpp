@@ -30,6 +30,7 @@
 #include <CSFML/Graphics/FontStruct.hpp>
 #include <CSFML/Graphics/Rect.h>
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/Text.hpp>
 
@@ -39,11 +40,13 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfText
 ////////////////////////////////////////////////////////////
-struct sfText : sf::Text
+struct sfText : sf::Text, Allocated<sfAllocModuleGraphics>
 {
     using sf::Text::Text;
     const sfFont*       Font{};
     mutable std::string String;
     mutable sfTransform Transform{};
     mutable sfTransform InverseTransform{};
+    mutable bool        TransformNeedUpdate{true};
+    mutable bool        InverseTransformNeedUpdate{true};
 };
@@ -201,7 +201,7 @@ sfImage* sfTexture_copyToImage(const sfTexture* texture)
 {
     assert(texture);
     assert(texture->This);
-    return new sfImage{texture->This->copyToImage()};
+    return new sfImage{texture->This->copyToImage(), {}};
 }
 
 
@@ -27,13 +27,15 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Graphics/Texture.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTexture
 ////////////////////////////////////////////////////////////
-struct sfTexture
+struct sfTexture : Allocated<sfAllocModuleGraphics>
 {
     sfTexture() = default;
 
@@ -41,7 +43,9 @@ struct sfTexture
     {
     }
 
-    sfTexture(const sfTexture& texture) : This(texture.This ? new sf::Texture(*texture.This) : nullptr)
+    sfTexture(const sfTexture& texture) :
+    Allocated(texture),
+    This(texture.This ? new sf::Texture(*texture.This) : nullptr)
     {
     }
 
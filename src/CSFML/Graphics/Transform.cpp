@@ -28,13 +28,86 @@
 #include <CSFML/Graphics/ConvertRect.hpp>
 #include <CSFML/Graphics/ConvertTransform.hpp>
 #include <CSFML/Graphics/Transform.h>
-#include <CSFML/System/ConvertVector2.hpp>
 
 #include <SFML/Graphics/Transform.hpp>
 
+#include <cmath>
 #include <cstring>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Transform a point directly from the 3x3 matrix; like
+// sf::Transform, the projective row of the matrix is ignored
+////////////////////////////////////////////////////////////
+struct AffineTransform
+{
+    explicit AffineTransform(const sfTransform& transform) :
+    a00(transform.matrix[0]),
+    a01(transform.matrix[1]),
+    a02(transform.matrix[2]),
+    a10(transform.matrix[3]),
+    a11(transform.matrix[4]),
+    a12(transform.matrix[5])
+    {
+    }
+
+    [[nodiscard]] sfVector2f operator()(sfVector2f point) const
+    {
+        return {a00 * point.x + a01 * point.y + a02, a10 * point.x + a11 * point.y + a12};
+    }
+
+    float a00, a01, a02;
+    float a10, a11, a12;
+};
+
+
+////////////////////////////////////////////////////////////
+// Compute left * right with 3x3 matrices, in the same order
+// of operations as sf::Transform::combine
+////////////////////////////////////////////////////////////
+[[nodiscard]] sfTransform multiply(const sfTransform& left, const sfTransform& right)
+{
+    const float* a = left.matrix;
+    const float* b = right.matrix;
+
+    // clang-format off
+    return {a[0] * b[0] + a[1] * b[3] + a[2] * b[6],
+            a[0] * b[1] + a[1] * b[4] + a[2] * b[7],
+            a[0] * b[2] + a[1] * b[5] + a[2] * b[8],
+            a[3] * b[0] + a[4] * b[3] + a[5] * b[6],
+            a[3] * b[1] + a[4] * b[4] + a[5] * b[7],
+            a[3] * b[2] + a[4] * b[5] + a[5] * b[8],
+            a[6] * b[0] + a[7] * b[3] + a[8] * b[6],
+            a[6] * b[1] + a[7] * b[4] + a[8] * b[7],
+            a[6] * b[2] + a[7] * b[5] + a[8] * b[8]};
+    // clang-format on
+}
+
+
+////////////////////////////////////////////////////////////
+// Combine a transform with the affine matrix
+// | b00 b01 b02 |
+// | b10 b11 b12 |
+// |  0   0   1  |
+// skipping the products by the constant last row
+////////////////////////////////////////////////////////////
+void combineAffine(sfTransform& transform, float b00, float b01, float b02, float b10, float b11, float b12)
+{
+    float* a = transform.matrix;
+    for (int row = 0; row < 9; row += 3)
+    {
+        const float a0 = a[row];
+        const float a1 = a[row + 1];
+        a[row]         = a0 * b00 + a1 * b10;
+        a[row + 1]     = a0 * b01 + a1 * b11;
+        a[row + 2]     = a0 * b02 + a1 * b12 + a[row + 2];
+    }
+}
+} // namespace
+
+
 ////////////////////////////////////////////////////////////
 const sfTransform sfTransform_Identity = {
     // clang-format off
@@ -80,7 +153,36 @@ sfTransform sfTransform_getInverse(const sfTransform* transform)
 sfVector2f sfTransform_transformPoint(const sfTransform* transform, sfVector2f point)
 {
     assert(transform);
-    return convertVector2(convertTransform(*transform).transformPoint(convertVector2(point)));
+    return AffineTransform(*transform)(point);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransform_transformPoints(const sfTransform* transform,
+                                 const sfVector2f*  points,
+                                 sfVector2f*        transformedPoints,
+                                 size_t             count)
+{
+    assert(transform);
+    assert((points && transformedPoints) || count == 0);
+
+    // The coefficients are loaded once and the loop body has no
+    // branch, which lets the compiler vectorize it
+    const AffineTransform apply(*transform);
+    for (std::size_t i = 0; i < count; ++i)
+        transformedPoints[i] = apply(points[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransform_transformVertices(const sfTransform* transform, sfVertex* vertices, size_t vertexCount)
+{
+    assert(transform);
+    assert(vertices || vertexCount == 0);
+
+    const AffineTransform apply(*transform);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+        vertices[i].position = apply(vertices[i].position);
 }
 
 
@@ -97,7 +199,23 @@ void sfTransform_combine(sfTransform* transform, const sfTransform* other)
 {
     assert(transform);
     assert(other);
-    *transform = convertTransform(convertTransform(*transform).combine(convertTransform(*other)));
+    *transform = multiply(*transform, *other);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransform_combineMany(const sfTransform* transform,
+                             const sfTransform* others,
+                             sfTransform*       results,
+                             size_t             count)
+{
+    assert(transform);
+    assert((others && results) || count == 0);
+
+    // Copy the left operand, results may alias it
+    const sfTransform left = *transform;
+    for (std::size_t i = 0; i < count; ++i)
+        results[i] = multiply(left, others[i]);
 }
 
 
@@ -105,7 +223,7 @@ void sfTransform_combine(sfTransform* transform, const sfTransform* other)
 void sfTransform_translate(sfTransform* transform, sfVector2f offset)
 {
     assert(transform);
-    *transform = convertTransform(convertTransform(*transform).translate(convertVector2(offset)));
+    combineAffine(*transform, 1, 0, offset.x, 0, 1, offset.y);
 }
 
 
@@ -113,7 +231,10 @@ void sfTransform_translate(sfTransform* transform, sfVector2f offset)
 void sfTransform_rotate(sfTransform* transform, float angle)
 {
     assert(transform);
-    *transform = convertTransform(convertTransform(*transform).rotate(sf::degrees(angle)));
+    const float radians = sf::degrees(angle).asRadians();
+    const float cos     = std::cos(radians);
+    const float sin     = std::sin(radians);
+    combineAffine(*transform, cos, -sin, 0, sin, cos, 0);
 }
 
 
@@ -121,7 +242,16 @@ void sfTransform_rotate(sfTransform* transform, float angle)
 void sfTransform_rotateWithCenter(sfTransform* transform, float angle, sfVector2f center)
 {
     assert(transform);
-    *transform = convertTransform(convertTransform(*transform).rotate(sf::degrees(angle), convertVector2(center)));
+    const float radians = sf::degrees(angle).asRadians();
+    const float cos     = std::cos(radians);
+    const float sin     = std::sin(radians);
+    combineAffine(*transform,
+                  cos,
+                  -sin,
+                  center.x * (1 - cos) + center.y * sin,
+                  sin,
+                  cos,
+                  center.y * (1 - cos) - center.x * sin);
 }
 
 
@@ -129,7 +259,7 @@ void sfTransform_rotateWithCenter(sfTransform* transform, float angle, sfVector2
 void sfTransform_scale(sfTransform* transform, sfVector2f scale)
 {
     assert(transform);
-    *transform = convertTransform(convertTransform(*transform).scale(convertVector2(scale)));
+    combineAffine(*transform, scale.x, 0, 0, 0, scale.y, 0);
 }
 
 
@@ -137,7 +267,7 @@ void sfTransform_scale(sfTransform* transform, sfVector2f scale)
 void sfTransform_scaleWithCenter(sfTransform* transform, sfVector2f scale, sfVector2f center)
 {
     assert(transform);
-    *transform = convertTransform(convertTransform(*transform).scale(convertVector2(scale), convertVector2(center)));
+    combineAffine(*transform, scale.x, 0, center.x * (1 - scale.x), 0, scale.y, center.y * (1 - scale.y));
 }
 
 
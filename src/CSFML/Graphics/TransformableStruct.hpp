@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Graphics/Transform.h>
+#include <CSFML/System/Allocated.hpp>
 
 #include <SFML/Graphics/Transformable.hpp>
 
@@ -35,7 +36,7 @@
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTransformable
 ////////////////////////////////////////////////////////////
-struct sfTransformable : sf::Transformable
+struct sfTransformable : sf::Transformable, Allocated<sfAllocModuleGraphics>
 {
     mutable sfTransform Transform{};
     mutable sfTransform InverseTransform{};
@@ -29,6 +29,9 @@
 #include <CSFML/Graphics/VertexArray.h>
 #include <CSFML/Graphics/VertexArrayStruct.hpp>
 
+#include <algorithm>
+#include <functional>
+
 
 ////////////////////////////////////////////////////////////
 sfVertexArray* sfVertexArray_create()
@@ -70,6 +73,19 @@ sfVertex* sfVertexArray_getVertex(sfVertexArray* vertexArray, size_t index)
 }
 
 
+////////////////////////////////////////////////////////////
+sfVertex* sfVertexArray_getVertices(sfVertexArray* vertexArray)
+{
+    assert(vertexArray);
+
+    if (vertexArray->getVertexCount() == 0)
+        return nullptr;
+
+    // the cast is safe, sfVertex has to be binary compatible with sf::Vertex
+    return reinterpret_cast<sfVertex*>(&(*vertexArray)[0]);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfVertexArray_clear(sfVertexArray* vertexArray)
 {
@@ -95,6 +111,56 @@ void sfVertexArray_append(sfVertexArray* vertexArray, sfVertex vertex)
 }
 
 
+////////////////////////////////////////////////////////////
+void sfVertexArray_appendRange(sfVertexArray* vertexArray, const sfVertex* vertices, size_t vertexCount)
+{
+    assert(vertexArray);
+    assert(vertices || vertexCount == 0);
+
+    if (vertexCount == 0)
+        return;
+
+    // the cast is safe, sfVertex has to be binary compatible with sf::Vertex
+    const auto*       first  = reinterpret_cast<const sf::Vertex*>(vertices);
+    const std::size_t offset = vertexArray->getVertexCount();
+
+    // The vertices may come from this very array, which the resize can reallocate:
+    // they are then copied by index from their new location
+    const sf::Vertex* begin   = offset > 0 ? &(*vertexArray)[0] : nullptr;
+    const bool        aliased = begin && std::less_equal<>()(begin, first) && std::less<>()(first, begin + offset);
+    const std::size_t source  = aliased ? static_cast<std::size_t>(first - begin) : 0;
+
+    vertexArray->resize(offset + vertexCount);
+
+    if (aliased)
+    {
+        for (std::size_t i = 0; i < vertexCount; ++i)
+            (*vertexArray)[offset + i] = (*vertexArray)[source + i];
+    }
+    else
+    {
+        std::copy(first, first + vertexCount, &(*vertexArray)[offset]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfVertexArray_reserve(sfVertexArray* vertexArray, size_t vertexCount)
+{
+    assert(vertexArray);
+
+    // sf::VertexArray doesn't expose its storage, but shrinking a
+    // std::vector never releases memory: growing to the requested
+    // size and back leaves the capacity allocated
+    const std::size_t currentCount = vertexArray->getVertexCount();
+    if (vertexCount > currentCount)
+    {
+        vertexArray->resize(vertexCount);
+        vertexArray->resize(currentCount);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfVertexArray_setPrimitiveType(sfVertexArray* vertexArray, sfPrimitiveType type)
 {
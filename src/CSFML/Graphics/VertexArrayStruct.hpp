@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Graphics/VertexArray.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfVertexArray
 ////////////////////////////////////////////////////////////
-struct sfVertexArray : sf::VertexArray
+struct sfVertexArray : sf::VertexArray, Allocated<sfAllocModuleGraphics>
 {
 };
@@ -28,6 +28,9 @@
 #include <CSFML/Graphics/VertexBuffer.h>
 #include <CSFML/Graphics/VertexBufferStruct.hpp>
 
+#include <algorithm>
+#include <utility>
+
 
 ////////////////////////////////////////////////////////////
 sfVertexBuffer* sfVertexBuffer_create(size_t vertexCount, sfPrimitiveType type, sfVertexBufferUsage usage)
@@ -70,7 +73,18 @@ bool sfVertexBuffer_update(sfVertexBuffer* vertexBuffer, const sfVertex* vertice
 {
     // the cast is safe, sfVertex has to be binary compatible with sf::Vertex
     assert(vertexBuffer);
-    return vertexBuffer->update(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount, offset);
+    const auto* first = reinterpret_cast<const sf::Vertex*>(vertices);
+    if (!vertexBuffer->update(first, vertexCount, offset))
+        return false;
+
+    if (!vertexBuffer->LocalCopyEnabled)
+        return true;
+
+    // Mirror the update in the CPU copy, following the resizing rules of sf::VertexBuffer
+    if (vertexCount >= vertexBuffer->Vertices.size())
+        vertexBuffer->Vertices.resize(vertexCount);
+    std::copy(first, first + vertexCount, vertexBuffer->Vertices.begin() + offset);
+    return true;
 }
 
 
@@ -78,7 +92,20 @@ bool sfVertexBuffer_update(sfVertexBuffer* vertexBuffer, const sfVertex* vertice
 bool sfVertexBuffer_updateFromVertexBuffer(sfVertexBuffer* vertexBuffer, const sfVertexBuffer* other)
 {
     assert(vertexBuffer);
-    return vertexBuffer->update(*other);
+    assert(other);
+    if (!vertexBuffer->update(*other))
+        return false;
+
+    // The contents of the other buffer are unknown when it keeps no copy
+    if (!other->LocalCopyEnabled)
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, false);
+    else if (vertexBuffer->LocalCopyEnabled)
+    {
+        // sf::VertexBuffer copies the contents of the other buffer without resizing
+        const std::size_t count = std::min(other->Vertices.size(), vertexBuffer->Vertices.size());
+        std::copy_n(other->Vertices.begin(), count, vertexBuffer->Vertices.begin());
+    }
+    return true;
 }
 
 
@@ -88,6 +115,8 @@ void sfVertexBuffer_swap(sfVertexBuffer* left, sfVertexBuffer* right)
     assert(left);
     assert(right);
     left->swap(*right);
+    left->Vertices.swap(right->Vertices);
+    std::swap(left->LocalCopyEnabled, right->LocalCopyEnabled);
 }
 
 
@@ -131,6 +160,29 @@ sfVertexBufferUsage sfVertexBuffer_getUsage(const sfVertexBuffer* vertexBuffer)
 }
 
 
+////////////////////////////////////////////////////////////
+void sfVertexBuffer_setLocalCopyEnabled(sfVertexBuffer* vertexBuffer, bool enabled)
+{
+    assert(vertexBuffer);
+    if (enabled == vertexBuffer->LocalCopyEnabled)
+        return;
+
+    vertexBuffer->LocalCopyEnabled = enabled;
+    if (enabled)
+        vertexBuffer->Vertices.resize(vertexBuffer->getVertexCount());
+    else
+        std::vector<sf::Vertex>().swap(vertexBuffer->Vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfVertexBuffer_isLocalCopyEnabled(const sfVertexBuffer* vertexBuffer)
+{
+    assert(vertexBuffer);
+    return vertexBuffer->LocalCopyEnabled;
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfVertexBuffer_bind(const sfVertexBuffer* vertexBuffer)
 {
@@ -27,12 +27,20 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
 
+#include <vector>
+
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfVertexBuffer
 ////////////////////////////////////////////////////////////
-struct sfVertexBuffer : sf::VertexBuffer
+struct sfVertexBuffer : sf::VertexBuffer, Allocated<sfAllocModuleGraphics>
 {
+    // Optional CPU copy of the vertices, used to expand instanced draw calls
+    std::vector<sf::Vertex> Vertices;
+    bool                    LocalCopyEnabled{};
 };
@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Graphics/View.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfMusic
 ////////////////////////////////////////////////////////////
-struct sfView : sf::View
+struct sfView : sf::View, Allocated<sfAllocModuleGraphics>
 {
 };
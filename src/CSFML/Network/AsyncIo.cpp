@@ -0,0 +1,876 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/AsyncIo.h>
+#include <CSFML/Network/AsyncIoStruct.hpp>
+#include <CSFML/Network/SocketError.hpp>
+#include <CSFML/Network/TcpListenerStruct.hpp>
+#include <CSFML/Network/TcpSocketStruct.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <cassert>
+#include <cstdint>
+
+#if defined(CSFML_SYSTEM_LINUX)
+#include <csignal>
+#include <cerrno>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace
+{
+#if defined(CSFML_SYSTEM_LINUX)
+constexpr int maxReadyEvents = 256;
+#endif
+
+#if defined(CSFML_ASYNCIO_URING)
+constexpr unsigned submissionEntries = 256;
+constexpr unsigned completionEntries = 4096;
+
+// Cancellations share the user data of the operation they cancel, with the low bit set
+constexpr std::uintptr_t cancelTag = 1;
+static_assert(alignof(sfAsyncIoRequest) > cancelTag);
+
+// Maximum time to wait for the kernel to give up on cancelled operations
+constexpr std::chrono::seconds cancelTimeout(1);
+#endif
+
+////////////////////////////////////////////////////////////
+sf::SocketHandle getHandle(const sfAsyncIoSocket& entry)
+{
+    return entry.socket ? entry.socket->getNativeHandle() : entry.listener->getNativeHandle();
+}
+
+
+////////////////////////////////////////////////////////////
+bool isBlocking(const sfAsyncIoSocket& entry)
+{
+    return entry.socket ? entry.socket->isBlocking() : entry.listener->isBlocking();
+}
+
+
+////////////////////////////////////////////////////////////
+void setBlocking(sfAsyncIoSocket& entry, bool blocking)
+{
+    if (entry.socket && entry.socket->isBlocking() != blocking)
+        entry.socket->setBlocking(blocking);
+    if (entry.listener && entry.listener->isBlocking() != blocking)
+        entry.listener->setBlocking(blocking);
+}
+
+
+////////////////////////////////////////////////////////////
+std::deque<std::unique_ptr<sfAsyncIoRequest>>& getQueue(sfAsyncIoSocket& entry, sfAsyncIoOperation operation)
+{
+    return operation == sfAsyncIoSend ? entry.sends : entry.receives;
+}
+
+
+////////////////////////////////////////////////////////////
+// Move the first operation of a queue to the completions
+////////////////////////////////////////////////////////////
+void complete(sfAsyncIo&                                     asyncIo,
+              std::deque<std::unique_ptr<sfAsyncIoRequest>>& queue,
+              sfSocketStatus                                 status,
+              sfTcpSocket*                                   accepted)
+{
+    const sfAsyncIoRequest& request = *queue.front();
+
+    sfAsyncIoCompletion completion{};
+    completion.operation   = request.operation;
+    completion.status      = status;
+    completion.socket      = request.operation == sfAsyncIoAccept ? accepted : request.owner->socket;
+    completion.listener    = request.owner->listener;
+    completion.transferred = request.transferred;
+    completion.userData    = request.userData;
+    asyncIo.Completions.push_back(completion);
+
+    queue.pop_front();
+    --asyncIo.PendingCount;
+}
+
+
+////////////////////////////////////////////////////////////
+// Emulation: run an operation if it doesn't block
+////////////////////////////////////////////////////////////
+sfSocketStatus tryRequest(sfAsyncIoRequest& request, sfTcpSocket*& accepted)
+{
+    sfAsyncIoSocket& entry = *request.owner;
+
+    switch (request.operation)
+    {
+        case sfAsyncIoSend:
+        {
+            if (request.transferred == request.size)
+                return sfSocketDone;
+
+            std::size_t sent   = 0;
+            const auto  status = entry.socket->send(request.data + request.transferred,
+                                                   request.size - request.transferred,
+                                                   sent);
+            request.transferred += sent;
+            return status == sf::Socket::Status::Partial ? sfSocketNotReady : static_cast<sfSocketStatus>(status);
+        }
+
+        case sfAsyncIoReceive:
+            return static_cast<sfSocketStatus>(entry.socket->receive(request.data, request.size, request.transferred));
+
+        case sfAsyncIoAccept:
+        {
+            auto       socket = std::make_unique<sfTcpSocket>();
+            const auto status = static_cast<sfSocketStatus>(entry.listener->accept(*socket));
+            if (status == sfSocketDone)
+                accepted = socket.release();
+            return status;
+        }
+    }
+
+    return sfSocketError;
+}
+
+
+////////////////////////////////////////////////////////////
+// Emulation: run the operations of a queue until one would block
+////////////////////////////////////////////////////////////
+void progress(sfAsyncIo& asyncIo, std::deque<std::unique_ptr<sfAsyncIoRequest>>& queue)
+{
+    while (!queue.empty())
+    {
+        sfTcpSocket*         accepted = nullptr;
+        const sfSocketStatus status   = tryRequest(*queue.front(), accepted);
+        if (status == sfSocketNotReady)
+            return;
+
+        complete(asyncIo, queue, status, accepted);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Emulation: watch a socket for readiness
+////////////////////////////////////////////////////////////
+bool registerSocket(sfAsyncIo& asyncIo, sfAsyncIoSocket& entry)
+{
+    setBlocking(entry, false);
+
+#if defined(CSFML_SYSTEM_LINUX)
+    // Edge-triggered is enough since the operations are always run until they would block
+    epoll_event event{};
+    event.events   = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    event.data.ptr = &entry;
+    return epoll_ctl(asyncIo.EpollHandle, EPOLL_CTL_ADD, getHandle(entry), &event) == 0;
+#else
+    if (entry.socket)
+        asyncIo.Selector.add(*entry.socket);
+    else
+        asyncIo.Selector.add(*entry.listener);
+    return true;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+// Emulation: wait for sockets to be ready and run their operations
+////////////////////////////////////////////////////////////
+void waitEmulated(sfAsyncIo& asyncIo, std::int64_t timeout)
+{
+#if defined(CSFML_SYSTEM_LINUX)
+    int timeoutMs = -1;
+    if (timeout >= 0)
+        timeoutMs = static_cast<int>(std::min<std::int64_t>((timeout + 999) / 1000, std::numeric_limits<int>::max()));
+
+    asyncIo.ReadyEvents.resize(maxReadyEvents);
+    const int count = epoll_wait(asyncIo.EpollHandle, asyncIo.ReadyEvents.data(), maxReadyEvents, timeoutMs);
+
+    for (int i = 0; i < count; ++i)
+    {
+        auto& entry = *static_cast<sfAsyncIoSocket*>(asyncIo.ReadyEvents[static_cast<std::size_t>(i)].data.ptr);
+        progress(asyncIo, entry.receives);
+        progress(asyncIo, entry.sends);
+    }
+#else
+    // The selector only reports sockets ready to receive, pending sends are retried every millisecond
+    const bool hasSends = std::any_of(asyncIo.Sockets.begin(),
+                                      asyncIo.Sockets.end(),
+                                      [](const auto& pair) { return !pair.second.sends.empty(); });
+
+    sf::Time duration = timeout < 0 ? sf::Time::Zero : sf::microseconds(std::max<std::int64_t>(timeout, 1));
+    if (hasSends && (duration == sf::Time::Zero || duration > sf::milliseconds(1)))
+        duration = sf::milliseconds(1);
+
+    asyncIo.Selector.wait(duration);
+
+    for (auto& [key, entry] : asyncIo.Sockets)
+    {
+        progress(asyncIo, entry.receives);
+        progress(asyncIo, entry.sends);
+    }
+#endif
+}
+
+#if defined(CSFML_ASYNCIO_URING)
+
+////////////////////////////////////////////////////////////
+int enterRing(const sfAsyncIoRing& ring,
+              unsigned             minComplete,
+              unsigned             flags,
+              const void*          argument,
+              std::size_t          argumentSize)
+{
+    const unsigned pending = *ring.submissionTail - __atomic_load_n(ring.submissionHead, __ATOMIC_ACQUIRE);
+    return static_cast<int>(
+        syscall(__NR_io_uring_enter, ring.handle, pending, minComplete, flags, argument, argumentSize));
+}
+
+
+////////////////////////////////////////////////////////////
+void destroyRing(sfAsyncIoRing& ring)
+{
+    if (ring.submissions)
+        munmap(ring.submissions, ring.submissionsSize);
+    if (ring.memory)
+        munmap(ring.memory, ring.memorySize);
+    if (ring.handle >= 0)
+        ::close(ring.handle);
+
+    ring = sfAsyncIoRing{};
+}
+
+
+////////////////////////////////////////////////////////////
+bool createRing(sfAsyncIoRing& ring)
+{
+    io_uring_params params{};
+    params.flags      = IORING_SETUP_CQSIZE;
+    params.cq_entries = completionEntries;
+
+    const long handle = syscall(__NR_io_uring_setup, submissionEntries, &params);
+    if (handle < 0)
+        return false;
+    ring.handle = static_cast<int>(handle);
+
+    // Timeouts need IORING_FEAT_EXT_ARG (Linux 5.11), which also guarantees the socket operations
+    constexpr unsigned requiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((params.features & requiredFeatures) != requiredFeatures)
+        return false;
+
+    ring.memorySize = std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                               params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    constexpr int protection = PROT_READ | PROT_WRITE;
+    constexpr int mapping    = MAP_SHARED | MAP_POPULATE;
+
+    void* memory = mmap(nullptr, ring.memorySize, protection, mapping, ring.handle, IORING_OFF_SQ_RING);
+    if (memory == MAP_FAILED)
+        return false;
+    ring.memory = memory;
+
+    ring.submissionsSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* submissions    = mmap(nullptr, ring.submissionsSize, protection, mapping, ring.handle, IORING_OFF_SQES);
+    if (submissions == MAP_FAILED)
+        return false;
+    ring.submissions = static_cast<io_uring_sqe*>(submissions);
+
+    auto* const bytes    = static_cast<char*>(ring.memory);
+    ring.submissionHead  = reinterpret_cast<unsigned*>(bytes + params.sq_off.head);
+    ring.submissionTail  = reinterpret_cast<unsigned*>(bytes + params.sq_off.tail);
+    ring.submissionArray = reinterpret_cast<unsigned*>(bytes + params.sq_off.array);
+    ring.submissionMask  = *reinterpret_cast<unsigned*>(bytes + params.sq_off.ring_mask);
+    ring.submissionCount = params.sq_entries;
+    ring.completionHead  = reinterpret_cast<unsigned*>(bytes + params.cq_off.head);
+    ring.completionTail  = reinterpret_cast<unsigned*>(bytes + params.cq_off.tail);
+    ring.completions     = reinterpret_cast<io_uring_cqe*>(bytes + params.cq_off.cqes);
+    ring.completionMask  = *reinterpret_cast<unsigned*>(bytes + params.cq_off.ring_mask);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+// Queue a submission; it is passed to the kernel by the next wait
+////////////////////////////////////////////////////////////
+bool pushSubmission(sfAsyncIoRing& ring, const io_uring_sqe& submission)
+{
+    const auto isFull = [&ring]
+    { return *ring.submissionTail - __atomic_load_n(ring.submissionHead, __ATOMIC_ACQUIRE) == ring.submissionCount; };
+
+    while (isFull())
+    {
+        if (enterRing(ring, 0, 0, nullptr, 0) < 0 && errno != EINTR)
+            return false;
+    }
+
+    const unsigned tail  = *ring.submissionTail;
+    const unsigned index = tail & ring.submissionMask;
+    ring.submissions[index]     = submission;
+    ring.submissionArray[index] = index;
+    __atomic_store_n(ring.submissionTail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool startRequest(sfAsyncIo& asyncIo, sfAsyncIoRequest& request)
+{
+    io_uring_sqe submission{};
+    submission.fd        = getHandle(*request.owner);
+    submission.user_data = reinterpret_cast<std::uintptr_t>(&request);
+
+    const std::size_t remaining = request.size - request.transferred;
+    const auto        length    = static_cast<std::uint32_t>(
+        std::min<std::size_t>(remaining, std::numeric_limits<std::uint32_t>::max()));
+
+    switch (request.operation)
+    {
+        case sfAsyncIoSend:
+            submission.opcode    = IORING_OP_SEND;
+            submission.addr      = reinterpret_cast<std::uintptr_t>(request.data + request.transferred);
+            submission.len       = length;
+            submission.msg_flags = MSG_NOSIGNAL;
+            break;
+        case sfAsyncIoReceive:
+            submission.opcode = IORING_OP_RECV;
+            submission.addr   = reinterpret_cast<std::uintptr_t>(request.data);
+            submission.len    = length;
+            break;
+        case sfAsyncIoAccept:
+            submission.opcode       = IORING_OP_ACCEPT;
+            submission.accept_flags = SOCK_CLOEXEC;
+            break;
+    }
+
+    return pushSubmission(asyncIo.Ring, submission);
+}
+
+
+////////////////////////////////////////////////////////////
+// Start the first operation of a queue, failing those which can't be submitted
+////////////////////////////////////////////////////////////
+void startQueue(sfAsyncIo& asyncIo, std::deque<std::unique_ptr<sfAsyncIoRequest>>& queue)
+{
+    while (!queue.empty() && !startRequest(asyncIo, *queue.front()))
+        complete(asyncIo, queue, sfSocketError, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void processCompletion(sfAsyncIo& asyncIo, sfAsyncIoRequest& request, int result)
+{
+    if (request.cancelled)
+    {
+        if (request.operation == sfAsyncIoAccept && result >= 0)
+            ::close(result);
+
+        const auto it = std::find_if(asyncIo.CancelledRequests.begin(),
+                                     asyncIo.CancelledRequests.end(),
+                                     [&request](const auto& cancelled) { return cancelled.get() == &request; });
+        asyncIo.CancelledRequests.erase(it);
+        return;
+    }
+
+    auto& queue = getQueue(*request.owner, request.operation);
+    assert(queue.front().get() == &request);
+
+    // The kernel may give up on an operation when the socket is non-blocking
+    if (result == -EAGAIN || result == -EINTR)
+    {
+        startQueue(asyncIo, queue);
+        return;
+    }
+
+    sfSocketStatus status   = sfSocketDone;
+    sfTcpSocket*   accepted = nullptr;
+
+    if (result < 0)
+    {
+        status = getErrorStatus(-result);
+    }
+    else if (request.operation == sfAsyncIoSend)
+    {
+        request.transferred += static_cast<std::size_t>(result);
+        if (request.transferred < request.size)
+        {
+            if (result == 0)
+                status = sfSocketDisconnected;
+            else if (startRequest(asyncIo, request))
+                return;
+            else
+                status = sfSocketError;
+        }
+    }
+    else if (request.operation == sfAsyncIoReceive)
+    {
+        request.transferred = static_cast<std::size_t>(result);
+        if (result == 0 && request.size > 0)
+            status = sfSocketDisconnected;
+    }
+    else
+    {
+        auto socket = std::make_unique<sfTcpSocket>();
+        socket->create(result);
+        accepted = socket.release();
+    }
+
+    complete(asyncIo, queue, status, accepted);
+    startQueue(asyncIo, queue);
+}
+
+
+////////////////////////////////////////////////////////////
+// Get a cancelled operation which the kernel didn't complete yet
+////////////////////////////////////////////////////////////
+sfAsyncIoRequest* findCancelled(const sfAsyncIo& asyncIo, const sfAsyncIoRequest* request)
+{
+    const auto it = std::find_if(asyncIo.CancelledRequests.begin(),
+                                 asyncIo.CancelledRequests.end(),
+                                 [request](const auto& cancelled) { return cancelled.get() == request; });
+    return it != asyncIo.CancelledRequests.end() ? it->get() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void processCancelCompletion(sfAsyncIo& asyncIo, const sfAsyncIoRequest* request, int result)
+{
+    // The operation was cancelled (0), had already completed (-ENOENT) or is being interrupted (-EALREADY):
+    // its own completion follows. Otherwise the kernel can't cancel it, and it runs until the socket is ready
+    if (result == 0 || result == -ENOENT || result == -EALREADY)
+        return;
+
+    if (sfAsyncIoRequest* cancelled = findCancelled(asyncIo, request))
+        cancelled->cancelFailed = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void harvestRing(sfAsyncIo& asyncIo)
+{
+    sfAsyncIoRing& ring = asyncIo.Ring;
+
+    unsigned       head = *ring.completionHead;
+    const unsigned tail = __atomic_load_n(ring.completionTail, __ATOMIC_ACQUIRE);
+
+    for (; head != tail; ++head)
+    {
+        const io_uring_cqe& completion = ring.completions[head & ring.completionMask];
+        const auto          userData   = static_cast<std::uintptr_t>(completion.user_data);
+        const int           result     = completion.res;
+
+        if (userData & cancelTag)
+            processCancelCompletion(asyncIo, reinterpret_cast<const sfAsyncIoRequest*>(userData & ~cancelTag), result);
+        else
+            processCompletion(asyncIo, *reinterpret_cast<sfAsyncIoRequest*>(userData), result);
+    }
+
+    __atomic_store_n(ring.completionHead, head, __ATOMIC_RELEASE);
+}
+
+
+////////////////////////////////////////////////////////////
+// Submit the queued operations and wait until one completes
+////////////////////////////////////////////////////////////
+void waitRing(sfAsyncIo& asyncIo, std::int64_t timeout)
+{
+    __kernel_timespec      duration{};
+    io_uring_getevents_arg argument{};
+    argument.sigmask_sz = _NSIG / 8;
+
+    if (timeout >= 0)
+    {
+        duration.tv_sec  = timeout / 1000000;
+        duration.tv_nsec = (timeout % 1000000) * 1000;
+        argument.ts      = reinterpret_cast<std::uintptr_t>(&duration);
+    }
+
+    enterRing(asyncIo.Ring, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &argument, sizeof(argument));
+    harvestRing(asyncIo);
+}
+
+
+////////////////////////////////////////////////////////////
+// Cancel the running operations of a socket, and wait until the kernel is done with them
+////////////////////////////////////////////////////////////
+void cancelRing(sfAsyncIo& asyncIo, sfAsyncIoSocket& entry)
+{
+    // The first operation of each queue is running in the kernel and must be waited for,
+    // since it still refers to the socket and to the user data
+    std::vector<const sfAsyncIoRequest*> running;
+    for (auto* queue : {&entry.receives, &entry.sends})
+    {
+        if (queue->empty())
+            continue;
+
+        auto& request      = queue->front();
+        request->cancelled = true;
+        request->owner     = nullptr;
+
+        io_uring_sqe submission{};
+        submission.opcode    = IORING_OP_ASYNC_CANCEL;
+        submission.addr      = reinterpret_cast<std::uintptr_t>(request.get());
+        submission.user_data = reinterpret_cast<std::uintptr_t>(request.get()) | cancelTag;
+
+        request->cancelFailed = !pushSubmission(asyncIo.Ring, submission);
+
+        running.push_back(request.get());
+        asyncIo.CancelledRequests.push_back(std::move(request));
+        queue->clear();
+    }
+
+    // Wait for the operations to complete, giving up if one can't be cancelled;
+    // other operations completing meanwhile are processed as usual
+    const auto waitCancelled = [&asyncIo, &running](bool shutDown)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + cancelTimeout;
+        for (;;)
+        {
+            bool done = true;
+            for (const sfAsyncIoRequest* request : running)
+            {
+                const sfAsyncIoRequest* cancelled = findCancelled(asyncIo, request);
+                if (cancelled && cancelled->cancelFailed && !shutDown)
+                    return false;
+                done = done && !cancelled;
+            }
+
+            const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (done || remaining.count() <= 0)
+                return done;
+
+            waitRing(asyncIo, remaining.count());
+        }
+    };
+
+    // Shutting the socket down makes the operations that the kernel couldn't interrupt complete
+    if (!waitCancelled(false))
+    {
+        ::shutdown(getHandle(entry), SHUT_RDWR);
+        waitCancelled(true);
+    }
+}
+
+#endif
+
+////////////////////////////////////////////////////////////
+// Wait for operations to complete, a negative timeout meaning infinity
+////////////////////////////////////////////////////////////
+void wait(sfAsyncIo& asyncIo, std::int64_t timeout)
+{
+#if defined(CSFML_ASYNCIO_URING)
+    if (!asyncIo.Emulated)
+    {
+        waitRing(asyncIo, timeout);
+        return;
+    }
+#endif
+
+    waitEmulated(asyncIo, timeout);
+}
+
+
+////////////////////////////////////////////////////////////
+// Collect the operations which are already complete
+////////////////////////////////////////////////////////////
+void poll(sfAsyncIo& asyncIo)
+{
+#if defined(CSFML_ASYNCIO_URING)
+    if (!asyncIo.Emulated)
+    {
+        if (*asyncIo.Ring.submissionTail != __atomic_load_n(asyncIo.Ring.submissionHead, __ATOMIC_ACQUIRE))
+            enterRing(asyncIo.Ring, 0, 0, nullptr, 0);
+        harvestRing(asyncIo);
+        return;
+    }
+#endif
+
+    waitEmulated(asyncIo, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool submit(sfAsyncIo&                        asyncIo,
+            const void*                       key,
+            sfTcpSocket*                      socket,
+            sfTcpListener*                    listener,
+            std::unique_ptr<sfAsyncIoRequest> request)
+{
+    auto& entry    = asyncIo.Sockets[key];
+    entry.socket   = socket;
+    entry.listener = listener;
+
+    // Sockets only get a native handle once they are listening or connected
+    if (getHandle(entry) == static_cast<sf::SocketHandle>(-1))
+    {
+        if (entry.receives.empty() && entry.sends.empty())
+            asyncIo.Sockets.erase(key);
+        return false;
+    }
+
+    if (!entry.registered)
+    {
+        entry.wasBlocking = isBlocking(entry);
+        if (asyncIo.Emulated && !registerSocket(asyncIo, entry))
+        {
+            setBlocking(entry, entry.wasBlocking);
+            asyncIo.Sockets.erase(key);
+            return false;
+        }
+
+        // The kernel runs operations on non-blocking sockets with a retry loop, prefer blocking sockets
+        if (!asyncIo.Emulated)
+            setBlocking(entry, true);
+
+        entry.registered = true;
+    }
+
+    auto& queue    = getQueue(entry, request->operation);
+    request->owner = &entry;
+    queue.push_back(std::move(request));
+    ++asyncIo.PendingCount;
+
+    // Later operations start once the ones before them complete
+    if (queue.size() > 1)
+        return true;
+
+#if defined(CSFML_ASYNCIO_URING)
+    if (!asyncIo.Emulated)
+    {
+        startQueue(asyncIo, queue);
+        return true;
+    }
+#endif
+
+    progress(asyncIo, queue);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void cancel(sfAsyncIo& asyncIo, const void* key)
+{
+    const auto it = asyncIo.Sockets.find(key);
+    if (it == asyncIo.Sockets.end())
+        return;
+
+    sfAsyncIoSocket& entry = it->second;
+    asyncIo.PendingCount -= entry.receives.size() + entry.sends.size();
+
+#if defined(CSFML_ASYNCIO_URING)
+    if (!asyncIo.Emulated)
+        cancelRing(asyncIo, entry);
+#endif
+
+#if defined(CSFML_SYSTEM_LINUX)
+    if (asyncIo.Emulated && entry.registered)
+        epoll_ctl(asyncIo.EpollHandle, EPOLL_CTL_DEL, getHandle(entry), nullptr);
+#else
+    if (entry.registered && entry.socket)
+        asyncIo.Selector.remove(*entry.socket);
+    else if (entry.registered)
+        asyncIo.Selector.remove(*entry.listener);
+#endif
+
+    // Give the socket back in the blocking state it had before its first operation
+    if (entry.registered)
+        setBlocking(entry, entry.wasBlocking);
+
+    asyncIo.Sockets.erase(it);
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+sfAsyncIo::~sfAsyncIo()
+{
+    while (!Sockets.empty())
+        cancel(*this, Sockets.begin()->first);
+
+    for (const sfAsyncIoCompletion& completion : Completions)
+    {
+        if (completion.operation == sfAsyncIoAccept)
+            delete completion.socket;
+    }
+
+#if defined(CSFML_ASYNCIO_URING)
+    destroyRing(Ring);
+#endif
+#if defined(CSFML_SYSTEM_LINUX)
+    if (EpollHandle >= 0)
+        ::close(EpollHandle);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+sfAsyncIo* sfAsyncIo_create([[maybe_unused]] bool emulate)
+{
+    auto asyncIo = std::make_unique<sfAsyncIo>();
+
+#if defined(CSFML_ASYNCIO_URING)
+    if (!emulate && createRing(asyncIo->Ring))
+        return asyncIo.release();
+
+    destroyRing(asyncIo->Ring);
+#endif
+
+#if defined(CSFML_SYSTEM_LINUX)
+    asyncIo->EpollHandle = epoll_create1(EPOLL_CLOEXEC);
+    if (asyncIo->EpollHandle < 0)
+        return nullptr;
+#endif
+
+    asyncIo->Emulated = true;
+    return asyncIo.release();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAsyncIo_destroy(const sfAsyncIo* asyncIo)
+{
+    delete asyncIo;
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfAsyncIo_isEmulated(const sfAsyncIo* asyncIo)
+{
+    assert(asyncIo);
+    return asyncIo->Emulated;
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfAsyncIo_send(sfAsyncIo* asyncIo, sfTcpSocket* socket, const void* data, size_t size, void* userData)
+{
+    assert(asyncIo);
+    assert(socket);
+    assert(data || size == 0);
+
+    auto request       = std::make_unique<sfAsyncIoRequest>();
+    request->operation = sfAsyncIoSend;
+    request->userData  = userData;
+    request->data      = const_cast<char*>(static_cast<const char*>(data));
+    request->size      = size;
+    return submit(*asyncIo, socket, socket, nullptr, std::move(request));
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfAsyncIo_receive(sfAsyncIo* asyncIo, sfTcpSocket* socket, void* data, size_t size, void* userData)
+{
+    assert(asyncIo);
+    assert(socket);
+    assert(data || size == 0);
+
+    auto request       = std::make_unique<sfAsyncIoRequest>();
+    request->operation = sfAsyncIoReceive;
+    request->userData  = userData;
+    request->data      = static_cast<char*>(data);
+    request->size      = size;
+    return submit(*asyncIo, socket, socket, nullptr, std::move(request));
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfAsyncIo_accept(sfAsyncIo* asyncIo, sfTcpListener* listener, void* userData)
+{
+    assert(asyncIo);
+    assert(listener);
+
+    auto request       = std::make_unique<sfAsyncIoRequest>();
+    request->operation = sfAsyncIoAccept;
+    request->userData  = userData;
+    return submit(*asyncIo, listener, nullptr, listener, std::move(request));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAsyncIo_cancelTcpSocket(sfAsyncIo* asyncIo, sfTcpSocket* socket)
+{
+    assert(asyncIo);
+    assert(socket);
+    cancel(*asyncIo, socket);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAsyncIo_cancelTcpListener(sfAsyncIo* asyncIo, sfTcpListener* listener)
+{
+    assert(asyncIo);
+    assert(listener);
+    cancel(*asyncIo, listener);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfAsyncIo_getPendingCount(const sfAsyncIo* asyncIo)
+{
+    assert(asyncIo);
+    return asyncIo->PendingCount + asyncIo->Completions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfAsyncIo_reap(sfAsyncIo* asyncIo, sfAsyncIoCompletion* completions, size_t maxCompletions, sfTime timeout)
+{
+    assert(asyncIo);
+    assert(completions || maxCompletions == 0);
+
+    using Clock = std::chrono::steady_clock;
+
+    const auto deadline = Clock::now() + std::chrono::microseconds(timeout.microseconds);
+
+    // Gather more completions when some are already there, so that they are returned together
+    if (!asyncIo->Completions.empty())
+        poll(*asyncIo);
+
+    while (asyncIo->Completions.empty() && asyncIo->PendingCount > 0)
+    {
+        std::int64_t remaining = -1;
+        if (timeout.microseconds > 0)
+        {
+            remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - Clock::now()).count();
+            if (remaining <= 0)
+                break;
+        }
+
+        wait(*asyncIo, remaining);
+    }
+
+    const std::size_t count = std::min(maxCompletions, asyncIo->Completions.size());
+    std::copy_n(asyncIo->Completions.begin(), count, completions);
+    asyncIo->Completions.erase(asyncIo->Completions.begin(),
+                               asyncIo->Completions.begin() + static_cast<std::ptrdiff_t>(count));
+    return count;
+}
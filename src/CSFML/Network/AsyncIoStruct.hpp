@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/AsyncIo.h>
+#include <CSFML/System/Allocated.hpp>
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#if defined(CSFML_SYSTEM_LINUX)
+#include <sys/epoll.h>
+
+// io_uring needs the headers of Linux 5.11 or later, older ones only get the emulation
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#if defined(IORING_FEAT_EXT_ARG)
+#define CSFML_ASYNCIO_URING
+#endif
+#endif
+#endif
+#else
+#include <SFML/Network/SocketSelector.hpp>
+#endif
+
+
+struct sfAsyncIoSocket;
+
+
+////////////////////////////////////////////////////////////
+// Operation submitted to an sfAsyncIo
+////////////////////////////////////////////////////////////
+struct sfAsyncIoRequest
+{
+    sfAsyncIoSocket*   owner{};
+    sfAsyncIoOperation operation{};
+    void*              userData{};
+    char*              data{};
+    std::size_t        size{};
+    std::size_t        transferred{};
+    bool               cancelled{};
+    bool               cancelFailed{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Pending operations of a socket; only the first operation of
+// each queue is running, so that they complete in order
+////////////////////////////////////////////////////////////
+struct sfAsyncIoSocket
+{
+    sfTcpSocket*                                  socket{};
+    sfTcpListener*                                listener{};
+    std::deque<std::unique_ptr<sfAsyncIoRequest>> receives;
+    std::deque<std::unique_ptr<sfAsyncIoRequest>> sends;
+    bool                                          registered{};
+    bool                                          wasBlocking{};
+};
+
+
+#if defined(CSFML_ASYNCIO_URING)
+
+////////////////////////////////////////////////////////////
+// Submission and completion rings shared with the kernel
+////////////////////////////////////////////////////////////
+struct sfAsyncIoRing
+{
+    int           handle{-1};
+    void*         memory{};
+    std::size_t   memorySize{};
+    io_uring_sqe* submissions{};
+    std::size_t   submissionsSize{};
+    unsigned*     submissionHead{};
+    unsigned*     submissionTail{};
+    unsigned*     submissionArray{};
+    unsigned      submissionMask{};
+    unsigned      submissionCount{};
+    unsigned*     completionHead{};
+    unsigned*     completionTail{};
+    io_uring_cqe* completions{};
+    unsigned      completionMask{};
+};
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfAsyncIo
+////////////////////////////////////////////////////////////
+struct sfAsyncIo : Allocated<sfAllocModuleNetwork>
+{
+    sfAsyncIo() = default;
+    sfAsyncIo(const sfAsyncIo&) = delete;
+    sfAsyncIo& operator=(const sfAsyncIo&) = delete;
+    ~sfAsyncIo();
+
+#if defined(CSFML_ASYNCIO_URING)
+    sfAsyncIoRing Ring;
+#endif
+#if defined(CSFML_SYSTEM_LINUX)
+    int                      EpollHandle{-1};
+    std::vector<epoll_event> ReadyEvents;
+#else
+    sf::SocketSelector Selector;
+#endif
+
+    bool Emulated{};
+
+    // Sockets with operations, keyed by their CSFML object; they are
+    // stable in memory so that the system can point to them
+    std::unordered_map<const void*, sfAsyncIoSocket> Sockets;
+
+    // Cancelled operations which are still running in the system
+    std::vector<std::unique_ptr<sfAsyncIoRequest>> CancelledRequests;
+
+    std::deque<sfAsyncIoCompletion> Completions;
+    std::size_t                     PendingCount{};
+};
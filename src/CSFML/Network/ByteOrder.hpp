@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <type_traits>
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CSFML_BYTE_ORDER_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define CSFML_BYTE_ORDER_NEON
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Whether the host byte order differs from the network byte order
+////////////////////////////////////////////////////////////
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+inline constexpr bool isNetworkByteOrderSwapped = false;
+#else
+inline constexpr bool isNetworkByteOrderSwapped = true;
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Copy an array of Size-byte integers, reversing the bytes of
+// each one; source and destination may be the same array
+////////////////////////////////////////////////////////////
+template <std::size_t Size>
+void swapByteOrder(void* destination, const void* source, std::size_t count)
+{
+    static_assert(Size == 2 || Size == 4 || Size == 8);
+
+    auto*       out = static_cast<unsigned char*>(destination);
+    const auto* in  = static_cast<const unsigned char*>(source);
+    std::size_t i   = 0;
+
+#if defined(CSFML_BYTE_ORDER_SSE2)
+    // SSE2 has no byte shuffle: reorder 16-bit words, then swap the two bytes of each word
+    for (; i + 16 / Size <= count; i += 16 / Size)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * Size));
+        if constexpr (Size == 4)
+        {
+            value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+            value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else if constexpr (Size == 8)
+        {
+            value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+            value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        value = _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * Size), value);
+    }
+#elif defined(CSFML_BYTE_ORDER_NEON)
+    for (; i + 16 / Size <= count; i += 16 / Size)
+    {
+        uint8x16_t value = vld1q_u8(in + i * Size);
+        if constexpr (Size == 2)
+            value = vrev16q_u8(value);
+        else if constexpr (Size == 4)
+            value = vrev32q_u8(value);
+        else
+            value = vrev64q_u8(value);
+        vst1q_u8(out + i * Size, value);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        unsigned char bytes[Size];
+        std::memcpy(bytes, in + i * Size, Size);
+        for (std::size_t j = 0; j < Size; ++j)
+            out[i * Size + j] = bytes[Size - 1 - j];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Copy an array of values between the host and network byte orders,
+// the same way sf::Packet converts scalars; source and destination
+// may be the same array
+////////////////////////////////////////////////////////////
+template <typename T>
+void convertByteOrder(void* destination, const void* source, std::size_t count)
+{
+    // sf::Packet writes floating point numbers in host order
+    if constexpr (isNetworkByteOrderSwapped && std::is_integral_v<T> && sizeof(T) > 1)
+        swapByteOrder<sizeof(T)>(destination, source, count);
+    else if (destination != source)
+        std::memcpy(destination, source, count * sizeof(T));
+}
@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/Compression.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Constants of the LZ4 block format
+////////////////////////////////////////////////////////////
+constexpr std::size_t minMatch     = 4;     // Shortest match which can be encoded
+constexpr std::size_t lastLiterals = 5;     // The last bytes of a block are always literals
+constexpr std::size_t matchLimit   = 12;    // The last match must start this far from the end
+constexpr std::size_t maxOffset    = 65535; // Farthest match which can be encoded
+constexpr unsigned    hashBits     = 12;
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t read32(const std::uint8_t* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t read64(const std::uint8_t* data)
+{
+    std::uint64_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t hash(std::uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+
+////////////////////////////////////////////////////////////
+// Write the part of a length which doesn't fit in a token
+////////////////////////////////////////////////////////////
+std::uint8_t* writeLength(std::uint8_t* output, std::size_t length)
+{
+    for (; length >= 255; length -= 255)
+        *output++ = 255;
+    *output++ = static_cast<std::uint8_t>(length);
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+// Read the part of a length which doesn't fit in a token
+////////////////////////////////////////////////////////////
+bool readLength(const std::uint8_t* input, std::size_t size, std::size_t& position, std::size_t& length)
+{
+    std::uint8_t byte = 255;
+    while (byte == 255)
+    {
+        if (position == size)
+            return false;
+        byte = input[position++];
+        length += byte;
+    }
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+// Write a sequence: literals, followed by a match unless it is the last sequence
+////////////////////////////////////////////////////////////
+std::uint8_t* writeSequence(std::uint8_t*       output,
+                            const std::uint8_t* literals,
+                            std::size_t         literalLength,
+                            std::size_t         offset,
+                            std::size_t         matchLength)
+{
+    std::uint8_t& token = *output++;
+    token               = static_cast<std::uint8_t>(std::min<std::size_t>(literalLength, 15) << 4);
+    if (literalLength >= 15)
+        output = writeLength(output, literalLength - 15);
+    if (literalLength > 0)
+        std::memcpy(output, literals, literalLength);
+    output += literalLength;
+
+    if (matchLength == 0)
+        return output;
+
+    *output++ = static_cast<std::uint8_t>(offset);
+    *output++ = static_cast<std::uint8_t>(offset >> 8);
+
+    matchLength -= minMatch;
+    token = static_cast<std::uint8_t>(token | std::min<std::size_t>(matchLength, 15));
+    if (matchLength >= 15)
+        output = writeLength(output, matchLength - 15);
+    return output;
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+std::size_t compressBlock(const void* source, std::size_t size, void* destination)
+{
+    const auto* input  = static_cast<const std::uint8_t*>(source);
+    auto*       output = static_cast<std::uint8_t*>(destination);
+    std::size_t anchor = 0;
+
+    if (size > matchLimit)
+    {
+        // Last position seen for each hash of 4 bytes
+        std::array<std::uint32_t, std::size_t{1} << hashBits> table{};
+
+        const std::size_t searchEnd = size - matchLimit;
+        const std::size_t matchEnd  = size - lastLiterals;
+        std::size_t       position  = 1;
+        std::size_t       misses    = 0;
+
+        while (position < searchEnd)
+        {
+            const std::uint32_t sequence  = read32(input + position);
+            std::uint32_t&      entry     = table[hash(sequence)];
+            const std::size_t   candidate = entry;
+            entry                         = static_cast<std::uint32_t>(position);
+
+            if (position - candidate > maxOffset || read32(input + candidate) != sequence)
+            {
+                // Skip faster through data which doesn't compress
+                position += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // Extend the match backwards over the pending literals, then forwards
+            std::size_t start     = position;
+            std::size_t reference = candidate;
+            while (start > anchor && reference > 0 && input[start - 1] == input[reference - 1])
+            {
+                --start;
+                --reference;
+            }
+
+            std::size_t end = position + minMatch;
+            std::size_t ref = candidate + minMatch;
+            while (end + 8 <= matchEnd && read64(input + end) == read64(input + ref))
+            {
+                end += 8;
+                ref += 8;
+            }
+            while (end < matchEnd && input[end] == input[ref])
+            {
+                ++end;
+                ++ref;
+            }
+
+            output = writeSequence(output, input + anchor, start - anchor, start - reference, end - start);
+            anchor = end;
+
+            // Remember a position inside the match, to find repetitions of it
+            if (end - 2 < searchEnd)
+                table[hash(read32(input + end - 2))] = static_cast<std::uint32_t>(end - 2);
+            position = end;
+        }
+    }
+
+    output = writeSequence(output, input + anchor, size - anchor, 0, 0);
+    return static_cast<std::size_t>(output - static_cast<std::uint8_t*>(destination));
+}
+
+
+////////////////////////////////////////////////////////////
+bool decompressBlock(const void* source, std::size_t size, void* destination, std::size_t destinationSize)
+{
+    const auto* input    = static_cast<const std::uint8_t*>(source);
+    auto*       output   = static_cast<std::uint8_t*>(destination);
+    std::size_t position = 0;
+    std::size_t written  = 0;
+
+    while (position < size)
+    {
+        const std::uint8_t token = input[position++];
+
+        std::size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(input, size, position, literalLength))
+            return false;
+        if (literalLength > size - position || literalLength > destinationSize - written)
+            return false;
+        if (literalLength > 0)
+            std::memcpy(output + written, input + position, literalLength);
+        position += literalLength;
+        written += literalLength;
+
+        // The last sequence has no match
+        if (position == size)
+            break;
+
+        if (size - position < 2)
+            return false;
+        const std::size_t offset = input[position] | static_cast<std::size_t>(input[position + 1]) << 8;
+        position += 2;
+        if (offset == 0 || offset > written)
+            return false;
+
+        std::size_t matchLength = token & 15u;
+        if (matchLength == 15 && !readLength(input, size, position, matchLength))
+            return false;
+        matchLength += minMatch;
+        if (matchLength > destinationSize - written)
+            return false;
+
+        // The match may overlap the bytes it produces, which repeats them,
+        // so it is copied in chunks no longer than the offset
+        const std::uint8_t* match = output + written - offset;
+        std::size_t         i     = 0;
+        if (offset >= 8)
+        {
+            for (; i + 8 <= matchLength; i += 8)
+                std::memcpy(output + written + i, match + i, 8);
+        }
+        for (; i < matchLength; ++i)
+            output[written + i] = match[i];
+        written += matchLength;
+    }
+
+    return written == destinationSize;
+}
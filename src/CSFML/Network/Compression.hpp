@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Get the maximum size of the data compressed by compressBlock
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr std::size_t getCompressBound(std::size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+
+////////////////////////////////////////////////////////////
+// Compress a block of bytes in the LZ4 block format
+//
+// destination must hold at least getCompressBound(size) bytes.
+// Returns the size of the compressed data.
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t compressBlock(const void* source, std::size_t size, void* destination);
+
+
+////////////////////////////////////////////////////////////
+// Decompress a block of bytes in the LZ4 block format
+//
+// Returns false if the data is corrupted or if it doesn't
+// decompress to exactly destinationSize bytes.
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool decompressBlock(const void* source,
+                                   std::size_t size,
+                                   void*       destination,
+                                   std::size_t destinationSize);
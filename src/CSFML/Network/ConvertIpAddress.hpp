@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/IpAddress.h>
+
+#include <SFML/Network/IpAddress.hpp>
+
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Convert a 32-bits address to sfIpAddressPacked, formatting
+// the string without going through sf::IpAddress::toString
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline sfIpAddressPacked convertIpAddress(std::uint32_t integer)
+{
+    sfIpAddressPacked result{};
+    result.integer = integer;
+
+    char* output = result.address.address;
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        const auto byte = static_cast<unsigned int>((integer >> shift) & 0xFF);
+        if (byte >= 100)
+            *output++ = static_cast<char>('0' + byte / 100);
+        if (byte >= 10)
+            *output++ = static_cast<char>('0' + byte / 10 % 10);
+        *output++ = static_cast<char>('0' + byte % 10);
+        if (shift > 0)
+            *output++ = '.';
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+// Convert sf::IpAddress to sfIpAddressPacked
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline sfIpAddressPacked convertIpAddress(const sf::IpAddress& address)
+{
+    return convertIpAddress(address.toInteger());
+}
+
+
+////////////////////////////////////////////////////////////
+// Convert sfIpAddressPacked to sf::IpAddress
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline sf::IpAddress convertIpAddress(const sfIpAddressPacked& address)
+{
+    return sf::IpAddress(address.integer);
+}
@@ -27,10 +27,25 @@
 ////////////////////////////////////////////////////////////
 #include <CSFML/Network/Ftp.h>
 #include <CSFML/Network/FtpStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
+#include <CSFML/System/BufferStruct.hpp>
 
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpSocket.hpp>
 #include <SFML/System/String.hpp>
 
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 
@@ -50,7 +65,8 @@ static_assert(alignof(sfChar32) == alignof(char32_t));
 [[nodiscard]] sfChar32* copyToChar32(const sf::String& str)
 {
     const std::size_t byteCount = sizeof(sfChar32) * str.getSize();
-    auto*             utf32     = static_cast<sfChar32*>(std::malloc(byteCount + sizeof(sfChar32)));
+    auto*             utf32     = static_cast<sfChar32*>(
+        sfAllocateForCaller(sfAllocModuleNetwork, byteCount + sizeof(sfChar32)));
     if (!utf32)
         return nullptr;
     std::memcpy(utf32, str.getData(), byteCount);
@@ -58,9 +74,281 @@ static_assert(alignof(sfChar32) == alignof(char32_t));
 
     return utf32;
 }
+
+
+////////////////////////////////////////////////////////////
+// Wrap a response, reusing one released to the sfFtp if possible;
+// only the wrapper is reused, the contents of the response are moved in
+////////////////////////////////////////////////////////////
+template <typename T, typename Response>
+[[nodiscard]] T* makeResponse(std::vector<std::unique_ptr<T>>& releasedResponses, Response response)
+{
+    if (releasedResponses.empty())
+        return new T{std::move(response), {}};
+
+    T* recycled = releasedResponses.back().release();
+    releasedResponses.pop_back();
+    static_cast<Response&>(*recycled) = std::move(response);
+    return recycled;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sfFtpResponse* makeResponse(sfFtp& ftp, sf::Ftp::Response&& response)
+{
+    return makeResponse(ftp.ReleasedResponses, std::move(response));
+}
+
+
+////////////////////////////////////////////////////////////
+// Maximum size of the parts of a transfer
+////////////////////////////////////////////////////////////
+constexpr std::size_t transferSize = 16384;
+
+
+////////////////////////////////////////////////////////////
+// Read the next reply of the server on the control connection, with the message of sf::Ftp: the
+// text after the code for a single line, or the lines after the first code for a multiline reply
+////////////////////////////////////////////////////////////
+sf::Ftp::Response getResponse(sfFtp& ftp)
+{
+    std::string code; // Code of a multiline reply, which ends with a line starting with it and a space
+    std::string message;
+    for (;;)
+    {
+        std::size_t lineEnd = ftp.Received.find('\n');
+        while (lineEnd == std::string::npos)
+        {
+            std::array<char, 1024> buffer{};
+            std::size_t            received = 0;
+            if (ftp.Connection.receive(buffer.data(), buffer.size(), received) != sf::Socket::Status::Done)
+                return sf::Ftp::Response(sf::Ftp::Response::Status::ConnectionClosed);
+            ftp.Received.append(buffer.data(), received);
+            lineEnd = ftp.Received.find('\n');
+        }
+
+        std::string line = ftp.Received.substr(0, lineEnd);
+        ftp.Received.erase(0, lineEnd + 1);
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if (code.empty())
+        {
+            const auto isDigit = [&line](std::size_t index)
+            { return std::isdigit(static_cast<unsigned char>(line[index])) != 0; };
+            if (line.size() < 3 || !isDigit(0) || !isDigit(1) || !isDigit(2))
+                return sf::Ftp::Response(sf::Ftp::Response::Status::InvalidResponse);
+
+            if (line.size() > 3 && line[3] == '-')
+            {
+                code    = line.substr(0, 3);
+                message = line.substr(3) + '\n';
+                continue;
+            }
+        }
+        else if (line.compare(0, 3, code) != 0 || (line.size() > 3 && line[3] != ' '))
+        {
+            message += line + '\n';
+            continue;
+        }
+
+        const auto status = static_cast<sf::Ftp::Response::Status>(std::atoi(line.substr(0, 3).c_str()));
+        return sf::Ftp::Response(status, code.empty() ? line.substr(3) : message + line);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Ftp::Response sendCommand(sfFtp& ftp, const std::string& command, const std::string& parameter = "")
+{
+    const std::string line = parameter.empty() ? command + "\r\n" : command + ' ' + parameter + "\r\n";
+    if (ftp.Connection.send(line.data(), line.size()) != sf::Socket::Status::Done)
+        return sf::Ftp::Response(sf::Ftp::Response::Status::ConnectionClosed);
+
+    return getResponse(ftp);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Ftp::Response disconnect(sfFtp& ftp)
+{
+    sf::Ftp::Response response = sendCommand(ftp, "QUIT");
+    if (response.isOk())
+    {
+        ftp.Connection.disconnect();
+        ftp.Received.clear();
+    }
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+// Open a data connection in passive mode, as sf::Ftp does for its own transfers
+////////////////////////////////////////////////////////////
+sf::Ftp::Response openDataConnection(sfFtp& ftp, sf::TcpSocket& socket, sfFtpTransferMode mode)
+{
+    sf::Ftp::Response response = sendCommand(ftp, "PASV");
+    if (!response.isOk())
+        return response;
+
+    // The reply ends with the address and port to connect to, as "h1,h2,h3,h4,p1,p2"
+    const std::string&      message = response.getMessage();
+    std::size_t             index   = message.find_first_of("0123456789");
+    std::array<unsigned, 6> numbers{};
+    for (unsigned& number : numbers)
+    {
+        if (index >= message.size() || !std::isdigit(static_cast<unsigned char>(message[index])))
+            return sf::Ftp::Response(sf::Ftp::Response::Status::InvalidResponse);
+
+        for (; index < message.size() && std::isdigit(static_cast<unsigned char>(message[index])); ++index)
+            number = number * 10 + static_cast<unsigned>(message[index] - '0');
+        ++index;
+    }
+
+    const sf::IpAddress address(static_cast<std::uint8_t>(numbers[0]),
+                                static_cast<std::uint8_t>(numbers[1]),
+                                static_cast<std::uint8_t>(numbers[2]),
+                                static_cast<std::uint8_t>(numbers[3]));
+    const auto          port = static_cast<unsigned short>(numbers[4] * 256 + numbers[5]);
+    if (socket.connect(address, port) != sf::Socket::Status::Done)
+        return sf::Ftp::Response(sf::Ftp::Response::Status::ConnectionFailed);
+
+    static constexpr std::array<const char*, 3> types{"I", "A", "E"};
+    return sendCommand(ftp, "TYPE", types[static_cast<std::size_t>(mode)]);
+}
+
+
+////////////////////////////////////////////////////////////
+// Close the data connection of a transfer, and read the reply of the server ending it
+////////////////////////////////////////////////////////////
+sf::Ftp::Response finishTransfer(sfFtp&                                          ftp,
+                                 sf::TcpSocket&                                  socket,
+                                 const std::optional<sf::Ftp::Response::Status>& abortStatus)
+{
+    socket.disconnect();
+
+    // The reply must be read even if the transfer was aborted, to keep the next replies in order
+    sf::Ftp::Response response = getResponse(ftp);
+    if (abortStatus && response.isOk())
+        response = sf::Ftp::Response(*abortStatus);
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+// Download a file, passing its data to a sink as it arrives
+////////////////////////////////////////////////////////////
+template <typename Sink>
+sf::Ftp::Response download(sfFtp&                ftp,
+                           const char*           remoteFile,
+                           sfFtpTransferMode     mode,
+                           sfFtpProgressCallback onProgress,
+                           void*                 userData,
+                           Sink&&                sink)
+{
+    const std::string file = remoteFile ? remoteFile : "";
+    sf::TcpSocket     socket;
+    sf::Ftp::Response response = openDataConnection(ftp, socket, mode);
+    if (!response.isOk())
+        return response;
+
+    // The size is only meaningful in binary mode, and costs a round trip
+    std::uint64_t total = 0;
+    if (onProgress && mode == sfFtpBinary)
+    {
+        const sf::Ftp::Response size = sendCommand(ftp, "SIZE", file);
+        if (size.getStatus() == sf::Ftp::Response::Status::FileStatus)
+            total = std::strtoull(size.getMessage().c_str(), nullptr, 10);
+    }
+
+    response = sendCommand(ftp, "RETR", file);
+    if (!response.isOk())
+        return response;
+
+    std::array<char, transferSize>           buffer{};
+    std::size_t                              received    = 0;
+    std::uint64_t                            transferred = 0;
+    std::optional<sf::Ftp::Response::Status> abortStatus;
+    sf::Socket::Status                       status = sf::Socket::Status::Done;
+    while ((status = socket.receive(buffer.data(), buffer.size(), received)) == sf::Socket::Status::Done)
+    {
+        transferred += received;
+        if (!sink(buffer.data(), received) || (onProgress && !onProgress(transferred, total, userData)))
+        {
+            abortStatus = sf::Ftp::Response::Status::TransferAborted;
+            break;
+        }
+    }
+
+    // The server closes the data connection at the end of the file, anything else interrupted the download
+    if (!abortStatus && status != sf::Socket::Status::Disconnected)
+        abortStatus = sf::Ftp::Response::Status::ConnectionClosed;
+
+    return finishTransfer(ftp, socket, abortStatus);
+}
+
+
+////////////////////////////////////////////////////////////
+// Upload a file, whose data is read from a source in parts until it returns 0, or a negative value on error
+////////////////////////////////////////////////////////////
+template <typename Source>
+sf::Ftp::Response upload(sfFtp&                ftp,
+                         const std::string&    remoteFile,
+                         sfFtpTransferMode     mode,
+                         bool                  append,
+                         std::uint64_t         total,
+                         sfFtpProgressCallback onProgress,
+                         void*                 userData,
+                         Source&&              source)
+{
+    sf::TcpSocket     socket;
+    sf::Ftp::Response response = openDataConnection(ftp, socket, mode);
+    if (response.isOk())
+        response = sendCommand(ftp, append ? "APPE" : "STOR", remoteFile);
+    if (!response.isOk())
+        return response;
+
+    std::array<char, transferSize>           buffer{};
+    std::uint64_t                            transferred = 0;
+    std::optional<sf::Ftp::Response::Status> abortStatus;
+    for (;;)
+    {
+        const std::int64_t read = source(buffer.data(), buffer.size());
+        if (read < 0)
+        {
+            abortStatus = sf::Ftp::Response::Status::InvalidFile;
+            break;
+        }
+        if (read == 0)
+            break;
+
+        if (socket.send(buffer.data(), static_cast<std::size_t>(read)) != sf::Socket::Status::Done)
+        {
+            abortStatus = sf::Ftp::Response::Status::ConnectionClosed;
+            break;
+        }
+
+        transferred += static_cast<std::uint64_t>(read);
+        if (onProgress && !onProgress(transferred, total, userData))
+        {
+            abortStatus = sf::Ftp::Response::Status::TransferAborted;
+            break;
+        }
+    }
+
+    return finishTransfer(ftp, socket, abortStatus);
+}
 } // namespace
 
 
+////////////////////////////////////////////////////////////
+sfFtp::~sfFtp()
+{
+    // As sf::Ftp, end the session before closing the connection
+    disconnect(*this);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfFtpListingResponse_destroy(const sfFtpListingResponse* ftpListingResponse)
 {
@@ -143,7 +431,7 @@ const char* sfFtpDirectoryResponse_getMessage(const sfFtpDirectoryResponse* ftpD
 const char* sfFtpDirectoryResponse_getDirectory(const sfFtpDirectoryResponse* ftpDirectoryResponse)
 {
     assert(ftpDirectoryResponse);
-    return strdup(ftpDirectoryResponse->getDirectory().string().c_str());
+    return copyToCString(sfAllocModuleNetwork, ftpDirectoryResponse->getDirectory().string());
 }
 
 
@@ -200,6 +488,33 @@ void sfFtp_destroy(const sfFtp* ftp)
 }
 
 
+////////////////////////////////////////////////////////////
+void sfFtp_releaseResponse(sfFtp* ftp, sfFtpResponse* ftpResponse)
+{
+    assert(ftp);
+    if (ftpResponse)
+        ftp->ReleasedResponses.emplace_back(ftpResponse);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFtp_releaseDirectoryResponse(sfFtp* ftp, sfFtpDirectoryResponse* ftpDirectoryResponse)
+{
+    assert(ftp);
+    if (ftpDirectoryResponse)
+        ftp->ReleasedDirectoryResponses.emplace_back(ftpDirectoryResponse);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFtp_releaseListingResponse(sfFtp* ftp, sfFtpListingResponse* ftpListingResponse)
+{
+    assert(ftp);
+    if (ftpListingResponse)
+        ftp->ReleasedListingResponses.emplace_back(ftpListingResponse);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfFtpResponse* sfFtp_connect(sfFtp* ftp, sfIpAddress server, unsigned short port, sfTime timeout)
 {
@@ -210,7 +525,11 @@ sfFtpResponse* sfFtp_connect(sfFtp* ftp, sfIpAddress server, unsigned short port
     if (!sfmlServer)
         return nullptr;
 
-    return new sfFtpResponse{ftp->connect(*sfmlServer, port, sf::microseconds(timeout.microseconds))};
+    ftp->Received.clear();
+    if (ftp->Connection.connect(*sfmlServer, port, sf::microseconds(timeout.microseconds)) != sf::Socket::Status::Done)
+        return makeResponse(*ftp, sf::Ftp::Response(sf::Ftp::Response::Status::ConnectionFailed));
+
+    return makeResponse(*ftp, getResponse(*ftp));
 }
 
 
@@ -218,7 +537,7 @@ sfFtpResponse* sfFtp_connect(sfFtp* ftp, sfIpAddress server, unsigned short port
 sfFtpResponse* sfFtp_loginAnonymous(sfFtp* ftp)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->login()};
+    return sfFtp_login(ftp, "anonymous", "user@sfml-dev.org");
 }
 
 
@@ -226,7 +545,11 @@ sfFtpResponse* sfFtp_loginAnonymous(sfFtp* ftp)
 sfFtpResponse* sfFtp_login(sfFtp* ftp, const char* name, const char* password)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->login(name ? name : "", password ? password : "")};
+
+    sf::Ftp::Response response = sendCommand(*ftp, "USER", name ? name : "");
+    if (response.isOk())
+        response = sendCommand(*ftp, "PASS", password ? password : "");
+    return makeResponse(*ftp, std::move(response));
 }
 
 
@@ -234,7 +557,7 @@ sfFtpResponse* sfFtp_login(sfFtp* ftp, const char* name, const char* password)
 sfFtpResponse* sfFtp_disconnect(sfFtp* ftp)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->disconnect()};
+    return makeResponse(*ftp, disconnect(*ftp));
 }
 
 
@@ -242,7 +565,7 @@ sfFtpResponse* sfFtp_disconnect(sfFtp* ftp)
 sfFtpResponse* sfFtp_keepAlive(sfFtp* ftp)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->keepAlive()};
+    return makeResponse(*ftp, sendCommand(*ftp, "NOOP"));
 }
 
 
@@ -250,7 +573,7 @@ sfFtpResponse* sfFtp_keepAlive(sfFtp* ftp)
 sfFtpDirectoryResponse* sfFtp_getWorkingDirectory(sfFtp* ftp)
 {
     assert(ftp);
-    return new sfFtpDirectoryResponse{ftp->getWorkingDirectory()};
+    return makeResponse(ftp->ReleasedDirectoryResponses, sf::Ftp::DirectoryResponse(sendCommand(*ftp, "PWD")));
 }
 
 
@@ -258,7 +581,22 @@ sfFtpDirectoryResponse* sfFtp_getWorkingDirectory(sfFtp* ftp)
 sfFtpListingResponse* sfFtp_getDirectoryListing(sfFtp* ftp, const char* directory)
 {
     assert(ftp);
-    return new sfFtpListingResponse{ftp->getDirectoryListing(directory ? directory : "")};
+
+    sf::TcpSocket     socket;
+    std::string       listing;
+    sf::Ftp::Response response = openDataConnection(*ftp, socket, sfFtpAscii);
+    if (response.isOk())
+        response = sendCommand(*ftp, "NLST", directory ? directory : "");
+    if (response.isOk())
+    {
+        std::array<char, transferSize> buffer{};
+        std::size_t                    received = 0;
+        while (socket.receive(buffer.data(), buffer.size(), received) == sf::Socket::Status::Done)
+            listing.append(buffer.data(), received);
+        response = finishTransfer(*ftp, socket, std::nullopt);
+    }
+
+    return makeResponse(ftp->ReleasedListingResponses, sf::Ftp::ListingResponse(response, listing));
 }
 
 
@@ -266,7 +604,7 @@ sfFtpListingResponse* sfFtp_getDirectoryListing(sfFtp* ftp, const char* director
 sfFtpResponse* sfFtp_changeDirectory(sfFtp* ftp, const char* directory)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->changeDirectory(directory ? directory : "")};
+    return makeResponse(*ftp, sendCommand(*ftp, "CWD", directory ? directory : ""));
 }
 
 
@@ -274,7 +612,7 @@ sfFtpResponse* sfFtp_changeDirectory(sfFtp* ftp, const char* directory)
 sfFtpResponse* sfFtp_parentDirectory(sfFtp* ftp)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->parentDirectory()};
+    return makeResponse(*ftp, sendCommand(*ftp, "CDUP"));
 }
 
 
@@ -282,7 +620,7 @@ sfFtpResponse* sfFtp_parentDirectory(sfFtp* ftp)
 sfFtpResponse* sfFtp_createDirectory(sfFtp* ftp, const char* name)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->createDirectory(name ? name : "")};
+    return makeResponse(*ftp, sendCommand(*ftp, "MKD", name ? name : ""));
 }
 
 
@@ -290,7 +628,7 @@ sfFtpResponse* sfFtp_createDirectory(sfFtp* ftp, const char* name)
 sfFtpResponse* sfFtp_deleteDirectory(sfFtp* ftp, const char* name)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->deleteDirectory(name ? name : "")};
+    return makeResponse(*ftp, sendCommand(*ftp, "RMD", name ? name : ""));
 }
 
 
@@ -298,7 +636,11 @@ sfFtpResponse* sfFtp_deleteDirectory(sfFtp* ftp, const char* name)
 sfFtpResponse* sfFtp_renameFile(sfFtp* ftp, const char* file, const char* newName)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->renameFile(file ? file : "", newName ? newName : "")};
+
+    sf::Ftp::Response response = sendCommand(*ftp, "RNFR", file ? file : "");
+    if (response.isOk())
+        response = sendCommand(*ftp, "RNTO", newName ? newName : "");
+    return makeResponse(*ftp, std::move(response));
 }
 
 
@@ -306,7 +648,7 @@ sfFtpResponse* sfFtp_renameFile(sfFtp* ftp, const char* file, const char* newNam
 sfFtpResponse* sfFtp_deleteFile(sfFtp* ftp, const char* name)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->deleteFile(name ? name : "")};
+    return makeResponse(*ftp, sendCommand(*ftp, "DELE", name ? name : ""));
 }
 
 
@@ -314,8 +656,36 @@ sfFtpResponse* sfFtp_deleteFile(sfFtp* ftp, const char* name)
 sfFtpResponse* sfFtp_download(sfFtp* ftp, const char* remoteFile, const char* localPath, sfFtpTransferMode mode)
 {
     assert(ftp);
-    return new sfFtpResponse{
-        ftp->download(remoteFile ? remoteFile : "", localPath ? localPath : "", static_cast<sf::Ftp::TransferMode>(mode))};
+
+    // The local file has the name of the distant file, and is only created once the server sends it
+    const std::filesystem::path path = std::filesystem::path(localPath ? localPath : "") /
+                                       std::filesystem::path(remoteFile ? remoteFile : "").filename();
+    std::ofstream file;
+    bool          writeFailed = false;
+    const auto    write       = [&](const char* data, std::size_t size)
+    {
+        if (!file.is_open())
+            file.open(path, std::ios_base::binary | std::ios_base::trunc);
+        writeFailed = !file.write(data, static_cast<std::streamsize>(size));
+        return !writeFailed;
+    };
+
+    sf::Ftp::Response response = download(*ftp, remoteFile, mode, nullptr, nullptr, write);
+    if (response.isOk() && !file.is_open())
+        file.open(path, std::ios_base::binary | std::ios_base::trunc);
+    const bool created = file.is_open();
+    file.close();
+
+    // The file couldn't be written, or is incomplete and removed
+    if ((response.isOk() && (!created || file.fail())) ||
+        (writeFailed && response.getStatus() == sf::Ftp::Response::Status::TransferAborted))
+        response = sf::Ftp::Response(sf::Ftp::Response::Status::InvalidFile);
+    if (!response.isOk() && created)
+    {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+    return makeResponse(*ftp, std::move(response));
 }
 
 
@@ -323,8 +693,105 @@ sfFtpResponse* sfFtp_download(sfFtp* ftp, const char* remoteFile, const char* lo
 sfFtpResponse* sfFtp_upload(sfFtp* ftp, const char* localFile, const char* remotePath, sfFtpTransferMode mode, bool append)
 {
     assert(ftp);
-    return new sfFtpResponse{
-        ftp->upload(localFile ? localFile : "", remotePath ? remotePath : "", static_cast<sf::Ftp::TransferMode>(mode), append)};
+
+    std::ifstream file(localFile ? localFile : "", std::ios_base::binary);
+    if (!file)
+        return makeResponse(*ftp, sf::Ftp::Response(sf::Ftp::Response::Status::InvalidFile));
+
+    // The distant file has the name of the local file, in the remote directory
+    std::string remoteFile = remotePath ? remotePath : "";
+    if (!remoteFile.empty() && remoteFile.back() != '/' && remoteFile.back() != '\\')
+        remoteFile += '/';
+    remoteFile += std::filesystem::path(localFile).filename().string();
+
+    const auto read = [&file](char* data, std::size_t size) -> std::int64_t
+    {
+        file.read(data, static_cast<std::streamsize>(size));
+        return file.bad() ? -1 : static_cast<std::int64_t>(file.gcount());
+    };
+    return makeResponse(*ftp, upload(*ftp, remoteFile, mode, append, 0, nullptr, nullptr, read));
+}
+
+
+////////////////////////////////////////////////////////////
+sfFtpResponse* sfFtp_downloadToCallback(sfFtp*                ftp,
+                                        const char*           remoteFile,
+                                        sfFtpTransferMode     mode,
+                                        sfFtpDataCallback     onData,
+                                        sfFtpProgressCallback onProgress,
+                                        void*                 userData)
+{
+    assert(ftp);
+    return makeResponse(*ftp,
+                        download(*ftp,
+                                 remoteFile,
+                                 mode,
+                                 onProgress,
+                                 userData,
+                                 [&](const char* data, std::size_t size)
+                                 { return !onData || onData(data, size, userData); }));
+}
+
+
+////////////////////////////////////////////////////////////
+sfFtpResponse* sfFtp_downloadToBuffer(sfFtp*                ftp,
+                                      const char*           remoteFile,
+                                      sfFtpTransferMode     mode,
+                                      sfBuffer*             buffer,
+                                      sfFtpProgressCallback onProgress,
+                                      void*                 userData)
+{
+    assert(ftp);
+    assert(buffer);
+
+    buffer->clear();
+
+    bool       outOfMemory = false;
+    const auto fill        = [buffer, &outOfMemory](const char* data, std::size_t size)
+    {
+        try
+        {
+            buffer->insert(buffer->end(), data, data + size);
+            return true;
+        }
+        catch (const std::bad_alloc&)
+        {
+            outOfMemory = true;
+            return false;
+        }
+    };
+
+    sf::Ftp::Response response = download(*ftp, remoteFile, mode, onProgress, userData, fill);
+
+    // The download was aborted because the buffer couldn't grow
+    if (outOfMemory && response.getStatus() == sf::Ftp::Response::Status::TransferAborted)
+        response = sf::Ftp::Response(sf::Ftp::Response::Status::InsufficientStorageSpace);
+    return makeResponse(*ftp, std::move(response));
+}
+
+
+////////////////////////////////////////////////////////////
+sfFtpResponse* sfFtp_uploadFromStream(sfFtp*                ftp,
+                                      sfInputStream*        stream,
+                                      const char*           remotePath,
+                                      sfFtpTransferMode     mode,
+                                      bool                  append,
+                                      sfFtpProgressCallback onProgress,
+                                      void*                 userData)
+{
+    assert(ftp);
+    assert(stream);
+    assert(stream->read);
+
+    if (stream->seek && stream->seek(0, stream->userData) != 0)
+        return makeResponse(*ftp, sf::Ftp::Response(sf::Ftp::Response::Status::InvalidFile));
+
+    const std::int64_t  size  = stream->getSize ? stream->getSize(stream->userData) : -1;
+    const std::uint64_t total = size > 0 ? static_cast<std::uint64_t>(size) : 0;
+
+    const auto read = [stream](char* data, std::size_t size) { return stream->read(data, size, stream->userData); };
+    return makeResponse(*ftp,
+                        upload(*ftp, remotePath ? remotePath : "", mode, append, total, onProgress, userData, read));
 }
 
 
@@ -332,5 +799,5 @@ sfFtpResponse* sfFtp_upload(sfFtp* ftp, const char* localFile, const char* remot
 sfFtpResponse* sfFtp_sendCommand(sfFtp* ftp, const char* command, const char* parameter)
 {
     assert(ftp);
-    return new sfFtpResponse{ftp->sendCommand(command ? command : "", parameter ? parameter : "")};
+    return makeResponse(*ftp, sendCommand(*ftp, command ? command : "", parameter ? parameter : ""));
 }
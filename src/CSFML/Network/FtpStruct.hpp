@@ -27,21 +27,41 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/Network/TcpSocketStruct.hpp>
+#include <CSFML/Network/Types.h>
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Network/Ftp.hpp>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtp
 ////////////////////////////////////////////////////////////
-struct sfFtp : sf::Ftp
+struct sfFtp : Allocated<sfAllocModuleNetwork>
 {
+    sfFtp() = default;
+    sfFtp(const sfFtp&) = delete;
+    sfFtp& operator=(const sfFtp&) = delete;
+    ~sfFtp();
+
+    std::vector<std::unique_ptr<sfFtpResponse>>          ReleasedResponses;
+    std::vector<std::unique_ptr<sfFtpDirectoryResponse>> ReleasedDirectoryResponses;
+    std::vector<std::unique_ptr<sfFtpListingResponse>>   ReleasedListingResponses;
+
+    // Control connection, which the transfers use to read the reply ending them
+    sfTcpSocket Connection;
+    std::string Received; // Data received after the last reply read
 };
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtpResponse
 ////////////////////////////////////////////////////////////
-struct sfFtpResponse : sf::Ftp::Response
+struct sfFtpResponse : sf::Ftp::Response, Allocated<sfAllocModuleNetwork>
 {
 };
 
@@ -49,7 +69,7 @@ struct sfFtpResponse : sf::Ftp::Response
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtpDirectoryResponse
 ////////////////////////////////////////////////////////////
-struct sfFtpDirectoryResponse : sf::Ftp::DirectoryResponse
+struct sfFtpDirectoryResponse : sf::Ftp::DirectoryResponse, Allocated<sfAllocModuleNetwork>
 {
 };
 
@@ -57,6 +77,7 @@ struct sfFtpDirectoryResponse : sf::Ftp::DirectoryResponse
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtpListingResponse
 ////////////////////////////////////////////////////////////
-struct sfFtpListingResponse : sf::Ftp::ListingResponse
+struct sfFtpListingResponse : sf::Ftp::ListingResponse, Allocated<sfAllocModuleNetwork>
 {
 };
+
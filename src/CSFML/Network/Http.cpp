@@ -28,6 +28,629 @@
 #include <CSFML/Network/Http.h>
 #include <CSFML/Network/HttpStruct.hpp>
 
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include <cassert>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#if !defined(CSFML_SYSTEM_WINDOWS)
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Maximum size of the data received at once, and of the parts of streamed bodies
+////////////////////////////////////////////////////////////
+constexpr std::size_t receiveSize = 16384;
+
+
+////////////////////////////////////////////////////////////
+// Time between two checks for the cancellation of a request, in microseconds
+////////////////////////////////////////////////////////////
+constexpr std::int64_t cancellationStep = 20'000;
+
+
+////////////////////////////////////////////////////////////
+std::string toLower(std::string string)
+{
+    for (char& character : string)
+        character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+    return string;
+}
+
+
+////////////////////////////////////////////////////////////
+// Give a response its initial state, where the connection failed
+////////////////////////////////////////////////////////////
+void resetResponse(sfHttpResponse& response)
+{
+    response.Fields.clear();
+    response.Status       = sfHttpConnectionFailed;
+    response.MajorVersion = 0;
+    response.MinorVersion = 0;
+    response.Body.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+// Create a response, reusing one released to the sfHttp if possible
+////////////////////////////////////////////////////////////
+sfHttpResponse* makeResponse(sfHttp& http)
+{
+    if (http.ReleasedResponses.empty())
+        return new sfHttpResponse;
+
+    sfHttpResponse* recycled = http.ReleasedResponses.back().release();
+    http.ReleasedResponses.pop_back();
+    resetResponse(*recycled);
+    return recycled;
+}
+
+
+////////////////////////////////////////////////////////////
+// Requests which may be sent again when the connection fails before their response
+////////////////////////////////////////////////////////////
+bool isIdempotent(const sfHttpRequest& request)
+{
+    return request.Method != sfHttpPost;
+}
+
+
+////////////////////////////////////////////////////////////
+bool isHeadRequest(const sfHttpRequest& request)
+{
+    return request.Method == sfHttpHead;
+}
+
+
+////////////////////////////////////////////////////////////
+// Write a request with the missing mandatory fields, as sf::Http does, asking the server
+// to keep the connection open in persistent mode
+////////////////////////////////////////////////////////////
+std::string prepareRequest(const sfHttp& http, const sfHttpRequest& request)
+{
+    static constexpr std::array<const char*, 5> methods = {"GET", "POST", "HEAD", "PUT", "DELETE"};
+
+    std::string data = methods[static_cast<std::size_t>(request.Method)];
+    data += ' ' + request.Uri + " HTTP/" + std::to_string(request.MajorVersion) + '.' +
+            std::to_string(request.MinorVersion) + "\r\n";
+
+    const auto hasField = [&request](const char* name) { return request.Fields.find(name) != request.Fields.end(); };
+    const auto addField = [&data](const std::string& name, const std::string& value)
+    { data += name + ": " + value + "\r\n"; };
+
+    for (const auto& [name, value] : request.Fields)
+        addField(name, value);
+    if (!hasField("from"))
+        addField("from", "user@sfml-dev.org");
+    if (!hasField("user-agent"))
+        addField("user-agent", "libsfml-network/3.x");
+    if (!hasField("host"))
+        addField("host", http.HostName);
+    if (!hasField("content-length"))
+        addField("content-length", std::to_string(request.Body.size()));
+    if (request.Method == sfHttpPost && !hasField("content-type"))
+        addField("content-type", "application/x-www-form-urlencoded");
+    if (!hasField("connection"))
+        addField("connection", http.Persistent ? "keep-alive" : "close");
+
+    data += "\r\n";
+    data += request.Body;
+    return data;
+}
+
+
+////////////////////////////////////////////////////////////
+void disconnect(sfHttp& http)
+{
+    http.Connection.disconnect();
+    http.Connected = false;
+    http.Received.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool isCancelled(const sfHttp& http)
+{
+    return http.Cancelled && *http.Cancelled;
+}
+
+
+////////////////////////////////////////////////////////////
+// Wait until ready(wait) returns true, for at most timeout unless it is zero; a request
+// which can be cancelled waits in steps, checking for its cancellation in between
+////////////////////////////////////////////////////////////
+template <typename Ready>
+bool waitInSteps(const sfHttp& http, sf::Time timeout, Ready&& ready)
+{
+    std::int64_t remaining = timeout.asMicroseconds();
+    for (;;)
+    {
+        if (isCancelled(http))
+            return false;
+
+        std::int64_t wait = remaining;
+        if (http.Cancelled && (wait == 0 || wait > cancellationStep))
+            wait = cancellationStep;
+        if (ready(sf::microseconds(wait)))
+            return true;
+        if (remaining != 0 && (remaining -= wait) <= 0)
+            return false;
+    }
+}
+
+
+#if !defined(CSFML_SYSTEM_WINDOWS)
+////////////////////////////////////////////////////////////
+// Wait until the connection can be written to, or failed
+////////////////////////////////////////////////////////////
+bool waitWritable(sfHttp& http, sf::Time timeout)
+{
+    pollfd descriptor{http.Connection.getNativeHandle(), POLLOUT, 0};
+    return waitInSteps(http,
+                       timeout,
+                       [&descriptor](sf::Time wait)
+                       {
+                           const int milliseconds = wait == sf::Time::Zero ? -1 : static_cast<int>(wait.asMilliseconds());
+                           const int ready        = ::poll(&descriptor, 1, milliseconds);
+                           return ready > 0 || (ready < 0 && errno != EINTR);
+                       });
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Open a new connection to the host; a request which can be cancelled
+// connects without blocking, and waits for the connection in steps
+////////////////////////////////////////////////////////////
+bool openConnection(sfHttp& http, sf::Time timeout)
+{
+    if (!http.Host)
+        return false;
+
+#if !defined(CSFML_SYSTEM_WINDOWS)
+    if (http.Cancelled)
+    {
+        http.Connection.setBlocking(false);
+        sf::Socket::Status status = http.Connection.connect(*http.Host, http.Port);
+        if (status == sf::Socket::Status::NotReady && waitWritable(http, timeout))
+        {
+            int       error = 0;
+            socklen_t size  = sizeof(error);
+            if (getsockopt(http.Connection.getNativeHandle(), SOL_SOCKET, SO_ERROR, &error, &size) == 0 && error == 0)
+                status = sf::Socket::Status::Done;
+        }
+        http.Connection.setBlocking(true);
+
+        if (status != sf::Socket::Status::Done)
+            http.Connection.disconnect();
+        return status == sf::Socket::Status::Done;
+    }
+#endif
+
+    return http.Connection.connect(*http.Host, http.Port, timeout) == sf::Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+// Reuse the open connection if the server didn't close it while it was idle, or open a new one
+////////////////////////////////////////////////////////////
+bool connect(sfHttp& http, sf::Time timeout, bool& reused)
+{
+    reused = false;
+    if (isCancelled(http))
+        return false;
+
+    if (http.Connected && http.Received.empty())
+    {
+        char        byte     = 0;
+        std::size_t received = 0;
+        http.Connection.setBlocking(false);
+        const sf::Socket::Status status = http.Connection.receive(&byte, 1, received);
+        http.Connection.setBlocking(true);
+
+        reused = status == sf::Socket::Status::NotReady;
+        if (reused)
+            return true;
+    }
+
+    disconnect(http);
+    if (!openConnection(http, timeout))
+        return false;
+
+    http.Connected = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+// Send data over the connection; a request which can be cancelled
+// sends without blocking, and waits for room in steps
+////////////////////////////////////////////////////////////
+bool send(sfHttp& http, const std::string& data, sf::Time timeout)
+{
+#if !defined(CSFML_SYSTEM_WINDOWS)
+    if (http.Cancelled)
+    {
+        http.Connection.setBlocking(false);
+        std::size_t        offset = 0;
+        sf::Socket::Status status = sf::Socket::Status::NotReady;
+        while (status == sf::Socket::Status::NotReady || status == sf::Socket::Status::Partial)
+        {
+            std::size_t sent = 0;
+            status           = http.Connection.send(data.data() + offset, data.size() - offset, sent);
+            offset += sent;
+            if (status != sf::Socket::Status::Done && !waitWritable(http, timeout))
+                break;
+        }
+        http.Connection.setBlocking(true);
+        return status == sf::Socket::Status::Done;
+    }
+#endif
+
+    return http.Connection.send(data.data(), data.size()) == sf::Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+// Append the next data of the connection to the received data, waiting at most timeout unless it is zero;
+// only a connection closed by the server reports Disconnected, a timeout or a cancellation report NotReady
+////////////////////////////////////////////////////////////
+sf::Socket::Status receive(sfHttp& http, sf::Time timeout)
+{
+    if (timeout != sf::Time::Zero || http.Cancelled)
+    {
+        sf::SocketSelector selector;
+        selector.add(http.Connection);
+        if (!waitInSteps(http, timeout, [&selector](sf::Time wait) { return selector.wait(wait); }))
+            return sf::Socket::Status::NotReady;
+    }
+
+    std::array<char, receiveSize> buffer{};
+    std::size_t                   received = 0;
+    const sf::Socket::Status      status   = http.Connection.receive(buffer.data(), buffer.size(), received);
+    if (status == sf::Socket::Status::Done)
+        http.Received.append(buffer.data(), received);
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+// Parse the size at the start of a line of a chunked body
+////////////////////////////////////////////////////////////
+bool parseChunkSize(const std::string& line, std::size_t& size)
+{
+    size = 0;
+    std::size_t digits = 0;
+    for (; digits < line.size() && std::isxdigit(static_cast<unsigned char>(line[digits])); ++digits)
+    {
+        if (size > (std::numeric_limits<std::size_t>::max() >> 4))
+            return false;
+
+        const char digit = static_cast<char>(std::tolower(static_cast<unsigned char>(line[digits])));
+        size = size << 4 | static_cast<std::size_t>(digit <= '9' ? digit - '0' : digit - 'a' + 10);
+    }
+
+    return digits > 0;
+}
+
+
+////////////////////////////////////////////////////////////
+// How the body of a response ends, as in RFC 9112 section 6.3
+////////////////////////////////////////////////////////////
+struct ResponseHeader
+{
+    bool                       HasBody{};
+    bool                       Chunked{};
+    std::optional<std::size_t> ContentLength; // Otherwise the body ends when the server closes the connection
+    bool                       KeepAlive{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Parse the status line and the fields of a response header, which ends at headerEnd
+////////////////////////////////////////////////////////////
+bool parseHeader(const std::string& data, std::size_t headerEnd, sfHttpResponse& response)
+{
+    unsigned int majorVersion = 0;
+    unsigned int minorVersion = 0;
+    unsigned int status       = 0;
+    if (std::sscanf(data.c_str(), "HTTP/%u.%u %u", &majorVersion, &minorVersion, &status) != 3 || status < 100 ||
+        status > 999)
+    {
+        response.Status = sfHttpInvalidResponse;
+        return false;
+    }
+
+    response.Status       = static_cast<sfHttpStatus>(status);
+    response.MajorVersion = majorVersion;
+    response.MinorVersion = minorVersion;
+
+    for (std::size_t line = data.find("\r\n") + 2; line < headerEnd;)
+    {
+        const std::size_t lineEnd = data.find("\r\n", line);
+        const std::size_t colon   = data.find(':', line);
+        if (colon < lineEnd)
+        {
+            std::string value = data.substr(colon + 1, lineEnd - colon - 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            value.erase(value.find_last_not_of(" \t") + 1);
+
+            // Repeated fields are combined into a list
+            std::string& field = response.Fields[toLower(data.substr(line, colon - line))];
+            field += field.empty() ? value : ", " + value;
+        }
+        line = lineEnd + 2;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+// Lower case value of a field of a response, or the empty string
+////////////////////////////////////////////////////////////
+std::string getField(const sfHttpResponse& response, const char* name)
+{
+    const auto it = response.Fields.find(name);
+    return it != response.Fields.end() ? toLower(it->second) : std::string();
+}
+
+
+////////////////////////////////////////////////////////////
+// Receive the header of the next final response into a response, skipping the informational ones
+////////////////////////////////////////////////////////////
+std::optional<ResponseHeader> readHeader(sfHttp& http, bool isHead, sf::Time timeout, sfHttpResponse& response)
+{
+    for (;;)
+    {
+        std::size_t headerEnd = http.Received.find("\r\n\r\n");
+        while (headerEnd == std::string::npos)
+        {
+            if (receive(http, timeout) != sf::Socket::Status::Done)
+                return std::nullopt;
+            headerEnd = http.Received.find("\r\n\r\n");
+        }
+
+        resetResponse(response);
+        const bool valid = parseHeader(http.Received, headerEnd, response);
+        http.Received.erase(0, headerEnd + 4);
+
+        // Invalid responses have no body, and their connection is closed
+        ResponseHeader header;
+        if (!valid)
+            return header;
+
+        if (response.Status < sfHttpOk)
+            continue;
+
+        const std::string contentLength = getField(response, "content-length");
+        if (!contentLength.empty())
+            header.ContentLength = static_cast<std::size_t>(std::strtoull(contentLength.c_str(), nullptr, 10));
+        header.Chunked = getField(response, "transfer-encoding").find("chunked") != std::string::npos;
+
+        const std::string connection = getField(response, "connection");
+        header.HasBody = !isHead && response.Status != sfHttpNoContent && response.Status != sfHttpNotModified;
+        header.KeepAlive             = response.MajorVersion * 10 + response.MinorVersion >= 11
+                                           ? connection.find("close") == std::string::npos
+                                           : connection.find("keep-alive") != std::string::npos;
+        if (header.HasBody && !header.Chunked && !header.ContentLength)
+            header.KeepAlive = false;
+
+        return header;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Receive the body of a response, which follows its header, and pass it to
+// a sink as it arrives; the sink returns false to stop. Only the data not
+// passed to the sink yet is kept, so the memory used doesn't depend on the
+// size of the body
+////////////////////////////////////////////////////////////
+template <typename Sink>
+bool readBody(sfHttp& http, const ResponseHeader& header, sf::Time timeout, Sink&& sink)
+{
+    // Pass the data received, up to size bytes, and return the number of bytes passed
+    const auto deliver = [&](std::size_t size, std::size_t& delivered)
+    {
+        if (http.Received.empty() && receive(http, timeout) != sf::Socket::Status::Done)
+            return false;
+
+        delivered = std::min({size, http.Received.size(), receiveSize});
+        if (!sink(http.Received.data(), delivered))
+            return false;
+
+        http.Received.erase(0, delivered);
+        return true;
+    };
+
+    if (!header.HasBody)
+        return true;
+
+    if (header.Chunked)
+    {
+        for (;;)
+        {
+            std::size_t lineEnd = http.Received.find("\r\n");
+            while (lineEnd == std::string::npos)
+            {
+                if (receive(http, timeout) != sf::Socket::Status::Done)
+                    return false;
+                lineEnd = http.Received.find("\r\n");
+            }
+
+            std::size_t size = 0;
+            if (!parseChunkSize(http.Received, size))
+                return false;
+            http.Received.erase(0, lineEnd + 2);
+
+            if (size == 0)
+                break;
+
+            for (std::size_t delivered = 0; size > 0; size -= delivered)
+            {
+                if (!deliver(size, delivered))
+                    return false;
+            }
+
+            while (http.Received.size() < 2)
+            {
+                if (receive(http, timeout) != sf::Socket::Status::Done)
+                    return false;
+            }
+            if (http.Received.compare(0, 2, "\r\n") != 0)
+                return false;
+            http.Received.erase(0, 2);
+        }
+
+        // The trailer fields, if any, end with an empty line
+        for (;;)
+        {
+            if (http.Received.compare(0, 2, "\r\n") == 0)
+            {
+                http.Received.erase(0, 2);
+                return true;
+            }
+
+            const std::size_t trailerEnd = http.Received.find("\r\n\r\n");
+            if (trailerEnd != std::string::npos)
+            {
+                http.Received.erase(0, trailerEnd + 4);
+                return true;
+            }
+
+            if (receive(http, timeout) != sf::Socket::Status::Done)
+                return false;
+        }
+    }
+
+    if (header.ContentLength)
+    {
+        for (std::size_t size = *header.ContentLength, delivered = 0; size > 0; size -= delivered)
+        {
+            if (!deliver(size, delivered))
+                return false;
+        }
+        return true;
+    }
+
+    // The body ends when the server closes the connection, any other failure leaves it incomplete
+    for (std::size_t delivered = 0;;)
+    {
+        if (!http.Received.empty() && !deliver(http.Received.size(), delivered))
+            return false;
+
+        const sf::Socket::Status status = receive(http, timeout);
+        if (status != sf::Socket::Status::Done)
+            return status == sf::Socket::Status::Disconnected;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Receive the next response from the connection
+////////////////////////////////////////////////////////////
+bool readResponse(sfHttp& http, bool isHead, sf::Time timeout, sfHttpResponse& response, bool& keepAlive)
+{
+    const std::optional<ResponseHeader> header = readHeader(http, isHead, timeout, response);
+    if (!header)
+        return false;
+
+    keepAlive = header->KeepAlive;
+    return readBody(http,
+                    *header,
+                    timeout,
+                    [&response](const char* data, std::size_t size)
+                    {
+                        response.Body.append(data, size);
+                        return true;
+                    });
+}
+
+
+////////////////////////////////////////////////////////////
+// Send requests over the persistent connection, pipelining them when
+// possible, or over a connection per request outside of persistent mode
+////////////////////////////////////////////////////////////
+void sendRequests(sfHttp&                     http,
+                  const sfHttpRequest* const* requests,
+                  std::size_t                 count,
+                  sfHttpResponse* const*      responses,
+                  sf::Time                    timeout)
+{
+    std::size_t next = 0;
+    while (next < count)
+    {
+        bool reused = false;
+        if (!connect(http, timeout, reused))
+            return;
+
+        // Idempotent requests are pipelined; the others are sent alone, as they
+        // can't be sent again if the connection fails before their response
+        std::size_t last = next + 1;
+        if (http.Persistent && isIdempotent(*requests[next]))
+        {
+            while (last < count && isIdempotent(*requests[last]))
+                ++last;
+        }
+
+        std::string data;
+        for (std::size_t i = next; i < last; ++i)
+            data += prepareRequest(http, *requests[i]);
+
+        std::size_t answered = next;
+        bool        failed   = !send(http, data, timeout);
+        while (!failed && answered < last)
+        {
+            bool keepAlive = false;
+            if (!readResponse(http, isHeadRequest(*requests[answered]), timeout, *responses[answered], keepAlive))
+            {
+                resetResponse(*responses[answered]);
+                failed = true;
+                break;
+            }
+
+            ++answered;
+
+            // The requests sent after it weren't processed, they are sent again on a new connection
+            if (!keepAlive || !http.Persistent)
+            {
+                disconnect(http);
+                break;
+            }
+        }
+
+        if (failed)
+        {
+            disconnect(http);
+
+            // Without any response, only a connection which was already open may have been closed by the
+            // server just before the requests; otherwise the first request fails and keeps the default
+            // sfHttpConnectionFailed status
+            if (answered == next && !(reused && isIdempotent(*requests[next])))
+                ++answered;
+        }
+
+        next = answered;
+    }
+}
+} // namespace
+
 
 ////////////////////////////////////////////////////////////
 sfHttpRequest* sfHttpRequest_create()
@@ -48,7 +671,7 @@ void sfHttpRequest_setField(sfHttpRequest* httpRequest, const char* field, const
 {
     assert(httpRequest);
     if (field)
-        httpRequest->setField(field, value);
+        httpRequest->Fields[toLower(field)] = value ? value : "";
 }
 
 
@@ -56,7 +679,7 @@ void sfHttpRequest_setField(sfHttpRequest* httpRequest, const char* field, const
 void sfHttpRequest_setMethod(sfHttpRequest* httpRequest, sfHttpMethod method)
 {
     assert(httpRequest);
-    httpRequest->setMethod(static_cast<sf::Http::Request::Method>(method));
+    httpRequest->Method = method;
 }
 
 
@@ -64,7 +687,9 @@ void sfHttpRequest_setMethod(sfHttpRequest* httpRequest, sfHttpMethod method)
 void sfHttpRequest_setUri(sfHttpRequest* httpRequest, const char* uri)
 {
     assert(httpRequest);
-    httpRequest->setUri(uri ? uri : "");
+    httpRequest->Uri = uri ? uri : "";
+    if (httpRequest->Uri.empty() || httpRequest->Uri.front() != '/')
+        httpRequest->Uri.insert(httpRequest->Uri.begin(), '/');
 }
 
 
@@ -72,7 +697,8 @@ void sfHttpRequest_setUri(sfHttpRequest* httpRequest, const char* uri)
 void sfHttpRequest_setHttpVersion(sfHttpRequest* httpRequest, unsigned int major, unsigned int minor)
 {
     assert(httpRequest);
-    httpRequest->setHttpVersion(major, minor);
+    httpRequest->MajorVersion = major;
+    httpRequest->MinorVersion = minor;
 }
 
 
@@ -80,7 +706,7 @@ void sfHttpRequest_setHttpVersion(sfHttpRequest* httpRequest, unsigned int major
 void sfHttpRequest_setBody(sfHttpRequest* httpRequest, const char* body)
 {
     assert(httpRequest);
-    httpRequest->setBody(body ? body : "");
+    httpRequest->Body = body ? body : "";
 }
 
 
@@ -98,7 +724,8 @@ const char* sfHttpResponse_getField(const sfHttpResponse* httpResponse, const ch
     if (!field)
         return nullptr;
 
-    return httpResponse->getField(field).c_str();
+    const auto it = httpResponse->Fields.find(toLower(field));
+    return it != httpResponse->Fields.end() ? it->second.c_str() : "";
 }
 
 
@@ -106,7 +733,7 @@ const char* sfHttpResponse_getField(const sfHttpResponse* httpResponse, const ch
 sfHttpStatus sfHttpResponse_getStatus(const sfHttpResponse* httpResponse)
 {
     assert(httpResponse);
-    return static_cast<sfHttpStatus>(httpResponse->getStatus());
+    return httpResponse->Status;
 }
 
 
@@ -114,7 +741,7 @@ sfHttpStatus sfHttpResponse_getStatus(const sfHttpResponse* httpResponse)
 unsigned int sfHttpResponse_getMajorVersion(const sfHttpResponse* httpResponse)
 {
     assert(httpResponse);
-    return httpResponse->getMajorHttpVersion();
+    return httpResponse->MajorVersion;
 }
 
 
@@ -122,7 +749,7 @@ unsigned int sfHttpResponse_getMajorVersion(const sfHttpResponse* httpResponse)
 unsigned int sfHttpResponse_getMinorVersion(const sfHttpResponse* httpResponse)
 {
     assert(httpResponse);
-    return httpResponse->getMinorHttpVersion();
+    return httpResponse->MinorVersion;
 }
 
 
@@ -130,7 +757,7 @@ unsigned int sfHttpResponse_getMinorVersion(const sfHttpResponse* httpResponse)
 const char* sfHttpResponse_getBody(const sfHttpResponse* httpResponse)
 {
     assert(httpResponse);
-    return httpResponse->getBody().c_str();
+    return httpResponse->Body.c_str();
 }
 
 
@@ -152,7 +779,38 @@ void sfHttp_destroy(const sfHttp* http)
 void sfHttp_setHost(sfHttp* http, const char* host, unsigned short port)
 {
     assert(http);
-    http->setHost(host ? host : "", port);
+    disconnect(*http);
+
+    // HTTPS is not supported, as with sf::Http the host is cleared so that requests fail
+    std::string hostName = host ? host : "";
+    const auto  protocol = toLower(hostName.substr(0, 8));
+    if (protocol == "https://")
+    {
+        http->Host.reset();
+        http->HostName.clear();
+        http->Port = 0;
+        return;
+    }
+
+    if (protocol.compare(0, 7, "http://") == 0)
+        hostName.erase(0, 7);
+    if (!hostName.empty() && hostName.back() == '/')
+        hostName.pop_back();
+
+    http->Host     = sf::IpAddress::resolve(hostName);
+    http->HostName = std::move(hostName);
+    http->Port     = port != 0 ? port : 80;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfHttp_setPersistent(sfHttp* http, bool persistent)
+{
+    assert(http);
+
+    http->Persistent = persistent;
+    if (!persistent)
+        disconnect(*http);
 }
 
 
@@ -161,5 +819,96 @@ sfHttpResponse* sfHttp_sendRequest(sfHttp* http, const sfHttpRequest* request, s
 {
     assert(http);
     assert(request);
-    return new sfHttpResponse{http->sendRequest(*request, sf::microseconds(timeout.microseconds))};
+
+    sfHttpResponse* response = nullptr;
+    sfHttp_sendRequests(http, &request, 1, &response, timeout);
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+sfHttpResponse* sfHttp_sendRequestStreaming(sfHttp*                 http,
+                                            const sfHttpRequest*    request,
+                                            sfHttpHeadersCallback   onHeaders,
+                                            sfHttpBodyChunkCallback onBodyChunk,
+                                            void*                   userData,
+                                            sfTime                  timeout)
+{
+    assert(http);
+    assert(request);
+
+    const sf::Time  sfmlTimeout = sf::microseconds(timeout.microseconds);
+    sfHttpResponse* response    = makeResponse(*http);
+
+    // A persistent connection may have been closed by the server just before the request
+    std::optional<ResponseHeader> header;
+    for (bool retry = true; !header && retry;)
+    {
+        bool reused = false;
+        if (!connect(*http, sfmlTimeout, reused))
+            return response;
+
+        const std::string data = prepareRequest(*http, *request);
+        if (send(*http, data, sfmlTimeout))
+            header = readHeader(*http, isHeadRequest(*request), sfmlTimeout, *response);
+
+        if (!header)
+            disconnect(*http);
+        retry = reused && isIdempotent(*request);
+    }
+
+    if (!header)
+    {
+        resetResponse(*response);
+        return response;
+    }
+
+    if (onHeaders && !onHeaders(response, userData))
+    {
+        disconnect(*http);
+        return response;
+    }
+
+    const bool complete = readBody(*http,
+                                   *header,
+                                   sfmlTimeout,
+                                   [&](const char* data, std::size_t size)
+                                   { return !onBodyChunk || onBodyChunk(data, size, userData); });
+    if (!complete)
+    {
+        disconnect(*http);
+        resetResponse(*response);
+    }
+    else if (!header->KeepAlive || !http->Persistent)
+    {
+        disconnect(*http);
+    }
+
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfHttp_sendRequests(sfHttp*                     http,
+                         const sfHttpRequest* const* requests,
+                         size_t                      count,
+                         sfHttpResponse**            responses,
+                         sfTime                      timeout)
+{
+    assert(http);
+    assert((requests && responses) || count == 0);
+
+    for (std::size_t i = 0; i < count; ++i)
+        responses[i] = makeResponse(*http);
+
+    sendRequests(*http, requests, count, responses, sf::microseconds(timeout.microseconds));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfHttp_releaseResponse(sfHttp* http, sfHttpResponse* httpResponse)
+{
+    assert(http);
+    if (httpResponse)
+        http->ReleasedResponses.emplace_back(httpResponse);
 }
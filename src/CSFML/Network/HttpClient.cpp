@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/HttpClient.h>
+#include <CSFML/Network/HttpClientStruct.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include <cassert>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Stop counting the connection of a worker against its host, which leaves room for another
+// connection to it; must be called with the mutex of the client locked
+////////////////////////////////////////////////////////////
+void releaseConnection(sfHttpClient& client, sfHttpClientWorker& worker)
+{
+    if (worker.HostKey.empty())
+        return;
+
+    const auto connections = client.Connections.find(worker.HostKey);
+    if (--connections->second == 0)
+        client.Connections.erase(connections);
+    worker.HostKey.clear();
+    client.WorkAvailable.notify_all();
+}
+
+
+////////////////////////////////////////////////////////////
+// Take the oldest queued request which the worker is allowed to send, moving its connection to the
+// host of the request if needed; must be called with the mutex of the client locked
+////////////////////////////////////////////////////////////
+std::shared_ptr<sfHttpClientTask> takeTask(sfHttpClient& client, sfHttpClientWorker& worker)
+{
+    for (auto it = client.Queue.begin(); it != client.Queue.end();)
+    {
+        const std::shared_ptr<sfHttpClientTask> task = *it;
+        if (task->HostKey != worker.HostKey && !task->Cancelled)
+        {
+            const auto connections = client.Connections.find(task->HostKey);
+            if (connections != client.Connections.end() && connections->second >= client.MaxConnectionsPerHost)
+            {
+                ++it;
+                continue;
+            }
+        }
+
+        it = client.Queue.erase(it);
+        {
+            const std::lock_guard lock(task->Mutex);
+            if (task->Status != sfHttpFuturePending)
+                continue;
+            task->Status = sfHttpFutureRunning;
+        }
+
+        if (task->HostKey != worker.HostKey)
+        {
+            releaseConnection(client, worker);
+            ++client.Connections[task->HostKey];
+            worker.HostKey = task->HostKey;
+        }
+
+        worker.Task = task;
+        return task;
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+// Send the requests taken from the queue until the client stops
+////////////////////////////////////////////////////////////
+void runWorker(sfHttpClient& client, sfHttpClientWorker& worker)
+{
+    std::string httpHostKey; // Host set to the Http object, which is only used by this thread
+    for (;;)
+    {
+        std::shared_ptr<sfHttpClientTask> task;
+        {
+            std::unique_lock lock(client.Mutex);
+            client.WorkAvailable.wait(lock, [&] { return client.Stopping || (task = takeTask(client, worker)); });
+            if (!task)
+                return;
+        }
+
+        if (httpHostKey != task->HostKey)
+        {
+            sfHttp_setHost(&worker.Http, task->Host.c_str(), task->Port);
+            httpHostKey = task->HostKey;
+        }
+
+        worker.Http.Cancelled = &task->Cancelled;
+        std::unique_ptr<sfHttpResponse> response(sfHttp_sendRequest(&worker.Http, &task->Request, task->Timeout));
+        worker.Http.Cancelled = nullptr;
+
+        {
+            const std::lock_guard lock(task->Mutex);
+            if (task->Status == sfHttpFutureRunning)
+            {
+                task->Status   = sfHttpFutureReady;
+                task->Response = std::move(response);
+            }
+        }
+        task->StatusChanged.notify_all();
+
+        const std::lock_guard lock(client.Mutex);
+        worker.Task.reset();
+        if (!worker.Http.Connected)
+            releaseConnection(client, worker);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Cancel a request which has no response yet
+////////////////////////////////////////////////////////////
+bool cancel(sfHttpClientTask& task)
+{
+    task.Cancelled = true;
+    {
+        const std::lock_guard lock(task.Mutex);
+        if (task.Status != sfHttpFuturePending && task.Status != sfHttpFutureRunning)
+            return false;
+        task.Status = sfHttpFutureCancelled;
+    }
+    task.StatusChanged.notify_all();
+    return true;
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+sfHttpClient::~sfHttpClient()
+{
+    {
+        const std::lock_guard lock(Mutex);
+        Stopping = true;
+        for (const std::shared_ptr<sfHttpClientTask>& task : Queue)
+            cancel(*task);
+        Queue.clear();
+        for (const std::unique_ptr<sfHttpClientWorker>& worker : Workers)
+        {
+            if (worker->Task)
+                cancel(*worker->Task);
+        }
+    }
+    WorkAvailable.notify_all();
+
+    for (const std::unique_ptr<sfHttpClientWorker>& worker : Workers)
+    {
+        if (worker->Thread.joinable())
+            worker->Thread.join();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfHttpClient* sfHttpClient_create(size_t workerCount, size_t maxConnectionsPerHost)
+{
+    auto client                   = std::make_unique<sfHttpClient>();
+    client->MaxConnectionsPerHost = std::max<std::size_t>(maxConnectionsPerHost, 1);
+
+    client->Workers.resize(std::max<std::size_t>(workerCount, 1));
+    for (std::unique_ptr<sfHttpClientWorker>& worker : client->Workers)
+    {
+        worker                  = std::make_unique<sfHttpClientWorker>();
+        worker->Http.Persistent = true;
+    }
+
+    for (const std::unique_ptr<sfHttpClientWorker>& worker : client->Workers)
+        worker->Thread = std::thread(runWorker, std::ref(*client), std::ref(*worker));
+
+    return client.release();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfHttpClient_destroy(const sfHttpClient* client)
+{
+    delete client;
+}
+
+
+////////////////////////////////////////////////////////////
+sfHttpFuture* sfHttpClient_submit(sfHttpClient*        client,
+                                  const char*          host,
+                                  unsigned short       port,
+                                  const sfHttpRequest* request,
+                                  sfTime               timeout)
+{
+    assert(client);
+    assert(host);
+    assert(request);
+
+    auto task     = std::make_shared<sfHttpClientTask>();
+    task->Host    = host;
+    task->Port    = port;
+    task->HostKey = task->Host + ':' + std::to_string(port);
+    task->Request = *request;
+    task->Timeout = timeout;
+
+    {
+        const std::lock_guard lock(client->Mutex);
+        client->Queue.push_back(task);
+    }
+    client->WorkAvailable.notify_all();
+
+    auto* future = new sfHttpFuture;
+    future->Task = std::move(task);
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfHttpFuture_destroy(const sfHttpFuture* future)
+{
+    if (future)
+        cancel(*future->Task);
+    delete future;
+}
+
+
+////////////////////////////////////////////////////////////
+sfHttpFutureStatus sfHttpFuture_getStatus(const sfHttpFuture* future)
+{
+    assert(future);
+
+    const std::lock_guard lock(future->Task->Mutex);
+    return future->Task->Status;
+}
+
+
+////////////////////////////////////////////////////////////
+sfHttpFutureStatus sfHttpFuture_wait(sfHttpFuture* future, sfTime timeout)
+{
+    assert(future);
+
+    sfHttpClientTask& task     = *future->Task;
+    const auto        finished = [&task]
+    { return task.Status == sfHttpFutureReady || task.Status == sfHttpFutureCancelled; };
+
+    std::unique_lock lock(task.Mutex);
+    if (timeout.microseconds <= 0)
+        task.StatusChanged.wait(lock, finished);
+    else
+        task.StatusChanged.wait_for(lock, std::chrono::microseconds(timeout.microseconds), finished);
+    return task.Status;
+}
+
+
+////////////////////////////////////////////////////////////
+const sfHttpResponse* sfHttpFuture_getResponse(const sfHttpFuture* future)
+{
+    assert(future);
+
+    const std::lock_guard lock(future->Task->Mutex);
+    return future->Task->Response.get();
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfHttpFuture_cancel(sfHttpFuture* future)
+{
+    assert(future);
+    return cancel(*future->Task);
+}
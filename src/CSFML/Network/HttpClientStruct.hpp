@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/HttpClient.h>
+#include <CSFML/Network/HttpStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Request submitted to an sfHttpClient, shared by the client
+// and the future of its response
+////////////////////////////////////////////////////////////
+struct sfHttpClientTask
+{
+    std::string    Host;
+    unsigned short Port{};
+    std::string    HostKey; // Host and port, which identify the connections to the server
+    sfHttpRequest  Request;
+    sfTime         Timeout{};
+
+    // Read by the worker while it waits for the server
+    std::atomic<bool> Cancelled{};
+
+    // Guarded by Mutex
+    std::mutex                      Mutex;
+    std::condition_variable         StatusChanged;
+    sfHttpFutureStatus              Status{sfHttpFuturePending};
+    std::unique_ptr<sfHttpResponse> Response;
+};
+
+
+////////////////////////////////////////////////////////////
+// Worker thread of an sfHttpClient, with its own connection
+////////////////////////////////////////////////////////////
+struct sfHttpClientWorker
+{
+    sfHttp      Http;
+    std::thread Thread;
+
+    // Guarded by the mutex of the client
+    std::string                       HostKey; // Host of the open connection, empty if none
+    std::shared_ptr<sfHttpClientTask> Task;    // Running request
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfHttpClient
+////////////////////////////////////////////////////////////
+struct sfHttpClient : Allocated<sfAllocModuleNetwork>
+{
+    sfHttpClient() = default;
+    sfHttpClient(const sfHttpClient&) = delete;
+    sfHttpClient& operator=(const sfHttpClient&) = delete;
+    ~sfHttpClient();
+
+    std::size_t                                      MaxConnectionsPerHost{};
+    std::vector<std::unique_ptr<sfHttpClientWorker>> Workers;
+
+    // Guarded by Mutex
+    std::mutex                                    Mutex;
+    std::condition_variable                       WorkAvailable;
+    std::deque<std::shared_ptr<sfHttpClientTask>> Queue;
+    std::unordered_map<std::string, std::size_t>  Connections; // Number of open connections per host
+    bool                                          Stopping{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfHttpFuture
+////////////////////////////////////////////////////////////
+struct sfHttpFuture : Allocated<sfAllocModuleNetwork>
+{
+    std::shared_ptr<sfHttpClientTask> Task;
+};
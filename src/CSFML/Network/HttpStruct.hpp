@@ -27,28 +27,64 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
-#include <SFML/Network/Http.hpp>
+#include <CSFML/Network/Http.h>
+#include <CSFML/Network/TcpSocketStruct.hpp>
+#include <CSFML/System/Allocated.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfHttp
 ////////////////////////////////////////////////////////////
-struct sfHttp : sf::Http
+struct sfHttp : Allocated<sfAllocModuleNetwork>
 {
+    std::vector<std::unique_ptr<sfHttpResponse>> ReleasedResponses;
+
+    std::string                  HostName; // Sent in the Host field
+    std::optional<sf::IpAddress> Host;     // Resolved by sfHttp_setHost
+    unsigned short               Port{};
+
+    // Persistent mode: the connection is kept open between requests
+    bool        Persistent{};
+    sfTcpSocket Connection;
+    bool        Connected{};
+    std::string Received; // Data received after the end of the last response read
+
+    // Set by sfHttpClient, to interrupt the request of a worker while it connects, sends it or waits for the server
+    const std::atomic<bool>* Cancelled{};
 };
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfHttpRequest
 ////////////////////////////////////////////////////////////
-struct sfHttpRequest : sf::Http::Request
+struct sfHttpRequest : Allocated<sfAllocModuleNetwork>
 {
+    std::map<std::string, std::string> Fields; // Names in lower case
+    sfHttpMethod                       Method{sfHttpGet};
+    std::string                        Uri{"/"};
+    unsigned int                       MajorVersion{1};
+    unsigned int                       MinorVersion{};
+    std::string                        Body;
 };
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfHttpResponse
 ////////////////////////////////////////////////////////////
-struct sfHttpResponse : sf::Http::Response
+struct sfHttpResponse : Allocated<sfAllocModuleNetwork>
 {
+    std::map<std::string, std::string> Fields; // Names in lower case
+    sfHttpStatus                       Status{sfHttpConnectionFailed};
+    unsigned int                       MajorVersion{};
+    unsigned int                       MinorVersion{};
+    std::string                        Body;
 };
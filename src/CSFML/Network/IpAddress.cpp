@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/Network/ConvertIpAddress.hpp>
 #include <CSFML/Network/IpAddress.h>
 
 #include <SFML/Network/IpAddress.hpp>
@@ -101,6 +102,21 @@ uint32_t sfIpAddress_toInteger(sfIpAddress address)
 }
 
 
+////////////////////////////////////////////////////////////
+sfIpAddressPacked sfIpAddress_toPacked(sfIpAddress address)
+{
+    const auto sfmlAddress = sf::IpAddress::resolve(address.address);
+    return sfmlAddress ? convertIpAddress(*sfmlAddress) : sfIpAddressPacked{};
+}
+
+
+////////////////////////////////////////////////////////////
+sfIpAddressPacked sfIpAddressPacked_fromInteger(uint32_t address)
+{
+    return convertIpAddress(address);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfIpAddress sfIpAddress_getLocalAddress()
 {
@@ -25,10 +25,273 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/Network/ByteOrder.hpp>
+#include <CSFML/Network/Compression.hpp>
 #include <CSFML/Network/Packet.h>
 #include <CSFML/Network/PacketStruct.hpp>
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
 #include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+void readArray(sfPacket& packet, T* values, std::size_t count)
+{
+    assert(values || count == 0);
+
+    if (!packet.IsValid)
+        return;
+
+    if (count > (packet.Data.size() - packet.ReadPosition) / sizeof(T))
+    {
+        packet.IsValid = false;
+        return;
+    }
+
+    if (count > 0)
+        convertByteOrder<T>(values, packet.Data.data() + packet.ReadPosition, count);
+    packet.ReadPosition += count * sizeof(T);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void writeArray(sfPacket& packet, const T* values, std::size_t count)
+{
+    assert(values || count == 0);
+
+    if (count == 0)
+        return;
+
+    const std::size_t offset = packet.Data.size();
+    packet.Data.resize(offset + count * sizeof(T));
+    convertByteOrder<T>(packet.Data.data() + offset, values, count);
+}
+
+
+////////////////////////////////////////////////////////////
+// Read and write single values with the same encoding as sf::Packet
+////////////////////////////////////////////////////////////
+template <typename T>
+T read(sfPacket& packet)
+{
+    T value{};
+    readArray(packet, &value, 1);
+    return value;
+}
+
+template <typename T>
+void write(sfPacket& packet, T value)
+{
+    writeArray(packet, &value, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+// Point to a block of bytes preceded by its size, and skip it
+////////////////////////////////////////////////////////////
+void readBlob(sfPacket& packet, const char*& data, std::size_t& size)
+{
+    data = nullptr;
+    size = 0;
+
+    const auto length = read<std::uint32_t>(packet);
+    if (!packet.checkSize(length))
+        return;
+
+    data = reinterpret_cast<const char*>(packet.Data.data() + packet.ReadPosition);
+    size = length;
+    packet.ReadPosition += length;
+}
+
+
+////////////////////////////////////////////////////////////
+// Maximum size of a 64-bit integer encoded as LEB128
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxVarintSize = 10;
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t readVarUint(sfPacket& packet)
+{
+    if (!packet.IsValid)
+        return 0;
+
+    const std::byte* data = packet.Data.data() + packet.ReadPosition;
+    const auto       size = std::min(packet.Data.size() - packet.ReadPosition, maxVarintSize);
+
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto byte = std::to_integer<std::uint8_t>(data[i]);
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0)
+        {
+            packet.ReadPosition += i + 1;
+            return value;
+        }
+    }
+
+    packet.IsValid = false;
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void writeVarUint(sfPacket& packet, std::uint64_t value)
+{
+    std::array<std::uint8_t, maxVarintSize> bytes{};
+    std::size_t                             size = 0;
+    while (value >= 0x80)
+    {
+        bytes[size++] = static_cast<std::uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    bytes[size++] = static_cast<std::uint8_t>(value);
+
+    packet.append(bytes.data(), size);
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr std::uint32_t bitMask(unsigned int bitCount)
+{
+    return bitCount >= 32 ? 0xFFFFFFFF : (std::uint32_t{1} << bitCount) - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t readBits(sfPacket& packet, unsigned int bitCount)
+{
+    assert(bitCount <= 32);
+
+    if (!packet.IsValid)
+        return 0;
+
+    sfPacketBits& bits  = packet.ReadBits;
+    std::uint32_t value = 0;
+    unsigned int  shift = 0;
+    while (shift < bitCount)
+    {
+        // Start a new byte when the last one is used up, or if other data was read since
+        if (bits.Count == 0 || bits.Count == 8 || bits.Position + 1 != packet.ReadPosition)
+        {
+            if (!packet.checkSize(1))
+                return 0;
+            bits.Position = packet.ReadPosition++;
+            bits.Count    = 0;
+        }
+
+        const unsigned int chunk = std::min(bitCount - shift, 8 - bits.Count);
+        const auto         byte  = std::to_integer<std::uint8_t>(packet.Data[bits.Position]);
+        value |= ((static_cast<std::uint32_t>(byte) >> bits.Count) & bitMask(chunk)) << shift;
+        bits.Count += chunk;
+        shift += chunk;
+    }
+
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+void writeBits(sfPacket& packet, std::uint32_t value, unsigned int bitCount)
+{
+    assert(bitCount <= 32);
+
+    sfPacketBits& bits = packet.WriteBits;
+    value &= bitMask(bitCount);
+    while (bitCount > 0)
+    {
+        // Start a new byte when the last one is full, or if other data was written since
+        if (bits.Count == 0 || bits.Count == 8 || bits.Position + 1 != packet.Data.size())
+        {
+            packet.Data.push_back(std::byte{0});
+            bits.Position = packet.Data.size() - 1;
+            bits.Count    = 0;
+        }
+
+        const unsigned int chunk = std::min(bitCount, 8 - bits.Count);
+        packet.Data[bits.Position] |= std::byte{static_cast<std::uint8_t>((value & bitMask(chunk)) << bits.Count)};
+        bits.Count += chunk;
+        bitCount -= chunk;
+        value >>= chunk;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// First byte of the data transformed by sfPacket_compress
+////////////////////////////////////////////////////////////
+enum class CompressionMethod : std::uint8_t
+{
+    Stored,
+    Lz4
+};
+
+
+////////////////////////////////////////////////////////////
+// Compress only the packets big enough to contain repetitions
+////////////////////////////////////////////////////////////
+constexpr std::size_t minCompressedSize = 32;
+
+
+////////////////////////////////////////////////////////////
+// Maximum ratio of the LZ4 format, which bounds the size claimed by compressed data
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxCompressionRatio = 255;
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+const void* sfPacket::getSendData(std::size_t& size) const
+{
+    if (!SendTransform)
+    {
+        size = getDataSize();
+        return getData();
+    }
+
+    if (SendBuffer)
+        SendBuffer->clear();
+    else
+        SendBuffer = std::make_unique<sfPacket>();
+
+    SendTransform(getData(), getDataSize(), SendBuffer.get(), TransformUserData);
+    size = SendBuffer->getDataSize();
+    return SendBuffer->getData();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket::onReceive(const void* data, std::size_t size)
+{
+    clear();
+    Received = true;
+
+    if (!ReceiveTransform)
+    {
+        append(data, size);
+        return;
+    }
+
+    if (!ReceiveTransform(data, size, this, TransformUserData))
+    {
+        // Leave the packet empty, and make it invalid
+        clear();
+        IsValid = false;
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -65,7 +328,7 @@ void sfPacket_append(sfPacket* packet, const void* data, size_t sizeInBytes)
 size_t sfPacket_getReadPosition(const sfPacket* packet)
 {
     assert(packet);
-    return packet->getReadPosition();
+    return packet->ReadPosition;
 }
 
 
@@ -97,7 +360,7 @@ size_t sfPacket_getDataSize(const sfPacket* packet)
 bool sfPacket_endOfPacket(const sfPacket* packet)
 {
     assert(packet);
-    return packet->endOfPacket();
+    return packet->ReadPosition >= packet->Data.size();
 }
 
 
@@ -105,7 +368,7 @@ bool sfPacket_endOfPacket(const sfPacket* packet)
 bool sfPacket_canRead(const sfPacket* packet)
 {
     assert(packet);
-    return bool{*packet};
+    return packet->IsValid;
 }
 
 
@@ -117,84 +380,203 @@ bool sfPacket_readBool(sfPacket* packet)
 int8_t sfPacket_readInt8(sfPacket* packet)
 {
     assert(packet);
-    int8_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::int8_t>(*packet);
 }
 uint8_t sfPacket_readUint8(sfPacket* packet)
 {
     assert(packet);
-    uint8_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::uint8_t>(*packet);
 }
 int16_t sfPacket_readInt16(sfPacket* packet)
 {
     assert(packet);
-    int16_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::int16_t>(*packet);
 }
 uint16_t sfPacket_readUint16(sfPacket* packet)
 {
     assert(packet);
-    uint16_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::uint16_t>(*packet);
 }
 int32_t sfPacket_readInt32(sfPacket* packet)
 {
     assert(packet);
-    int32_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::int32_t>(*packet);
 }
 uint32_t sfPacket_readUint32(sfPacket* packet)
 {
     assert(packet);
-    uint32_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::uint32_t>(*packet);
 }
 int64_t sfPacket_readInt64(sfPacket* packet)
 {
     assert(packet);
-    int64_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::int64_t>(*packet);
 }
 uint64_t sfPacket_readUint64(sfPacket* packet)
 {
     assert(packet);
-    uint64_t value = 0;
-    *packet >> value;
-    return value;
+    return read<std::uint64_t>(*packet);
 }
 float sfPacket_readFloat(sfPacket* packet)
 {
     assert(packet);
-    float value = 0;
-    *packet >> value;
-    return value;
+    return read<float>(*packet);
 }
 double sfPacket_readDouble(sfPacket* packet)
 {
     assert(packet);
-    double value = 0;
-    *packet >> value;
-    return value;
+    return read<double>(*packet);
 }
 void sfPacket_readString(sfPacket* packet, char* string)
 {
     assert(packet);
-    if (string)
-        *packet >> string;
+    if (!string)
+        return;
+
+    const auto length = read<std::uint32_t>(*packet);
+    if (length > 0 && packet->checkSize(length))
+    {
+        std::memcpy(string, packet->Data.data() + packet->ReadPosition, length);
+        string[length] = '\0';
+        packet->ReadPosition += length;
+    }
 }
 void sfPacket_readWideString(sfPacket* packet, wchar_t* string)
 {
     assert(packet);
-    if (string)
-        *packet >> string;
+    if (!string)
+        return;
+
+    // Characters are stored as 32-bit integers
+    const auto length = read<std::uint32_t>(*packet);
+    if (length > 0 && packet->checkSize(std::size_t{length} * sizeof(std::uint32_t)))
+    {
+        for (std::uint32_t i = 0; i < length; ++i)
+            string[i] = static_cast<wchar_t>(read<std::uint32_t>(*packet));
+        string[length] = L'\0';
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_readStringView(sfPacket* packet, const char** data, size_t* length)
+{
+    assert(packet);
+    assert(data);
+    assert(length);
+    readBlob(*packet, *data, *length);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_readBlob(sfPacket* packet, const void** data, size_t* size)
+{
+    assert(packet);
+    assert(data);
+    assert(size);
+
+    const char* bytes = nullptr;
+    readBlob(*packet, bytes, *size);
+    *data = bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_readInt8Array(sfPacket* packet, int8_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readUint8Array(sfPacket* packet, uint8_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readInt16Array(sfPacket* packet, int16_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readUint16Array(sfPacket* packet, uint16_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readInt32Array(sfPacket* packet, int32_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readUint32Array(sfPacket* packet, uint32_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readInt64Array(sfPacket* packet, int64_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readUint64Array(sfPacket* packet, uint64_t* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readFloatArray(sfPacket* packet, float* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+void sfPacket_readDoubleArray(sfPacket* packet, double* values, size_t count)
+{
+    assert(packet);
+    readArray(*packet, values, count);
+}
+
+
+////////////////////////////////////////////////////////////
+uint64_t sfPacket_readVarUint(sfPacket* packet)
+{
+    assert(packet);
+    return readVarUint(*packet);
+}
+
+
+////////////////////////////////////////////////////////////
+int64_t sfPacket_readVarInt(sfPacket* packet)
+{
+    assert(packet);
+    const std::uint64_t value = readVarUint(*packet);
+    return static_cast<std::int64_t>((value >> 1) ^ (0 - (value & 1)));
+}
+
+
+////////////////////////////////////////////////////////////
+uint32_t sfPacket_readBits(sfPacket* packet, unsigned int bitCount)
+{
+    assert(packet);
+    return readBits(*packet, bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfPacket_readBit(sfPacket* packet)
+{
+    assert(packet);
+    return readBits(*packet, 1) != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+float sfPacket_readQuantizedFloat(sfPacket* packet, float min, float max, unsigned int bitCount)
+{
+    assert(packet);
+    assert(min < max);
+    assert(bitCount >= 1 && bitCount <= 32);
+
+    const double steps = bitMask(bitCount);
+    const double ratio = readBits(*packet, bitCount) / steps;
+    return static_cast<float>(min + (static_cast<double>(max) - min) * ratio);
 }
 
 
@@ -206,62 +588,281 @@ void sfPacket_writeBool(sfPacket* packet, bool value)
 void sfPacket_writeInt8(sfPacket* packet, int8_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeUint8(sfPacket* packet, uint8_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeInt16(sfPacket* packet, int16_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeUint16(sfPacket* packet, uint16_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeInt32(sfPacket* packet, int32_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeUint32(sfPacket* packet, uint32_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeInt64(sfPacket* packet, int64_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeUint64(sfPacket* packet, uint64_t value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeFloat(sfPacket* packet, float value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeDouble(sfPacket* packet, double value)
 {
     assert(packet);
-    *packet << value;
+    write(*packet, value);
 }
 void sfPacket_writeString(sfPacket* packet, const char* string)
 {
     assert(packet);
-    if (string)
-        *packet << string;
+    if (!string)
+        return;
+
+    const auto length = static_cast<std::uint32_t>(std::strlen(string));
+    write(*packet, length);
+    packet->append(string, length);
 }
 void sfPacket_writeWideString(sfPacket* packet, const wchar_t* string)
 {
     assert(packet);
-    if (string)
-        *packet << string;
+    if (!string)
+        return;
+
+    const auto length = static_cast<std::uint32_t>(std::wcslen(string));
+    write(*packet, length);
+    for (std::uint32_t i = 0; i < length; ++i)
+        write(*packet, static_cast<std::uint32_t>(string[i]));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeBlob(sfPacket* packet, const void* data, size_t size)
+{
+    assert(packet);
+    assert(data || size == 0);
+    assert(size <= std::numeric_limits<std::uint32_t>::max());
+
+    write(*packet, static_cast<std::uint32_t>(size));
+    packet->append(data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeInt8Array(sfPacket* packet, const int8_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeUint8Array(sfPacket* packet, const uint8_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeInt16Array(sfPacket* packet, const int16_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeUint16Array(sfPacket* packet, const uint16_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeInt32Array(sfPacket* packet, const int32_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeUint32Array(sfPacket* packet, const uint32_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeInt64Array(sfPacket* packet, const int64_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeUint64Array(sfPacket* packet, const uint64_t* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeFloatArray(sfPacket* packet, const float* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+void sfPacket_writeDoubleArray(sfPacket* packet, const double* values, size_t count)
+{
+    assert(packet);
+    writeArray(*packet, values, count);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeVarUint(sfPacket* packet, uint64_t value)
+{
+    assert(packet);
+    writeVarUint(*packet, value);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeVarInt(sfPacket* packet, int64_t value)
+{
+    assert(packet);
+    const auto bits = static_cast<std::uint64_t>(value);
+    writeVarUint(*packet, (bits << 1) ^ (0 - (bits >> 63)));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeBits(sfPacket* packet, uint32_t value, unsigned int bitCount)
+{
+    assert(packet);
+    writeBits(*packet, value, bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeBit(sfPacket* packet, bool value)
+{
+    assert(packet);
+    writeBits(*packet, value ? 1 : 0, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_writeQuantizedFloat(sfPacket* packet, float value, float min, float max, unsigned int bitCount)
+{
+    assert(packet);
+    assert(min < max);
+    assert(bitCount >= 1 && bitCount <= 32);
+
+    // Comparing this way also maps NaN to min
+    const float  clamped = value > min ? std::min(value, max) : min;
+    const double steps   = bitMask(bitCount);
+    const double ratio   = (static_cast<double>(clamped) - min) / (static_cast<double>(max) - min);
+    writeBits(*packet, static_cast<std::uint32_t>(std::llround(ratio * steps)), bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_setTransform(sfPacket*                packet,
+                           sfPacketSendTransform    onSend,
+                           sfPacketReceiveTransform onReceive,
+                           void*                    userData)
+{
+    assert(packet);
+
+    packet->SendTransform     = onSend;
+    packet->ReceiveTransform  = onReceive;
+    packet->TransformUserData = userData;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_compress(const void* data, size_t size, sfPacket* output, void* /* userData */)
+{
+    assert(data || size == 0);
+    assert(output);
+
+    std::vector<std::byte>& bytes  = output->Data;
+    const std::size_t       offset = bytes.size();
+
+    // Compress straight into the output, then fall back to a copy if it didn't save anything
+    if (size >= minCompressedSize && size <= std::numeric_limits<std::uint32_t>::max())
+    {
+        constexpr std::size_t headerSize = 1 + sizeof(std::uint32_t);
+        bytes.resize(offset + headerSize + getCompressBound(size));
+
+        const std::size_t compressedSize = compressBlock(data, size, bytes.data() + offset + headerSize);
+        if (headerSize + compressedSize < 1 + size)
+        {
+            const auto originalSize = static_cast<std::uint32_t>(size);
+            bytes[offset]           = std::byte{static_cast<std::uint8_t>(CompressionMethod::Lz4)};
+            bytes[offset + 1]       = std::byte{static_cast<std::uint8_t>(originalSize >> 24)};
+            bytes[offset + 2]       = std::byte{static_cast<std::uint8_t>(originalSize >> 16)};
+            bytes[offset + 3]       = std::byte{static_cast<std::uint8_t>(originalSize >> 8)};
+            bytes[offset + 4]       = std::byte{static_cast<std::uint8_t>(originalSize)};
+            bytes.resize(offset + headerSize + compressedSize);
+            return;
+        }
+
+        bytes.resize(offset);
+    }
+
+    write(*output, static_cast<std::uint8_t>(CompressionMethod::Stored));
+    output->append(data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfPacket_decompress(const void* data, size_t size, sfPacket* output, void* /* userData */)
+{
+    assert(data || size == 0);
+    assert(output);
+
+    const auto* input = static_cast<const std::uint8_t*>(data);
+    if (size < 1)
+        return false;
+
+    switch (static_cast<CompressionMethod>(input[0]))
+    {
+        case CompressionMethod::Stored:
+            output->append(input + 1, size - 1);
+            return true;
+
+        case CompressionMethod::Lz4:
+        {
+            constexpr std::size_t headerSize = 1 + sizeof(std::uint32_t);
+            if (size < headerSize)
+                return false;
+
+            const std::size_t originalSize = std::size_t{input[1]} << 24 | std::size_t{input[2]} << 16 |
+                                             std::size_t{input[3]} << 8 | std::size_t{input[4]};
+            const std::size_t compressedSize = size - headerSize;
+
+            // Don't trust a size which the compressed data can't reach
+            if (originalSize > compressedSize * maxCompressionRatio)
+                return false;
+
+            std::vector<std::byte>& bytes  = output->Data;
+            const std::size_t       offset = bytes.size();
+            bytes.resize(offset + originalSize);
+            if (!decompressBlock(input + headerSize, compressedSize, bytes.data() + offset, originalSize))
+            {
+                bytes.resize(offset);
+                return false;
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
 }
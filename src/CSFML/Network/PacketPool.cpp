@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/PacketPool.h>
+#include <CSFML/Network/PacketPoolStruct.hpp>
+
+#include <cassert>
+
+
+////////////////////////////////////////////////////////////
+sfPacketPool* sfPacketPool_create(size_t maxAvailable)
+{
+    auto* pool         = new sfPacketPool;
+    pool->MaxAvailable = maxAvailable;
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacketPool_destroy(const sfPacketPool* pool)
+{
+    delete pool;
+}
+
+
+////////////////////////////////////////////////////////////
+sfPacket* sfPacketPool_acquire(sfPacketPool* pool)
+{
+    assert(pool);
+
+    if (pool->Packets.empty())
+        return new sfPacket;
+
+    sfPacket* packet = pool->Packets.back().release();
+    pool->Packets.pop_back();
+    return packet;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacketPool_release(sfPacketPool* pool, sfPacket* packet)
+{
+    assert(pool);
+
+    std::unique_ptr<sfPacket> owned(packet);
+    if (!owned || (pool->MaxAvailable != 0 && pool->Packets.size() >= pool->MaxAvailable))
+        return;
+
+    owned->clear();
+    owned->SendTransform     = nullptr;
+    owned->ReceiveTransform  = nullptr;
+    owned->TransformUserData = nullptr;
+    pool->Packets.push_back(std::move(owned));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacketPool_reserve(sfPacketPool* pool, size_t count)
+{
+    assert(pool);
+
+    if (pool->MaxAvailable != 0 && count > pool->MaxAvailable)
+        count = pool->MaxAvailable;
+
+    pool->Packets.reserve(count);
+    while (pool->Packets.size() < count)
+        pool->Packets.push_back(std::make_unique<sfPacket>());
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfPacketPool_getAvailableCount(const sfPacketPool* pool)
+{
+    assert(pool);
+    return pool->Packets.size();
+}
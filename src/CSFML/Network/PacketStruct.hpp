@@ -27,12 +27,121 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/Network/Packet.h>
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Byte of a packet partially filled with bits
+////////////////////////////////////////////////////////////
+struct sfPacketBits
+{
+    std::size_t  Position{}; // Index of the byte in the packet data
+    unsigned int Count{};    // Number of bits already used in the byte
+};
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfPacket
+//
+// The data and the read state are kept here rather than in
+// sf::Packet, which gives no access to its storage nor to its
+// read position; sf::Packet is only the interface used by the
+// sockets, through onSend and onReceive
 ////////////////////////////////////////////////////////////
-struct sfPacket : sf::Packet
+struct sfPacket : sf::Packet, Allocated<sfAllocModuleNetwork>
 {
+    sfPacket() = default;
+
+    // The send buffer only lives during a send, so it isn't copied
+    sfPacket(const sfPacket& other) :
+    sf::Packet(other),
+    Allocated(other),
+    Data(other.Data),
+    ReadPosition(other.ReadPosition),
+    IsValid(other.IsValid),
+    WriteBits(other.WriteBits),
+    ReadBits(other.ReadBits),
+    SendTransform(other.SendTransform),
+    ReceiveTransform(other.ReceiveTransform),
+    TransformUserData(other.TransformUserData)
+    {
+    }
+
+    sfPacket& operator=(const sfPacket&) = delete;
+
+    void clear()
+    {
+        Data.clear();
+        ReadPosition = 0;
+        IsValid      = true;
+        WriteBits    = {};
+        ReadBits     = {};
+    }
+
+    void append(const void* data, std::size_t size)
+    {
+        if (data && size > 0)
+        {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            Data.insert(Data.end(), bytes, bytes + size);
+        }
+    }
+
+    const void* getData() const
+    {
+        return Data.empty() ? nullptr : Data.data();
+    }
+
+    std::size_t getDataSize() const
+    {
+        return Data.size();
+    }
+
+    // Tell whether size bytes are left to read, and make the packet invalid otherwise
+    bool checkSize(std::size_t size)
+    {
+        IsValid = IsValid && size <= Data.size() - ReadPosition;
+        return IsValid;
+    }
+
+    // Receive the packet with an SFML socket, which only calls onReceive for packets that aren't empty
+    template <typename Socket, typename... Args>
+    sf::Socket::Status receiveFrom(Socket& socket, Args&... args)
+    {
+        Received                        = false;
+        const sf::Socket::Status status = socket.receive(static_cast<sf::Packet&>(*this), args...);
+        if (status == sf::Socket::Status::Done && !Received)
+            clear();
+        return status;
+    }
+
+    // Get the data to send, transformed by SendTransform if there is one
+    const void* getSendData(std::size_t& size) const;
+
+    const void* onSend(std::size_t& size) override
+    {
+        return getSendData(size);
+    }
+
+    void onReceive(const void* data, std::size_t size) override;
+
+    std::vector<std::byte>            Data;
+    std::size_t                       ReadPosition{};
+    bool                              IsValid{true};
+    bool                              Received{};
+    sfPacketBits                      WriteBits;
+    sfPacketBits                      ReadBits;
+    sfPacketSendTransform             SendTransform{};
+    sfPacketReceiveTransform          ReceiveTransform{};
+    void*                             TransformUserData{};
+    mutable std::unique_ptr<sfPacket> SendBuffer;
 };
@@ -0,0 +1,719 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/PacketStruct.hpp>
+#include <CSFML/Network/ReliableUdp.h>
+#include <CSFML/Network/ReliableUdpStruct.hpp>
+#include <CSFML/Network/UdpSocket.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Layout of the datagrams, all integers being big endian:
+//   header:   sequence (16 bits), ack (16 bits), ack bits (32 bits)
+//   messages: delivery (8 bits), channel (8 bits), id (16 bits, reliable only), size (16 bits), data
+////////////////////////////////////////////////////////////
+constexpr std::size_t   maxDatagramSize        = 1200; // Stays below the MTU of common networks
+constexpr std::size_t   headerSize             = 8;
+constexpr std::size_t   unreliableHeaderSize   = 4;
+constexpr std::size_t   reliableHeaderSize     = 6;
+constexpr std::uint64_t ackBitCount            = 32;
+constexpr std::uint64_t reorderingThreshold    = 3; // Datagrams acknowledged after a datagram before it is lost
+constexpr std::uint64_t maxSerialsInFlight     = 16384; // Keeps 16-bit ids unambiguous
+constexpr std::size_t   maxDatagramsInFlight   = 32;    // Fits in the window of acknowledgements
+constexpr std::int64_t  initialRetransmitDelay = 100'000;
+constexpr std::int64_t  minRetransmitDelay     = 20'000;
+constexpr std::int64_t  maxRetransmitDelay     = 1'000'000;
+constexpr std::int64_t  minLostDatagramAge     = 1'000'000;
+constexpr std::size_t   receiveBatchSize       = 32;
+constexpr std::size_t   defaultMaxPeers        = 1024;
+
+
+////////////////////////////////////////////////////////////
+std::int64_t getTime()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t getPeerKey(const sfIpAddressPacked& address, unsigned short port)
+{
+    return std::uint64_t{address.integer} << 16 | port;
+}
+
+
+////////////////////////////////////////////////////////////
+// Recover a full sequence number from its lowest 16 bits, taking the closest to a reference
+////////////////////////////////////////////////////////////
+std::uint64_t extendSequence(std::uint16_t value, std::uint64_t reference)
+{
+    const auto delta = static_cast<std::uint16_t>(value - static_cast<std::uint16_t>(reference));
+    if (delta < 0x8000)
+        return reference + delta;
+
+    const std::uint64_t distance = 0x10000u - delta;
+    return distance <= reference ? reference - distance : reference + delta;
+}
+
+
+////////////////////////////////////////////////////////////
+void write16(std::vector<std::byte>& output, std::uint64_t value)
+{
+    output.push_back(static_cast<std::byte>(value >> 8));
+    output.push_back(static_cast<std::byte>(value));
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint16_t read16(const std::byte* input)
+{
+    return static_cast<std::uint16_t>(std::to_integer<unsigned int>(input[0]) << 8 |
+                                      std::to_integer<unsigned int>(input[1]));
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t read32(const std::byte* input)
+{
+    return std::uint32_t{read16(input)} << 16 | read16(input + 2);
+}
+
+
+////////////////////////////////////////////////////////////
+sfReliableUdpPeer& getPeer(sfReliableUdp& reliableUdp, const sfIpAddressPacked& address, unsigned short port)
+{
+    sfReliableUdpPeer& peer = reliableUdp.Peers[getPeerKey(address, port)];
+    peer.Address            = address;
+    peer.Port               = port;
+    return peer;
+}
+
+
+////////////////////////////////////////////////////////////
+// Delay after which a reliable message is sent again, as in RFC 6298
+////////////////////////////////////////////////////////////
+std::int64_t getRetransmitDelay(const sfReliableUdpPeer& peer)
+{
+    if (!peer.HasRtt)
+        return initialRetransmitDelay;
+
+    const auto delay = static_cast<std::int64_t>(peer.Rtt + 4 * peer.RttVariance);
+    return std::clamp(delay, minRetransmitDelay, maxRetransmitDelay);
+}
+
+
+////////////////////////////////////////////////////////////
+void addRttSample(sfReliableUdpPeer& peer, std::int64_t sample)
+{
+    const auto rtt = static_cast<double>(sample);
+    if (!peer.HasRtt)
+    {
+        peer.HasRtt      = true;
+        peer.Rtt         = rtt;
+        peer.RttVariance = rtt / 2;
+    }
+    else
+    {
+        peer.RttVariance = 0.75 * peer.RttVariance + 0.25 * std::abs(peer.Rtt - rtt);
+        peer.Rtt         = 0.875 * peer.Rtt + 0.125 * rtt;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void addDatagramOutcome(sfReliableUdpPeer& peer, bool lost)
+{
+    if (lost)
+        ++peer.Stats.datagramsLost;
+    peer.Stats.lossRate += ((lost ? 1.f : 0.f) - peer.Stats.lossRate) / 16;
+}
+
+
+////////////////////////////////////////////////////////////
+// Count a datagram as lost, and make its reliable messages due for sending again
+////////////////////////////////////////////////////////////
+void loseDatagram(sfReliableUdpPeer& peer, std::map<std::uint64_t, sfReliableUdpSentDatagram>::iterator datagram)
+{
+    for (const std::uint64_t serial : datagram->second.Messages)
+    {
+        const auto message = peer.Reliable.find(serial);
+        if (message != peer.Reliable.end())
+            message->second.LastSent = 0;
+    }
+
+    addDatagramOutcome(peer, true);
+    peer.Sent.erase(datagram);
+}
+
+
+////////////////////////////////////////////////////////////
+void acknowledge(sfReliableUdpPeer& peer, std::uint64_t ack, std::uint32_t ackBits, std::int64_t now)
+{
+    for (std::uint64_t i = 0; i <= ackBitCount && i <= ack; ++i)
+    {
+        if (i > 0 && (ackBits & (std::uint32_t{1} << (i - 1))) == 0)
+            continue;
+
+        const auto datagram = peer.Sent.find(ack - i);
+        if (datagram == peer.Sent.end())
+            continue;
+
+        addRttSample(peer, now - datagram->second.Time);
+        for (const std::uint64_t serial : datagram->second.Messages)
+            peer.Reliable.erase(serial);
+        addDatagramOutcome(peer, false);
+        peer.Sent.erase(datagram);
+    }
+
+    // Datagrams sent before an acknowledged one were lost if they are late as well, which
+    // tells them apart from datagrams reordered by the network (RFC 9002 uses both thresholds)
+    peer.HighestAck              = std::max(peer.HighestAck, ack);
+    const std::int64_t lostDelay = getRetransmitDelay(peer);
+    while (!peer.Sent.empty() && peer.Sent.begin()->first + reorderingThreshold <= peer.HighestAck &&
+           now - peer.Sent.begin()->second.Time > lostDelay)
+        loseDatagram(peer, peer.Sent.begin());
+}
+
+
+////////////////////////////////////////////////////////////
+void recordReceived(sfReliableUdpPeer& peer, std::uint64_t sequence)
+{
+    if (!peer.HasReceived)
+    {
+        peer.HasReceived    = true;
+        peer.RemoteSequence = sequence;
+        peer.ReceivedBits   = 0;
+    }
+    else if (sequence > peer.RemoteSequence)
+    {
+        // The previous highest sequence becomes one of the bits
+        const std::uint64_t shift = sequence - peer.RemoteSequence;
+        const std::uint64_t bits  = std::uint64_t{peer.ReceivedBits} << 1 | 1;
+        peer.RemoteSequence       = sequence;
+        peer.ReceivedBits         = shift > ackBitCount ? 0 : static_cast<std::uint32_t>(bits << (shift - 1));
+    }
+    else if (sequence < peer.RemoteSequence && peer.RemoteSequence - sequence <= ackBitCount)
+    {
+        peer.ReceivedBits |= std::uint32_t{1} << (peer.RemoteSequence - sequence - 1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void deliver(sfReliableUdp&           reliableUdp,
+             const sfReliableUdpPeer& peer,
+             std::uint8_t             channel,
+             std::vector<std::byte>   data)
+{
+    reliableUdp.Delivered.push_back({std::move(data), peer.Address, peer.Port, channel});
+}
+
+
+////////////////////////////////////////////////////////////
+// Deliver a received message, unless it is a duplicate or must wait for previous ones
+////////////////////////////////////////////////////////////
+void receiveMessage(sfReliableUdp&        reliableUdp,
+                    sfReliableUdpPeer&    peer,
+                    sfReliableUdpDelivery delivery,
+                    std::uint8_t          channelIndex,
+                    std::uint16_t         id,
+                    const std::byte*      data,
+                    std::size_t           size)
+{
+    if (delivery == sfReliableUdpUnreliable)
+    {
+        deliver(reliableUdp, peer, channelIndex, {data, data + size});
+        return;
+    }
+
+    sfReliableUdpChannel& channel = peer.Channels[channelIndex];
+
+    // The messages held until the missing ones arrive were all sent after the first message that the
+    // peer has in flight, so a well-behaved peer never makes them exceed its window of serials
+    const auto fitsWindow = [&peer](std::uint64_t fullId, std::uint64_t expectedId)
+    {
+        return fullId - expectedId < maxSerialsInFlight &&
+               (fullId == expectedId || peer.ArrivedCount < maxSerialsInFlight);
+    };
+
+    if (delivery == sfReliableUdpReliableUnordered)
+    {
+        const std::uint64_t fullId = extendSequence(id, channel.UnorderedComplete);
+        if (fullId < channel.UnorderedComplete || !fitsWindow(fullId, channel.UnorderedComplete) ||
+            !channel.UnorderedArrived.insert(fullId).second)
+            return;
+
+        ++peer.ArrivedCount;
+        deliver(reliableUdp, peer, channelIndex, {data, data + size});
+
+        auto first = channel.UnorderedArrived.begin();
+        while (first != channel.UnorderedArrived.end() && *first == channel.UnorderedComplete)
+        {
+            first = channel.UnorderedArrived.erase(first);
+            --peer.ArrivedCount;
+            ++channel.UnorderedComplete;
+        }
+        return;
+    }
+
+    const std::uint64_t fullId = extendSequence(id, channel.NextOrderedDelivery);
+    if (fullId < channel.NextOrderedDelivery || !fitsWindow(fullId, channel.NextOrderedDelivery))
+        return;
+
+    if (fullId > channel.NextOrderedDelivery)
+    {
+        if (channel.OrderedArrived.try_emplace(fullId, data, data + size).second)
+            ++peer.ArrivedCount;
+        return;
+    }
+
+    deliver(reliableUdp, peer, channelIndex, {data, data + size});
+    ++channel.NextOrderedDelivery;
+
+    auto next = channel.OrderedArrived.begin();
+    while (next != channel.OrderedArrived.end() && next->first == channel.NextOrderedDelivery)
+    {
+        deliver(reliableUdp, peer, channelIndex, std::move(next->second));
+        next = channel.OrderedArrived.erase(next);
+        --peer.ArrivedCount;
+        ++channel.NextOrderedDelivery;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void receiveDatagram(sfReliableUdp&           reliableUdp,
+                     const std::byte*         data,
+                     std::size_t              size,
+                     const sfIpAddressPacked& address,
+                     unsigned short           port,
+                     std::int64_t             now)
+{
+    if (size < headerSize)
+        return;
+
+    // Check the whole datagram before using any of it
+    for (std::size_t position = headerSize; position < size;)
+    {
+        if (size - position < unreliableHeaderSize)
+            return;
+
+        const auto delivery = std::to_integer<unsigned int>(data[position]);
+        if (delivery > sfReliableUdpReliableOrdered)
+            return;
+
+        position += delivery == sfReliableUdpUnreliable ? unreliableHeaderSize : reliableHeaderSize;
+        if (position > size)
+            return;
+
+        const std::size_t messageSize = read16(data + position - 2);
+        if (messageSize > size - position)
+            return;
+        position += messageSize;
+    }
+
+    // The source of a datagram can be spoofed, so unknown sources can only create peers up to the limit
+    if (reliableUdp.Peers.size() >= reliableUdp.MaxPeers && reliableUdp.Peers.count(getPeerKey(address, port)) == 0)
+        return;
+
+    sfReliableUdpPeer& peer = getPeer(reliableUdp, address, port);
+    ++peer.Stats.datagramsReceived;
+
+    const std::uint64_t sequence = extendSequence(read16(data), peer.HasReceived ? peer.RemoteSequence : 0);
+    recordReceived(peer, sequence);
+    acknowledge(peer, extendSequence(read16(data + 2), peer.NextSequence), read32(data + 4), now);
+
+    for (std::size_t position = headerSize; position < size;)
+    {
+        const auto         delivery = static_cast<sfReliableUdpDelivery>(std::to_integer<int>(data[position]));
+        const auto         channel  = std::to_integer<std::uint8_t>(data[position + 1]);
+        const bool         reliable = delivery != sfReliableUdpUnreliable;
+        const std::uint16_t id      = reliable ? read16(data + position + 2) : 0;
+
+        position += reliable ? reliableHeaderSize : unreliableHeaderSize;
+        const std::size_t messageSize = read16(data + position - 2);
+
+        receiveMessage(reliableUdp, peer, delivery, channel, id, data + position, messageSize);
+        position += messageSize;
+        peer.AckPending = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Send a datagram, or hand it to the network simulation
+////////////////////////////////////////////////////////////
+void transmit(sfReliableUdp&                             reliableUdp,
+              sfReliableUdpDelayedDatagram&&             datagram,
+              std::int64_t                               now,
+              std::vector<sfReliableUdpDelayedDatagram>& outgoing)
+{
+    if (!reliableUdp.Simulation)
+    {
+        outgoing.push_back(std::move(datagram));
+        return;
+    }
+
+    const sfReliableUdpSimulation& simulation = *reliableUdp.Simulation;
+    if (std::uniform_real_distribution<float>(0.f, 1.f)(reliableUdp.Random) < simulation.lossRate)
+        return;
+
+    std::int64_t delay = simulation.latency.microseconds;
+    if (simulation.jitter.microseconds > 0)
+        delay += std::uniform_int_distribution<std::int64_t>(0, simulation.jitter.microseconds)(reliableUdp.Random);
+
+    reliableUdp.Delayed.emplace(now + delay, std::move(datagram));
+}
+
+
+////////////////////////////////////////////////////////////
+// Pack the pending messages and acknowledgements of a peer into datagrams
+////////////////////////////////////////////////////////////
+void flushPeer(sfReliableUdp&                             reliableUdp,
+               sfReliableUdpPeer&                         peer,
+               std::int64_t                               now,
+               std::vector<sfReliableUdpDelayedDatagram>& outgoing)
+{
+    std::vector<std::byte>     datagram;
+    std::vector<std::uint64_t> serials;
+    bool                       hasMessages = false;
+
+    const auto flush = [&]
+    {
+        if (!hasMessages && !peer.AckPending)
+            return;
+
+        datagram.resize(std::max(datagram.size(), headerSize));
+        const std::uint64_t                sequence = peer.NextSequence++;
+        const std::array<std::uint64_t, 4> header{sequence,
+                                                  peer.RemoteSequence,
+                                                  peer.ReceivedBits >> 16,
+                                                  peer.ReceivedBits};
+        for (std::size_t i = 0; i < header.size(); ++i)
+        {
+            datagram[i * 2]     = static_cast<std::byte>(header[i] >> 8);
+            datagram[i * 2 + 1] = static_cast<std::byte>(header[i]);
+        }
+
+        // Datagrams carrying only acknowledgements aren't acknowledged themselves
+        if (hasMessages)
+        {
+            peer.Sent.emplace(sequence, sfReliableUdpSentDatagram{now, std::move(serials)});
+            ++peer.Stats.datagramsSent;
+        }
+
+        transmit(reliableUdp, {std::move(datagram), peer.Address, peer.Port}, now, outgoing);
+        peer.AckPending = false;
+        hasMessages     = false;
+        datagram        = {};
+        serials         = {};
+    };
+
+    const auto append = [&](const sfReliableUdpMessage& message)
+    {
+        const bool        reliable    = message.Delivery != sfReliableUdpUnreliable;
+        const std::size_t messageSize = (reliable ? reliableHeaderSize : unreliableHeaderSize) + message.Data.size();
+        if (datagram.size() + messageSize > maxDatagramSize)
+            flush();
+        if (datagram.empty())
+            datagram.resize(headerSize);
+
+        datagram.push_back(static_cast<std::byte>(message.Delivery));
+        datagram.push_back(static_cast<std::byte>(message.Channel));
+        if (reliable)
+            write16(datagram, message.Id);
+        write16(datagram, message.Data.size());
+        datagram.insert(datagram.end(), message.Data.begin(), message.Data.end());
+        hasMessages = true;
+    };
+
+    for (const sfReliableUdpMessage& message : peer.Unreliable)
+        append(message);
+    peer.Unreliable.clear();
+
+    if (!peer.Reliable.empty())
+    {
+        const std::int64_t  delay     = getRetransmitDelay(peer);
+        const std::uint64_t serialEnd = peer.Reliable.begin()->first + maxSerialsInFlight;
+        for (auto& [serial, message] : peer.Reliable)
+        {
+            if (serial >= serialEnd || peer.Sent.size() >= maxDatagramsInFlight)
+                break;
+            if (message.LastSent >= 0 && now - message.LastSent < delay)
+                continue;
+            if (message.LastSent >= 0)
+                ++peer.Stats.messagesResent;
+
+            append(message);
+            serials.push_back(serial);
+            message.LastSent = now;
+        }
+    }
+
+    flush();
+
+    // Datagrams which are not acknowledged for too long were lost
+    const std::int64_t lostAge = std::max(minLostDatagramAge, 2 * getRetransmitDelay(peer));
+    while (!peer.Sent.empty() && now - peer.Sent.begin()->second.Time > lostAge)
+        loseDatagram(peer, peer.Sent.begin());
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+sfReliableUdp* sfReliableUdp_create(sfUdpSocket* socket)
+{
+    assert(socket);
+
+    auto* reliableUdp     = new sfReliableUdp;
+    reliableUdp->Socket   = socket;
+    reliableUdp->MaxPeers = defaultMaxPeers;
+    sfUdpSocket_setBlocking(socket, false);
+    return reliableUdp;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfReliableUdp_destroy(const sfReliableUdp* reliableUdp)
+{
+    delete reliableUdp;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfReliableUdp_setSimulation(sfReliableUdp* reliableUdp, const sfReliableUdpSimulation* simulation)
+{
+    assert(reliableUdp);
+
+    if (simulation)
+    {
+        reliableUdp->Simulation = *simulation;
+        reliableUdp->Random.seed(simulation->seed);
+    }
+    else
+    {
+        reliableUdp->Simulation.reset();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfReliableUdp_setMaxPeers(sfReliableUdp* reliableUdp, size_t maxPeers)
+{
+    assert(reliableUdp);
+    reliableUdp->MaxPeers = maxPeers;
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfReliableUdp_send(sfReliableUdp*        reliableUdp,
+                        sfIpAddressPacked     remoteAddress,
+                        unsigned short        remotePort,
+                        uint8_t               channel,
+                        sfReliableUdpDelivery delivery,
+                        const sfPacket*       packet)
+{
+    assert(reliableUdp);
+    assert(packet);
+
+    std::size_t size = 0;
+    const auto* data = static_cast<const std::byte*>(packet->getSendData(size));
+    if (size > sfReliableUdp_maxMessageSize())
+        return false;
+
+    sfReliableUdpPeer&   peer = getPeer(*reliableUdp, remoteAddress, remotePort);
+    sfReliableUdpMessage message{delivery, channel, 0, {data, data + size}};
+
+    switch (delivery)
+    {
+        case sfReliableUdpUnreliable:
+            peer.Unreliable.push_back(std::move(message));
+            return true;
+
+        case sfReliableUdpReliableUnordered:
+            message.Id = peer.Channels[channel].NextUnorderedId++;
+            break;
+
+        case sfReliableUdpReliableOrdered:
+            message.Id = peer.Channels[channel].NextOrderedId++;
+            break;
+    }
+
+    peer.Reliable.emplace(peer.NextSerial++, std::move(message));
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfReliableUdp_update(sfReliableUdp* reliableUdp)
+{
+    assert(reliableUdp);
+
+    // Receive everything available
+    std::array<std::array<std::byte, maxDatagramSize>, receiveBatchSize> buffers;
+    std::array<sfUdpDatagram, receiveBatchSize>                          datagrams{};
+    for (std::size_t i = 0; i < receiveBatchSize; ++i)
+        datagrams[i] = {buffers[i].data(), buffers[i].size(), 0, {}, 0};
+
+    for (;;)
+    {
+        std::size_t          count = 0;
+        const sfSocketStatus status =
+            sfUdpSocket_receiveBatch(reliableUdp->Socket, datagrams.data(), datagrams.size(), &count);
+        if (status == sfSocketNotReady)
+            break;
+        if (status != sfSocketDone)
+            return status;
+
+        const std::int64_t now = getTime();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const sfUdpDatagram& datagram = datagrams[i];
+            receiveDatagram(*reliableUdp,
+                            buffers[i].data(),
+                            datagram.received,
+                            datagram.remoteAddress,
+                            datagram.remotePort,
+                            now);
+        }
+
+        if (count < receiveBatchSize)
+            break;
+    }
+
+    // Send the messages and acknowledgements, then the datagrams delayed by the simulation which are due
+    const std::int64_t                        now = getTime();
+    std::vector<sfReliableUdpDelayedDatagram> outgoing;
+    for (auto& [key, peer] : reliableUdp->Peers)
+        flushPeer(*reliableUdp, peer, now, outgoing);
+
+    auto delayed = reliableUdp->Delayed.begin();
+    for (; delayed != reliableUdp->Delayed.end() && delayed->first <= now; ++delayed)
+        outgoing.push_back(std::move(delayed->second));
+    reliableUdp->Delayed.erase(reliableUdp->Delayed.begin(), delayed);
+
+    if (outgoing.empty())
+        return sfSocketDone;
+
+    std::vector<sfUdpDatagram> batch(outgoing.size());
+    for (std::size_t i = 0; i < outgoing.size(); ++i)
+        batch[i] = {outgoing[i].Data.data(), outgoing[i].Data.size(), 0, outgoing[i].Address, outgoing[i].Port};
+
+    // Datagrams which don't fit in the buffer of the socket are lost, like on the network
+    std::size_t sentTotal = 0;
+    while (sentTotal < batch.size())
+    {
+        std::size_t          sent   = 0;
+        const sfSocketStatus status = sfUdpSocket_sendBatch(reliableUdp->Socket,
+                                                            batch.data() + sentTotal,
+                                                            batch.size() - sentTotal,
+                                                            &sent);
+        if (status == sfSocketNotReady)
+            break;
+        if (status != sfSocketDone && status != sfSocketPartial)
+            return status;
+        sentTotal += sent;
+    }
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfReliableUdp_receive(sfReliableUdp*     reliableUdp,
+                           sfPacket*          packet,
+                           sfIpAddressPacked* remoteAddress,
+                           unsigned short*    remotePort,
+                           uint8_t*           channel)
+{
+    assert(reliableUdp);
+    assert(packet);
+
+    if (reliableUdp->Delivered.empty())
+        return false;
+
+    const sfReliableUdpDelivered& message = reliableUdp->Delivered.front();
+    packet->clear();
+    packet->onReceive(message.Data.data(), message.Data.size());
+
+    if (remoteAddress)
+        *remoteAddress = message.Address;
+    if (remotePort)
+        *remotePort = message.Port;
+    if (channel)
+        *channel = message.Channel;
+
+    reliableUdp->Delivered.pop_front();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfReliableUdp_getStats(const sfReliableUdp* reliableUdp,
+                            sfIpAddressPacked    remoteAddress,
+                            unsigned short       remotePort,
+                            sfReliableUdpStats*  stats)
+{
+    assert(reliableUdp);
+    assert(stats);
+
+    const auto peer = reliableUdp->Peers.find(getPeerKey(remoteAddress, remotePort));
+    if (peer == reliableUdp->Peers.end())
+        return false;
+
+    *stats                          = peer->second.Stats;
+    stats->rtt.microseconds         = static_cast<std::int64_t>(peer->second.Rtt);
+    stats->rttVariance.microseconds = static_cast<std::int64_t>(peer->second.RttVariance);
+    stats->pendingCount             = peer->second.Reliable.size();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfReliableUdp_disconnect(sfReliableUdp* reliableUdp, sfIpAddressPacked remoteAddress, unsigned short remotePort)
+{
+    assert(reliableUdp);
+    reliableUdp->Peers.erase(getPeerKey(remoteAddress, remotePort));
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfReliableUdp_maxMessageSize()
+{
+    return maxDatagramSize - headerSize - reliableHeaderSize;
+}
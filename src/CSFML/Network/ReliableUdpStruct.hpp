@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/ReliableUdp.h>
+#include <CSFML/System/Allocated.hpp>
+
+#include <deque>
+#include <map>
+#include <optional>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Message waiting to be sent, or to be acknowledged if it is reliable
+////////////////////////////////////////////////////////////
+struct sfReliableUdpMessage
+{
+    sfReliableUdpDelivery  Delivery{};
+    std::uint8_t           Channel{};
+    std::uint64_t          Id{}; // Position in the stream of its channel and delivery
+    std::vector<std::byte> Data;
+    std::int64_t           LastSent{-1}; // Time of the last send in microseconds, -1 if never sent
+};
+
+
+////////////////////////////////////////////////////////////
+// Datagram sent with messages, waiting to be acknowledged
+////////////////////////////////////////////////////////////
+struct sfReliableUdpSentDatagram
+{
+    std::int64_t               Time{};
+    std::vector<std::uint64_t> Messages; // Serials of the reliable messages it carries
+};
+
+
+////////////////////////////////////////////////////////////
+// Streams of messages of a channel, in both directions
+////////////////////////////////////////////////////////////
+struct sfReliableUdpChannel
+{
+    std::uint64_t NextOrderedId{};
+    std::uint64_t NextUnorderedId{};
+
+    std::uint64_t                                   NextOrderedDelivery{}; // Next ordered id to deliver
+    std::map<std::uint64_t, std::vector<std::byte>> OrderedArrived;        // Ordered messages arrived too early
+    std::uint64_t                                   UnorderedComplete{};   // All unordered ids below were received
+    std::set<std::uint64_t>                         UnorderedArrived;      // Unordered ids received above it
+};
+
+
+////////////////////////////////////////////////////////////
+// State of the connection with a remote peer
+////////////////////////////////////////////////////////////
+struct sfReliableUdpPeer
+{
+    sfIpAddressPacked Address{};
+    unsigned short    Port{};
+
+    // Datagrams sent, and acknowledgements of the datagrams received; sequence 0 means none
+    std::uint64_t                                       NextSequence{1};
+    std::map<std::uint64_t, sfReliableUdpSentDatagram> Sent;
+    std::uint64_t                                       HighestAck{};
+    bool                                                HasReceived{};
+    std::uint64_t                                       RemoteSequence{}; // Highest sequence received
+    std::uint32_t                                       ReceivedBits{};   // Bit i: RemoteSequence - 1 - i received
+    bool                                                AckPending{};
+
+    // Messages waiting to be sent, reliable ones by serial until they are acknowledged
+    std::vector<sfReliableUdpMessage>                      Unreliable;
+    std::map<std::uint64_t, sfReliableUdpMessage>          Reliable;
+    std::uint64_t                                          NextSerial{};
+    std::unordered_map<std::uint8_t, sfReliableUdpChannel> Channels;
+    std::size_t                                            ArrivedCount{}; // Messages held by the channels
+
+    // Statistics, with times in microseconds
+    bool               HasRtt{};
+    double             Rtt{};
+    double             RttVariance{};
+    sfReliableUdpStats Stats{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Outgoing datagram held back by the network simulation
+////////////////////////////////////////////////////////////
+struct sfReliableUdpDelayedDatagram
+{
+    std::vector<std::byte> Data;
+    sfIpAddressPacked      Address{};
+    unsigned short         Port{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Message received and ready to be delivered
+////////////////////////////////////////////////////////////
+struct sfReliableUdpDelivered
+{
+    std::vector<std::byte> Data;
+    sfIpAddressPacked      Address{};
+    unsigned short         Port{};
+    std::uint8_t           Channel{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfReliableUdp
+////////////////////////////////////////////////////////////
+struct sfReliableUdp : Allocated<sfAllocModuleNetwork>
+{
+    sfUdpSocket*                                              Socket{};
+    std::unordered_map<std::uint64_t, sfReliableUdpPeer>      Peers; // By address and port
+    std::deque<sfReliableUdpDelivered>                        Delivered;
+    std::optional<sfReliableUdpSimulation>                    Simulation;
+    std::minstd_rand                                          Random;
+    std::multimap<std::int64_t, sfReliableUdpDelayedDatagram> Delayed; // By time of release
+    std::size_t                                               MaxPeers{}; // Peers that received datagrams can create
+};
@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/SocketPoller.h>
+#include <CSFML/Network/SocketPollerStruct.hpp>
+#include <CSFML/Network/TcpListenerStruct.hpp>
+#include <CSFML/Network/TcpSocketStruct.hpp>
+#include <CSFML/Network/UdpSocketStruct.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+template <typename Socket>
+bool addSocket(sfSocketPoller& poller, Socket& socket, const sfSocketPollerEvent& event)
+{
+    auto& entry = poller.Sockets[&socket];
+    if (entry)
+    {
+        entry->userData = event.userData;
+        return true;
+    }
+
+    // Sockets only get a native handle once they are bound, listening or connected
+    if (socket.getNativeHandle() == static_cast<sf::SocketHandle>(-1))
+    {
+        poller.Sockets.erase(&socket);
+        return false;
+    }
+
+    entry = std::make_unique<sfSocketPollerEvent>(event);
+
+#if defined(CSFML_SYSTEM_LINUX)
+    epoll_event epollEvent{};
+    epollEvent.events   = EPOLLIN | EPOLLRDHUP;
+    epollEvent.data.ptr = entry.get();
+    if (poller.Mode == sfSocketPollerEdgeTriggered)
+        epollEvent.events |= EPOLLET;
+
+    if (epoll_ctl(poller.EpollHandle, EPOLL_CTL_ADD, socket.getNativeHandle(), &epollEvent) != 0)
+    {
+        poller.Sockets.erase(&socket);
+        return false;
+    }
+#else
+    poller.Selector.add(socket);
+#endif
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Socket>
+void removeSocket(sfSocketPoller& poller, Socket& socket)
+{
+    const auto it = poller.Sockets.find(&socket);
+    if (it == poller.Sockets.end())
+        return;
+
+#if defined(CSFML_SYSTEM_LINUX)
+    epoll_ctl(poller.EpollHandle, EPOLL_CTL_DEL, socket.getNativeHandle(), nullptr);
+#else
+    poller.Selector.remove(socket);
+#endif
+
+    poller.Sockets.erase(it);
+}
+
+#if !defined(CSFML_SYSTEM_LINUX)
+
+////////////////////////////////////////////////////////////
+bool isReady(const sfSocketPoller& poller, const sfSocketPollerEvent& event)
+{
+    if (event.tcpListener)
+        return poller.Selector.isReady(*event.tcpListener);
+    if (event.tcpSocket)
+        return poller.Selector.isReady(*event.tcpSocket);
+    return poller.Selector.isReady(*event.udpSocket);
+}
+
+#endif
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+sfSocketPoller* sfSocketPoller_create(sfSocketPollerMode mode)
+{
+    auto poller  = std::make_unique<sfSocketPoller>();
+    poller->Mode = mode;
+
+#if defined(CSFML_SYSTEM_LINUX)
+    poller->EpollHandle = epoll_create1(EPOLL_CLOEXEC);
+    if (poller->EpollHandle < 0)
+        return nullptr;
+#endif
+
+    return poller.release();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSocketPoller_destroy(const sfSocketPoller* poller)
+{
+    delete poller;
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfSocketPoller_addTcpListener(sfSocketPoller* poller, sfTcpListener* socket, void* userData)
+{
+    assert(poller);
+    assert(socket);
+    return addSocket(*poller, *socket, {socket, nullptr, nullptr, userData});
+}
+bool sfSocketPoller_addTcpSocket(sfSocketPoller* poller, sfTcpSocket* socket, void* userData)
+{
+    assert(poller);
+    assert(socket);
+    return addSocket(*poller, *socket, {nullptr, socket, nullptr, userData});
+}
+bool sfSocketPoller_addUdpSocket(sfSocketPoller* poller, sfUdpSocket* socket, void* userData)
+{
+    assert(poller);
+    assert(socket);
+    return addSocket(*poller, *socket, {nullptr, nullptr, socket, userData});
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSocketPoller_removeTcpListener(sfSocketPoller* poller, sfTcpListener* socket)
+{
+    assert(poller);
+    assert(socket);
+    removeSocket(*poller, *socket);
+}
+void sfSocketPoller_removeTcpSocket(sfSocketPoller* poller, sfTcpSocket* socket)
+{
+    assert(poller);
+    assert(socket);
+    removeSocket(*poller, *socket);
+}
+void sfSocketPoller_removeUdpSocket(sfSocketPoller* poller, sfUdpSocket* socket)
+{
+    assert(poller);
+    assert(socket);
+    removeSocket(*poller, *socket);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfSocketPoller_getSocketCount(const sfSocketPoller* poller)
+{
+    assert(poller);
+    return poller->Sockets.size();
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfSocketPoller_wait(sfSocketPoller*      poller,
+                                   sfSocketPollerEvent* events,
+                                   size_t               maxEvents,
+                                   size_t*              eventCount,
+                                   sfTime               timeout)
+{
+    assert(poller);
+    assert(events || maxEvents == 0);
+    assert(eventCount);
+
+    *eventCount = 0;
+    if (maxEvents == 0)
+        return sfSocketNotReady;
+
+#if defined(CSFML_SYSTEM_LINUX)
+    constexpr auto maxInt = std::numeric_limits<int>::max();
+
+    const int maxCount = static_cast<int>(std::min(maxEvents, static_cast<std::size_t>(maxInt)));
+    if (poller->ReadyEvents.size() < maxEvents)
+        poller->ReadyEvents.resize(static_cast<std::size_t>(maxCount));
+
+    // Round the timeout up to whole milliseconds, a zero timeout meaning infinity
+    const auto deadline  = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout.microseconds);
+    const auto toTimeout = [&]
+    {
+        if (timeout.microseconds <= 0)
+            return -1;
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, maxInt));
+    };
+
+    int count = 0;
+    do
+    {
+        count = epoll_wait(poller->EpollHandle, poller->ReadyEvents.data(), maxCount, toTimeout());
+    } while (count < 0 && errno == EINTR);
+
+    if (count < 0)
+        return sfSocketError;
+    if (count == 0)
+        return sfSocketNotReady;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(count); ++i)
+        events[i] = *static_cast<const sfSocketPollerEvent*>(poller->ReadyEvents[i].data.ptr);
+
+    *eventCount = static_cast<std::size_t>(count);
+    return sfSocketDone;
+#else
+    // sf::SocketSelector reports errors as timeouts
+    if (!poller->Selector.wait(sf::microseconds(timeout.microseconds)))
+        return sfSocketNotReady;
+
+    // Start after the last socket visited by the previous wait, so that the ready
+    // sockets which did not fit in events are the first ones reported next time
+    auto        socket = poller->Sockets.find(poller->NextSocket);
+    std::size_t count  = 0;
+    for (std::size_t i = 0; i < poller->Sockets.size() && count < maxEvents; ++i, ++socket)
+    {
+        if (socket == poller->Sockets.end())
+            socket = poller->Sockets.begin();
+        if (isReady(*poller, *socket->second))
+            events[count++] = *socket->second;
+    }
+    poller->NextSocket = socket != poller->Sockets.end() ? socket->first : nullptr;
+
+    *eventCount = count;
+    return count > 0 ? sfSocketDone : sfSocketNotReady;
+#endif
+}
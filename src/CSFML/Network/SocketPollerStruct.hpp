@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/SocketPoller.h>
+#include <CSFML/System/Allocated.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#if defined(CSFML_SYSTEM_LINUX)
+#include <sys/epoll.h>
+#include <unistd.h>
+#else
+#include <SFML/Network/SocketSelector.hpp>
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfSocketPoller
+////////////////////////////////////////////////////////////
+struct sfSocketPoller : Allocated<sfAllocModuleNetwork>
+{
+#if defined(CSFML_SYSTEM_LINUX)
+    sfSocketPoller() = default;
+    sfSocketPoller(const sfSocketPoller&) = delete;
+    sfSocketPoller& operator=(const sfSocketPoller&) = delete;
+
+    ~sfSocketPoller()
+    {
+        if (EpollHandle >= 0)
+            ::close(EpollHandle);
+    }
+
+    int                      EpollHandle{-1};
+    std::vector<epoll_event> ReadyEvents;
+#else
+    sf::SocketSelector Selector;
+    const void*        NextSocket{}; // Registered socket where the next wait starts looking for ready sockets
+#endif
+
+    sfSocketPollerMode Mode{};
+
+    // Registered sockets, keyed by their CSFML object; the events
+    // are stable in memory so that epoll can point to them
+    std::unordered_map<const void*, std::unique_ptr<sfSocketPollerEvent>> Sockets;
+};
@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Network/SocketSelector.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSocketSelector
 ////////////////////////////////////////////////////////////
-struct sfSocketSelector : sf::SocketSelector
+struct sfSocketSelector : sf::SocketSelector, Allocated<sfAllocModuleNetwork>
 {
 };
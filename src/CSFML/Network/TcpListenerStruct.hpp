@@ -27,12 +27,15 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Network/TcpListener.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTcpListener
 ////////////////////////////////////////////////////////////
-struct sfTcpListener : sf::TcpListener
+struct sfTcpListener : sf::TcpListener, Allocated<sfAllocModuleNetwork>
 {
+    using sf::TcpListener::getNativeHandle;
 };
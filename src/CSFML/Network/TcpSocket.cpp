@@ -26,13 +26,107 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/Network/PacketStruct.hpp>
+#include <CSFML/Network/SocketError.hpp>
 #include <CSFML/Network/TcpSocket.h>
 #include <CSFML/Network/TcpSocketStruct.hpp>
 
 #include <SFML/Network/IpAddress.hpp>
 
+#include <algorithm>
+#include <array>
+
+#include <cstdint>
 #include <cstring>
 
+#if !defined(CSFML_SYSTEM_WINDOWS)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Maximum number of blocks handed to a single system call
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxVectorCount = 64;
+
+
+////////////////////////////////////////////////////////////
+// Send blocks of data, skipping the first \a sent bytes
+////////////////////////////////////////////////////////////
+sfSocketStatus sendVectors(sfTcpSocket& socket, const sfIoVec* vecs, std::size_t count, std::size_t& sent)
+{
+    const std::size_t initialSent = sent;
+
+    // Offset in the first block which is not completely sent
+    std::size_t offset = sent;
+    const auto  skipSentBlocks = [&]
+    {
+        while (count > 0 && offset >= vecs->size)
+        {
+            offset -= vecs->size;
+            ++vecs;
+            --count;
+        }
+    };
+    skipSentBlocks();
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    // No vectored send through SFML, send the blocks one by one
+    for (; count > 0; ++vecs, --count, offset = 0)
+    {
+        std::size_t blockSent = 0;
+        const auto  status = socket.send(static_cast<const char*>(vecs->data) + offset, vecs->size - offset, blockSent);
+        sent += blockSent;
+
+        if (status == sf::Socket::Status::NotReady && sent > initialSent)
+            return sfSocketPartial;
+        if (status != sf::Socket::Status::Done)
+            return static_cast<sfSocketStatus>(status);
+    }
+#else
+#if defined(MSG_NOSIGNAL)
+    constexpr int flags = MSG_NOSIGNAL;
+#else
+    constexpr int flags = 0;
+#endif
+
+    std::array<iovec, maxVectorCount> buffers{};
+    while (count > 0)
+    {
+        const std::size_t batchSize = std::min(count, maxVectorCount);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            const std::size_t skipped = i == 0 ? offset : 0;
+            buffers[i].iov_base       = const_cast<char*>(static_cast<const char*>(vecs[i].data)) + skipped;
+            buffers[i].iov_len        = vecs[i].size - skipped;
+        }
+
+        msghdr message{};
+        message.msg_iov    = buffers.data();
+        message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(batchSize);
+
+        const auto result = ::sendmsg(socket.getNativeHandle(), &message, flags);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            const sfSocketStatus status = getErrorStatus(errno);
+            return status == sfSocketNotReady && sent > initialSent ? sfSocketPartial : status;
+        }
+
+        sent += static_cast<std::size_t>(result);
+        offset += static_cast<std::size_t>(result);
+        skipSentBlocks();
+    }
+#endif
+
+    return sfSocketDone;
+}
+} // namespace
+
 
 ////////////////////////////////////////////////////////////
 sfTcpSocket* sfTcpSocket_create()
@@ -136,6 +230,17 @@ sfSocketStatus sfTcpSocket_sendPartial(sfTcpSocket* socket, const void* data, si
 }
 
 
+////////////////////////////////////////////////////////////
+sfSocketStatus sfTcpSocket_sendv(sfTcpSocket* socket, const sfIoVec* vecs, size_t count, size_t* sent)
+{
+    assert(socket);
+    assert(vecs || count == 0);
+
+    std::size_t tempSent = 0;
+    return sendVectors(*socket, vecs, count, sent ? *sent : tempSent);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_receive(sfTcpSocket* socket, void* data, size_t size, size_t* received)
 {
@@ -162,10 +267,71 @@ sfSocketStatus sfTcpSocket_sendPacket(sfTcpSocket* socket, sfPacket* packet)
 }
 
 
+////////////////////////////////////////////////////////////
+sfSocketStatus sfTcpSocket_sendPacketsv(sfTcpSocket*           socket,
+                                        const sfPacket* const* packets,
+                                        size_t                 count,
+                                        size_t*                sent)
+{
+    assert(socket);
+    assert(packets || count == 0);
+
+    std::size_t       tempSent    = 0;
+    std::size_t&      totalSent   = sent ? *sent : tempSent;
+    const std::size_t initialSent = totalSent;
+    constexpr auto    batchSize   = maxVectorCount / 2;
+
+    // Each packet is sent as its size, in big endian, followed by its data
+    std::array<std::array<unsigned char, 4>, batchSize> prefixes{};
+    std::array<sfIoVec, maxVectorCount>                 vecs{};
+
+    std::size_t batchStart = 0;
+    for (std::size_t first = 0; first < count; first += batchSize)
+    {
+        const std::size_t packetCount = std::min(count - first, batchSize);
+        std::size_t       batchBytes  = 0;
+
+        for (std::size_t i = 0; i < packetCount; ++i)
+        {
+            assert(packets[first + i]);
+            std::size_t         size   = 0;
+            const void*         data   = packets[first + i]->getSendData(size);
+            const std::uint32_t prefix = static_cast<std::uint32_t>(size);
+
+            prefixes[i]     = {static_cast<unsigned char>(prefix >> 24),
+                               static_cast<unsigned char>(prefix >> 16),
+                               static_cast<unsigned char>(prefix >> 8),
+                               static_cast<unsigned char>(prefix)};
+            vecs[i * 2]     = {prefixes[i].data(), prefixes[i].size()};
+            vecs[i * 2 + 1] = {data, size};
+            batchBytes += prefixes[i].size() + size;
+        }
+
+        // Skip the batches sent by previous calls
+        if (initialSent < batchStart + batchBytes)
+        {
+            std::size_t          batchSent = initialSent > batchStart ? initialSent - batchStart : 0;
+            const sfSocketStatus status    = sendVectors(*socket, vecs.data(), packetCount * 2, batchSent);
+            totalSent                      = batchStart + batchSent;
+
+            if (status == sfSocketNotReady && totalSent > initialSent)
+                return sfSocketPartial;
+            if (status != sfSocketDone)
+                return status;
+        }
+
+        batchStart += batchBytes;
+    }
+
+    totalSent = batchStart;
+    return sfSocketDone;
+}
+
+
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_receivePacket(sfTcpSocket* socket, sfPacket* packet)
 {
     assert(socket);
     assert(packet);
-    return static_cast<sfSocketStatus>(socket->receive(*packet));
+    return static_cast<sfSocketStatus>(packet->receiveFrom(*socket));
 }
@@ -27,12 +27,16 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Network/TcpSocket.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTcpSocket
 ////////////////////////////////////////////////////////////
-struct sfTcpSocket : sf::TcpSocket
+struct sfTcpSocket : sf::TcpSocket, Allocated<sfAllocModuleNetwork>
 {
+    using sf::TcpSocket::create;
+    using sf::TcpSocket::getNativeHandle;
 };
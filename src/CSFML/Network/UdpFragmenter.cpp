@@ -0,0 +1,358 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/PacketStruct.hpp>
+#include <CSFML/Network/UdpFragmenter.h>
+#include <CSFML/Network/UdpFragmenterStruct.hpp>
+#include <CSFML/Network/UdpSocket.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+
+#include <cassert>
+#include <cstring>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Layout of the fragments, all integers being big endian:
+//   message id (32 bits), message size (32 bits), fragment index (32 bits), data
+// Every fragment but the last one of a message carries fragmentDataSize bytes of it
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxDatagramSize  = 1200; // Stays below the MTU of common networks
+constexpr std::size_t headerSize       = 12;
+constexpr std::size_t fragmentDataSize = maxDatagramSize - headerSize;
+constexpr std::size_t messageOverhead  = 256; // Memory counted for each incomplete message on top of its size
+constexpr std::size_t completedCount   = 256; // Recent messages whose late fragments are ignored
+constexpr std::size_t receiveBatchSize = 32;
+
+constexpr sfUdpFragmenterLimits defaultLimits = {1024 * 1024, 4 * 1024 * 1024, 64 * 1024 * 1024, {2'000'000}};
+
+
+////////////////////////////////////////////////////////////
+std::int64_t getTime()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t getPeerKey(const sfIpAddressPacked& address, unsigned short port)
+{
+    return std::uint64_t{address.integer} << 16 | port;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getFragmentCount(std::size_t messageSize)
+{
+    return std::max<std::size_t>(1, (messageSize + fragmentDataSize - 1) / fragmentDataSize);
+}
+
+
+////////////////////////////////////////////////////////////
+void write32(std::byte* output, std::size_t value)
+{
+    for (std::size_t i = 0; i < 4; ++i)
+        output[i] = static_cast<std::byte>(value >> (24 - 8 * i));
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t read32(const std::byte* input)
+{
+    return std::uint32_t{std::to_integer<std::uint8_t>(input[0])} << 24 |
+           std::uint32_t{std::to_integer<std::uint8_t>(input[1])} << 16 |
+           std::uint32_t{std::to_integer<std::uint8_t>(input[2])} << 8 | std::to_integer<std::uint8_t>(input[3]);
+}
+
+
+////////////////////////////////////////////////////////////
+void discardMessage(sfUdpFragmenter&                                                    fragmenter,
+                    sfUdpFragmenterPeer&                                                peer,
+                    std::unordered_map<std::uint32_t, sfUdpFragmentedMessage>::iterator message)
+{
+    peer.Memory -= message->second.Memory;
+    fragmenter.Memory -= message->second.Memory;
+    peer.Expiries.erase(message->second.Expiry);
+    peer.Messages.erase(message);
+}
+
+
+////////////////////////////////////////////////////////////
+void discardExpiredMessages(sfUdpFragmenter& fragmenter, std::int64_t now)
+{
+    for (auto peer = fragmenter.Peers.begin(); peer != fragmenter.Peers.end();)
+    {
+        std::multimap<std::int64_t, std::uint32_t>& expiries = peer->second.Expiries;
+        while (!expiries.empty() && expiries.begin()->first <= now)
+            discardMessage(fragmenter, peer->second, peer->second.Messages.find(expiries.begin()->second));
+
+        if (peer->second.Messages.empty())
+            peer = fragmenter.Peers.erase(peer);
+        else
+            ++peer;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Find the message a fragment belongs to, or start reassembling it if it fits in the limits
+////////////////////////////////////////////////////////////
+sfUdpFragmentedMessage* getMessage(sfUdpFragmenter& fragmenter,
+                                   std::uint64_t    peerKey,
+                                   std::uint32_t    id,
+                                   std::size_t      size,
+                                   std::int64_t     now)
+{
+    const auto existing = fragmenter.Peers.find(peerKey);
+    if (existing != fragmenter.Peers.end())
+    {
+        const auto message = existing->second.Messages.find(id);
+        if (message != existing->second.Messages.end())
+            return message->second.Data.size() == size ? &message->second : nullptr;
+    }
+
+    if (std::find(fragmenter.Completed.begin(), fragmenter.Completed.end(), std::pair(peerKey, id)) !=
+        fragmenter.Completed.end())
+        return nullptr;
+
+    const std::size_t memory = size + messageOverhead;
+    if (memory > fragmenter.Limits.maxPeerMemory)
+        return nullptr;
+
+    // Make room among the messages of the peer first, so that it can't evict the messages of the other peers
+    sfUdpFragmenterPeer& peer = fragmenter.Peers[peerKey];
+    while (peer.Memory + memory > fragmenter.Limits.maxPeerMemory)
+        discardMessage(fragmenter, peer, peer.Messages.find(peer.Expiries.begin()->second));
+
+    if (fragmenter.Memory + memory > fragmenter.Limits.maxMemory)
+    {
+        if (peer.Messages.empty())
+            fragmenter.Peers.erase(peerKey);
+        return nullptr;
+    }
+
+    const std::size_t       fragmentCount = getFragmentCount(size);
+    sfUdpFragmentedMessage& message       = peer.Messages[id];
+    message.Data.resize(size);
+    message.Received.resize(fragmentCount);
+    message.MissingCount = fragmentCount;
+    message.Memory       = memory;
+    message.Expiry       = peer.Expiries.emplace(now + fragmenter.Limits.timeout.microseconds, id);
+    peer.Memory += memory;
+    fragmenter.Memory += memory;
+    return &message;
+}
+
+
+////////////////////////////////////////////////////////////
+void receiveFragment(sfUdpFragmenter&         fragmenter,
+                     const std::byte*         data,
+                     std::size_t              size,
+                     const sfIpAddressPacked& address,
+                     unsigned short           port,
+                     std::int64_t             now)
+{
+    // Validate the whole fragment against the limits before allocating anything
+    if (size < headerSize)
+        return;
+
+    const std::uint32_t id          = read32(data);
+    const std::uint32_t messageSize = read32(data + 4);
+    const std::uint32_t index       = read32(data + 8);
+    if (messageSize > fragmenter.Limits.maxMessageSize || index >= getFragmentCount(messageSize))
+        return;
+
+    const std::size_t offset = std::size_t{index} * fragmentDataSize;
+    if (size - headerSize != std::min(fragmentDataSize, messageSize - offset))
+        return;
+
+    // Messages made of a single fragment don't need to be reassembled
+    if (messageSize <= fragmentDataSize)
+    {
+        fragmenter.Delivered.push_back({{data + headerSize, data + size}, address, port});
+        return;
+    }
+
+    const std::uint64_t     peerKey = getPeerKey(address, port);
+    sfUdpFragmentedMessage* message = getMessage(fragmenter, peerKey, id, messageSize, now);
+    if (!message || message->Received[index])
+        return;
+
+    message->Received[index] = true;
+    std::memcpy(message->Data.data() + offset, data + headerSize, size - headerSize);
+    if (--message->MissingCount > 0)
+        return;
+
+    sfUdpFragmenterPeer& peer = fragmenter.Peers[peerKey];
+    fragmenter.Delivered.push_back({std::move(message->Data), address, port});
+    discardMessage(fragmenter, peer, peer.Messages.find(id));
+
+    fragmenter.Completed.emplace_back(peerKey, id);
+    if (fragmenter.Completed.size() > completedCount)
+        fragmenter.Completed.pop_front();
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+sfUdpFragmenter* sfUdpFragmenter_create(sfUdpSocket* socket)
+{
+    assert(socket);
+
+    auto* fragmenter   = new sfUdpFragmenter;
+    fragmenter->Socket = socket;
+    fragmenter->Limits = defaultLimits;
+    return fragmenter;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfUdpFragmenter_destroy(const sfUdpFragmenter* fragmenter)
+{
+    delete fragmenter;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfUdpFragmenter_setLimits(sfUdpFragmenter* fragmenter, const sfUdpFragmenterLimits* limits)
+{
+    assert(fragmenter);
+    assert(limits);
+
+    fragmenter->Limits = *limits;
+}
+
+
+////////////////////////////////////////////////////////////
+sfUdpFragmenterLimits sfUdpFragmenter_getLimits(const sfUdpFragmenter* fragmenter)
+{
+    assert(fragmenter);
+    return fragmenter->Limits;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpFragmenter_send(sfUdpFragmenter*  fragmenter,
+                                    const sfPacket*   packet,
+                                    sfIpAddressPacked remoteAddress,
+                                    unsigned short    remotePort)
+{
+    assert(fragmenter);
+    assert(packet);
+
+    std::size_t size = 0;
+    const auto* data = static_cast<const std::byte*>(packet->getSendData(size));
+    if (size > fragmenter->Limits.maxMessageSize || size > std::numeric_limits<std::uint32_t>::max())
+        return sfSocketError;
+
+    const std::size_t          fragmentCount = getFragmentCount(size);
+    const std::uint32_t        id            = fragmenter->NextId++;
+    std::vector<sfUdpDatagram> datagrams(fragmentCount);
+    fragmenter->SendBuffer.resize(fragmentCount * maxDatagramSize);
+
+    for (std::size_t i = 0; i < fragmentCount; ++i)
+    {
+        const std::size_t offset       = i * fragmentDataSize;
+        const std::size_t fragmentSize = std::min(fragmentDataSize, size - offset);
+        std::byte*        fragment     = fragmenter->SendBuffer.data() + i * maxDatagramSize;
+
+        write32(fragment, id);
+        write32(fragment + 4, size);
+        write32(fragment + 8, i);
+        if (fragmentSize > 0)
+            std::memcpy(fragment + headerSize, data + offset, fragmentSize);
+
+        datagrams[i] = {fragment, headerSize + fragmentSize, 0, remoteAddress, remotePort};
+    }
+
+    return sfUdpSocket_sendBatch(fragmenter->Socket, datagrams.data(), datagrams.size(), nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpFragmenter_receive(sfUdpFragmenter*   fragmenter,
+                                       sfPacket*          packet,
+                                       sfIpAddressPacked* remoteAddress,
+                                       unsigned short*    remotePort)
+{
+    assert(fragmenter);
+    assert(packet);
+
+    std::array<std::array<std::byte, maxDatagramSize>, receiveBatchSize> buffers;
+    std::array<sfUdpDatagram, receiveBatchSize>                          datagrams{};
+    for (std::size_t i = 0; i < receiveBatchSize; ++i)
+        datagrams[i] = {buffers[i].data(), buffers[i].size(), 0, {}, 0};
+
+    while (fragmenter->Delivered.empty())
+    {
+        discardExpiredMessages(*fragmenter, getTime());
+
+        std::size_t          count = 0;
+        const sfSocketStatus status =
+            sfUdpSocket_receiveBatch(fragmenter->Socket, datagrams.data(), datagrams.size(), &count);
+        if (status != sfSocketDone)
+            return status;
+
+        const std::int64_t now = getTime();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const sfUdpDatagram& datagram = datagrams[i];
+            receiveFragment(*fragmenter,
+                            buffers[i].data(),
+                            datagram.received,
+                            datagram.remoteAddress,
+                            datagram.remotePort,
+                            now);
+        }
+    }
+
+    const sfUdpFragmenterDelivered& message = fragmenter->Delivered.front();
+    packet->clear();
+    packet->onReceive(message.Data.data(), message.Data.size());
+
+    if (remoteAddress)
+        *remoteAddress = message.Address;
+    if (remotePort)
+        *remotePort = message.Port;
+
+    fragmenter->Delivered.pop_front();
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfUdpFragmenter_getPendingMemory(const sfUdpFragmenter* fragmenter)
+{
+    assert(fragmenter);
+    return fragmenter->Memory;
+}
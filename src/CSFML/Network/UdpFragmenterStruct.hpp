@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/Network/UdpFragmenter.h>
+#include <CSFML/System/Allocated.hpp>
+
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Message of which some fragments were received
+////////////////////////////////////////////////////////////
+struct sfUdpFragmentedMessage
+{
+    std::vector<std::byte>                               Data;
+    std::vector<bool>                                    Received; // By fragment
+    std::size_t                                          MissingCount{};
+    std::size_t                                          Memory{}; // Counted against the limits
+    std::multimap<std::int64_t, std::uint32_t>::iterator Expiry; // Entry in the expiries of the peer
+};
+
+
+////////////////////////////////////////////////////////////
+// Messages being reassembled from a remote peer
+////////////////////////////////////////////////////////////
+struct sfUdpFragmenterPeer
+{
+    std::unordered_map<std::uint32_t, sfUdpFragmentedMessage> Messages; // By id
+    std::multimap<std::int64_t, std::uint32_t>                Expiries; // Ids by time of expiry, oldest first
+    std::size_t                                               Memory{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Message reassembled and ready to be delivered
+////////////////////////////////////////////////////////////
+struct sfUdpFragmenterDelivered
+{
+    std::vector<std::byte> Data;
+    sfIpAddressPacked      Address{};
+    unsigned short         Port{};
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfUdpFragmenter
+////////////////////////////////////////////////////////////
+struct sfUdpFragmenter : Allocated<sfAllocModuleNetwork>
+{
+    sfUdpSocket*                                           Socket{};
+    sfUdpFragmenterLimits                                  Limits{};
+    std::uint32_t                                          NextId{};
+    std::unordered_map<std::uint64_t, sfUdpFragmenterPeer> Peers; // By address and port
+    std::size_t                                            Memory{};
+    std::deque<std::pair<std::uint64_t, std::uint32_t>>    Completed; // Peers and ids of recent messages
+    std::deque<sfUdpFragmenterDelivered>                   Delivered;
+    std::vector<std::byte>                                 SendBuffer;
+};
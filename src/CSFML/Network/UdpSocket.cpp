@@ -25,14 +25,219 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/Network/ConvertIpAddress.hpp>
 #include <CSFML/Network/PacketStruct.hpp>
+#include <CSFML/Network/SocketError.hpp>
 #include <CSFML/Network/UdpSocket.h>
 #include <CSFML/Network/UdpSocketStruct.hpp>
 
 #include <SFML/Network/IpAddress.hpp>
 
+#include <algorithm>
+#include <array>
+
 #include <cstring>
 
+#if defined(CSFML_SYSTEM_LINUX) || defined(CSFML_SYSTEM_FREEBSD)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <cerrno>
+
+#define CSFML_UDP_BATCHED_SYSCALLS
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Send a single datagram through SFML
+////////////////////////////////////////////////////////////
+sf::Socket::Status sendOne(sfUdpSocket& socket, const sfUdpDatagram& datagram)
+{
+    if (datagram.remoteAddress.address.address[0] == '\0')
+        return sf::Socket::Status::Error;
+
+    return socket.send(datagram.data, datagram.size, convertIpAddress(datagram.remoteAddress), datagram.remotePort);
+}
+
+#if defined(CSFML_UDP_BATCHED_SYSCALLS)
+
+////////////////////////////////////////////////////////////
+// Maximum number of datagrams handed to a single system call
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxBatchSize = 64;
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus receiveDatagrams(sfUdpSocket&   socket,
+                                sfUdpDatagram* datagrams,
+                                std::size_t    count,
+                                std::size_t&   receivedCount)
+{
+    std::array<mmsghdr, maxBatchSize>     messages{};
+    std::array<iovec, maxBatchSize>       buffers{};
+    std::array<sockaddr_in, maxBatchSize> addresses{};
+
+    while (receivedCount < count)
+    {
+        const std::size_t batchSize = std::min(count - receivedCount, maxBatchSize);
+        sfUdpDatagram*    batch     = datagrams + receivedCount;
+
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            buffers[i]                      = {batch[i].data, batch[i].size};
+            messages[i]                     = {};
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Only the first system call may block, and only until the first datagram arrives
+        const int flags  = receivedCount == 0 ? (socket.isBlocking() ? MSG_WAITFORONE : 0) : MSG_DONTWAIT;
+        const int result = recvmmsg(socket.getNativeHandle(),
+                                    messages.data(),
+                                    static_cast<unsigned int>(batchSize),
+                                    flags,
+                                    nullptr);
+        if (result < 0)
+            return receivedCount > 0 ? sfSocketDone : getErrorStatus(errno);
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            batch[i].received      = messages[i].msg_len;
+            batch[i].remoteAddress = convertIpAddress(ntohl(addresses[i].sin_addr.s_addr));
+            batch[i].remotePort    = ntohs(addresses[i].sin_port);
+        }
+
+        receivedCount += static_cast<std::size_t>(result);
+        if (static_cast<std::size_t>(result) < batchSize)
+            break;
+    }
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sendDatagrams(sfUdpSocket&         socket,
+                             const sfUdpDatagram* datagrams,
+                             std::size_t          count,
+                             std::size_t&         sentCount)
+{
+    // The socket is only created by the first send, which has to go through SFML
+    if (socket.getNativeHandle() < 0)
+    {
+        const sf::Socket::Status status = sendOne(socket, datagrams[0]);
+        if (status != sf::Socket::Status::Done)
+            return static_cast<sfSocketStatus>(status);
+        ++sentCount;
+    }
+
+    std::array<mmsghdr, maxBatchSize>     messages{};
+    std::array<iovec, maxBatchSize>       buffers{};
+    std::array<sockaddr_in, maxBatchSize> addresses{};
+
+    while (sentCount < count)
+    {
+        const std::size_t    batchSize = std::min(count - sentCount, maxBatchSize);
+        const sfUdpDatagram* batch     = datagrams + sentCount;
+
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            if (batch[i].remoteAddress.address.address[0] == '\0')
+                return sentCount > 0 ? sfSocketPartial : sfSocketError;
+
+            addresses[i]                    = {};
+            addresses[i].sin_family         = AF_INET;
+            addresses[i].sin_addr.s_addr    = htonl(batch[i].remoteAddress.integer);
+            addresses[i].sin_port           = htons(batch[i].remotePort);
+            buffers[i]                      = {batch[i].data, batch[i].size};
+            messages[i]                     = {};
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int result = sendmmsg(socket.getNativeHandle(), messages.data(), static_cast<unsigned int>(batchSize), 0);
+        if (result < 0)
+            return sentCount > 0 ? sfSocketPartial : getErrorStatus(errno);
+
+        sentCount += static_cast<std::size_t>(result);
+        if (static_cast<std::size_t>(result) < batchSize)
+            return sfSocketPartial;
+    }
+
+    return sfSocketDone;
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+// Receive a single datagram, for the unbatched path
+////////////////////////////////////////////////////////////
+sf::Socket::Status receiveOne(sfUdpSocket& socket, sfUdpDatagram& datagram)
+{
+    std::optional<sf::IpAddress> address;
+    unsigned short               port         = 0;
+    std::size_t                  sizeReceived = 0;
+
+    const sf::Socket::Status status = socket.receive(datagram.data, datagram.size, sizeReceived, address, port);
+    if (status == sf::Socket::Status::Done)
+    {
+        datagram.received      = sizeReceived;
+        datagram.remoteAddress = address ? convertIpAddress(*address) : sfIpAddressPacked{};
+        datagram.remotePort    = port;
+    }
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus receiveDatagrams(sfUdpSocket&   socket,
+                                sfUdpDatagram* datagrams,
+                                std::size_t    count,
+                                std::size_t&   receivedCount)
+{
+    while (receivedCount < count)
+    {
+        const sf::Socket::Status status = receiveOne(socket, datagrams[receivedCount]);
+        if (status != sf::Socket::Status::Done)
+            return receivedCount > 0 ? sfSocketDone : static_cast<sfSocketStatus>(status);
+
+        ++receivedCount;
+
+        // A blocking socket would wait for each of the next datagrams
+        if (socket.isBlocking())
+            break;
+    }
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sendDatagrams(sfUdpSocket&         socket,
+                             const sfUdpDatagram* datagrams,
+                             std::size_t          count,
+                             std::size_t&         sentCount)
+{
+    for (; sentCount < count; ++sentCount)
+    {
+        const sf::Socket::Status status = sendOne(socket, datagrams[sentCount]);
+        if (status != sf::Socket::Status::Done)
+            return sentCount > 0 ? sfSocketPartial : static_cast<sfSocketStatus>(status);
+    }
+
+    return sfSocketDone;
+}
+
+#endif
+} // namespace
+
 
 ////////////////////////////////////////////////////////////
 sfUdpSocket* sfUdpSocket_create()
@@ -177,7 +382,7 @@ sfSocketStatus sfUdpSocket_receivePacket(sfUdpSocket* socket, sfPacket* packet,
     std::optional<sf::IpAddress> address;
     unsigned short               port = 0;
 
-    sf::Socket::Status status = socket->receive(*packet, address, port);
+    sf::Socket::Status status = packet->receiveFrom(*socket, address, port);
     if (status != sf::Socket::Status::Done)
         return static_cast<sfSocketStatus>(status);
 
@@ -198,6 +403,136 @@ sfSocketStatus sfUdpSocket_receivePacket(sfUdpSocket* socket, sfPacket* packet,
 }
 
 
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_sendTo(sfUdpSocket*      socket,
+                                  const void*       data,
+                                  size_t            size,
+                                  sfIpAddressPacked remoteAddress,
+                                  unsigned short    remotePort)
+{
+    assert(socket);
+
+    if (remoteAddress.address.address[0] == '\0')
+        return sfSocketError;
+
+    return static_cast<sfSocketStatus>(socket->send(data, size, convertIpAddress(remoteAddress), remotePort));
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_receiveFrom(sfUdpSocket*       socket,
+                                       void*              data,
+                                       size_t             size,
+                                       size_t*            received,
+                                       sfIpAddressPacked* remoteAddress,
+                                       unsigned short*    remotePort)
+{
+    assert(socket);
+
+    std::optional<sf::IpAddress> address;
+    unsigned short               port         = 0;
+    std::size_t                  sizeReceived = 0;
+
+    sf::Socket::Status status = socket->receive(data, size, sizeReceived, address, port);
+    if (status != sf::Socket::Status::Done)
+        return static_cast<sfSocketStatus>(status);
+
+    if (received)
+        *received = sizeReceived;
+
+    if (remoteAddress)
+        *remoteAddress = address ? convertIpAddress(*address) : sfIpAddressPacked{};
+
+    if (remotePort)
+        *remotePort = port;
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_sendPacketTo(sfUdpSocket*      socket,
+                                        sfPacket*         packet,
+                                        sfIpAddressPacked remoteAddress,
+                                        unsigned short    remotePort)
+{
+    assert(socket);
+    assert(packet);
+
+    if (remoteAddress.address.address[0] == '\0')
+        return sfSocketError;
+
+    return static_cast<sfSocketStatus>(socket->send(*packet, convertIpAddress(remoteAddress), remotePort));
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_receivePacketFrom(sfUdpSocket*       socket,
+                                             sfPacket*          packet,
+                                             sfIpAddressPacked* remoteAddress,
+                                             unsigned short*    remotePort)
+{
+    assert(socket);
+    assert(packet);
+
+    std::optional<sf::IpAddress> address;
+    unsigned short               port = 0;
+
+    sf::Socket::Status status = packet->receiveFrom(*socket, address, port);
+    if (status != sf::Socket::Status::Done)
+        return static_cast<sfSocketStatus>(status);
+
+    if (remoteAddress)
+        *remoteAddress = address ? convertIpAddress(*address) : sfIpAddressPacked{};
+
+    if (remotePort)
+        *remotePort = port;
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_receiveBatch(sfUdpSocket* socket, sfUdpDatagram* datagrams, size_t count, size_t* receivedCount)
+{
+    assert(socket);
+    assert(datagrams || count == 0);
+
+    std::size_t          received = 0;
+    const sfSocketStatus status   = count > 0 ? receiveDatagrams(*socket, datagrams, count, received) : sfSocketDone;
+
+    if (receivedCount)
+        *receivedCount = received;
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_sendBatch(sfUdpSocket* socket, const sfUdpDatagram* datagrams, size_t count, size_t* sentCount)
+{
+    assert(socket);
+    assert(datagrams || count == 0);
+
+    if (sentCount)
+        *sentCount = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > sf::UdpSocket::MaxDatagramSize)
+            return sfSocketError;
+    }
+
+    std::size_t          sent   = 0;
+    const sfSocketStatus status = count > 0 ? sendDatagrams(*socket, datagrams, count, sent) : sfSocketDone;
+
+    if (sentCount)
+        *sentCount = sent;
+
+    return status;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int sfUdpSocket_maxDatagramSize()
 {
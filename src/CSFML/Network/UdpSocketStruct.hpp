@@ -27,12 +27,15 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Network/UdpSocket.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfUdpSocket
 ////////////////////////////////////////////////////////////
-struct sfUdpSocket : sf::UdpSocket
+struct sfUdpSocket : sf::UdpSocket, Allocated<sfAllocModuleNetwork>
 {
+    using sf::UdpSocket::getNativeHandle;
 };
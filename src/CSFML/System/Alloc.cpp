@@ -26,12 +26,323 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <CSFML/System/Alloc.h>
+#include <CSFML/System/Allocated.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 
+namespace
+{
 ////////////////////////////////////////////////////////////
-void sfFree(void* ptr)
+// Size and module of a block, kept out of the block itself
+// so that blocks stay compatible with the C standard library
+////////////////////////////////////////////////////////////
+struct BlockInfo
+{
+    std::size_t   size;
+    sfAllocModule module;
+};
+
+
+////////////////////////////////////////////////////////////
+// Part of the blocks handed over to the callers of CSFML,
+// split by address to limit the contention between threads
+////////////////////////////////////////////////////////////
+struct BlockShard
+{
+    std::mutex                           mutex;
+    std::unordered_map<void*, BlockInfo> blocks;
+};
+
+constexpr std::size_t shardCount = 16;
+
+
+////////////////////////////////////////////////////////////
+BlockShard* getShards()
+{
+    // Never destroyed, blocks can be released by static destructors of any module
+    static auto* shards = new BlockShard[shardCount];
+    return shards;
+}
+
+
+////////////////////////////////////////////////////////////
+BlockShard& getShard(void* ptr)
+{
+    // Skip the low bits, which are identical for all the blocks because of the alignment
+    return getShards()[(reinterpret_cast<std::uintptr_t>(ptr) >> 4) % shardCount];
+}
+
+
+////////////////////////////////////////////////////////////
+struct ModuleCounters
+{
+    std::atomic<std::uint64_t> allocations{};
+    std::atomic<std::uint64_t> deallocations{};
+    std::atomic<std::uint64_t> allocatedBytes{};
+    std::atomic<std::uint64_t> currentBytes{};
+};
+
+
+////////////////////////////////////////////////////////////
+void* defaultAlloc(std::size_t size, void* /* userData */)
+{
+    return std::malloc(size);
+}
+
+
+////////////////////////////////////////////////////////////
+void* defaultRealloc(void* ptr, std::size_t size, void* /* userData */)
+{
+    return std::realloc(ptr, size);
+}
+
+
+////////////////////////////////////////////////////////////
+void defaultFree(void* ptr, void* /* userData */)
 {
     std::free(ptr);
 }
+
+
+////////////////////////////////////////////////////////////
+struct Allocator
+{
+    sfAllocFunc   alloc;
+    sfReallocFunc realloc;
+    sfFreeFunc    free;
+    void*         userData;
+};
+
+constexpr Allocator defaultAllocator{defaultAlloc, defaultRealloc, defaultFree, nullptr};
+
+Allocator allocator = defaultAllocator;
+
+ModuleCounters counters[sfAllocModuleCount];
+
+
+////////////////////////////////////////////////////////////
+void countAllocation(sfAllocModule module, std::size_t size)
+{
+    ModuleCounters& moduleCounters = counters[module];
+    moduleCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+    moduleCounters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    moduleCounters.currentBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void countDeallocation(sfAllocModule module, std::size_t size)
+{
+    ModuleCounters& moduleCounters = counters[module];
+    moduleCounters.deallocations.fetch_add(1, std::memory_order_relaxed);
+    moduleCounters.currentBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+// Remove a block from the table; the returned node is empty
+// if the block wasn't allocated by CSFML
+////////////////////////////////////////////////////////////
+std::unordered_map<void*, BlockInfo>::node_type extractBlock(void* ptr)
+{
+    BlockShard&           shard = getShard(ptr);
+    const std::lock_guard lock(shard.mutex);
+    return shard.blocks.extract(ptr);
+}
+
+
+////////////////////////////////////////////////////////////
+// Put back a block removed from the table by extractBlock,
+// possibly under a new address
+////////////////////////////////////////////////////////////
+void insertBlock(std::unordered_map<void*, BlockInfo>::node_type&& node)
+{
+    BlockShard&           shard = getShard(node.key());
+    const std::lock_guard lock(shard.mutex);
+    shard.blocks.erase(node.key());
+    shard.blocks.insert(std::move(node));
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+void sfSetAllocator(sfAllocFunc allocFunc, sfReallocFunc reallocFunc, sfFreeFunc freeFunc, void* userData)
+{
+    if (allocFunc && freeFunc)
+        allocator = {allocFunc, reallocFunc, freeFunc, userData};
+    else
+        allocator = defaultAllocator;
+
+    // Everything was released, entries left in the table belong to blocks released with free:
+    // their addresses can now be returned by malloc and must not reach the new functions
+    for (std::size_t i = 0; i < shardCount; ++i)
+    {
+        BlockShard&           shard = getShards()[i];
+        const std::lock_guard lock(shard.mutex);
+        shard.blocks.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfAllocateFor(sfAllocModule module, size_t size)
+{
+    assert(module >= sfAllocModuleSystem && module < sfAllocModuleCount);
+
+    // Allocate at least one byte, so that objects always get a distinct address
+    void* ptr = allocator.alloc(std::max<std::size_t>(size, 1), allocator.userData);
+    if (!ptr)
+        return nullptr;
+
+    countAllocation(module, size);
+    return ptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfDeallocateFor(sfAllocModule module, void* ptr, size_t size)
+{
+    assert(module >= sfAllocModuleSystem && module < sfAllocModuleCount);
+
+    if (!ptr)
+        return;
+
+    countDeallocation(module, size);
+    allocator.free(ptr, allocator.userData);
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfAllocateForCaller(sfAllocModule module, size_t size)
+{
+    void* ptr = sfAllocateFor(module, size);
+    if (!ptr)
+        return nullptr;
+
+    try
+    {
+        // An existing entry belongs to a block that was allocated by CSFML and released with free
+        BlockShard&           shard = getShard(ptr);
+        const std::lock_guard lock(shard.mutex);
+        shard.blocks.insert_or_assign(ptr, BlockInfo{size, module});
+    }
+    catch (const std::bad_alloc&)
+    {
+        sfDeallocateFor(module, ptr, size);
+        return nullptr;
+    }
+
+    return ptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfMalloc(size_t size)
+{
+    return sfAllocateForCaller(sfAllocModuleSystem, size);
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfRealloc(void* ptr, size_t size)
+{
+    if (!ptr)
+        return sfMalloc(size);
+
+    if (size == 0)
+    {
+        sfFree(ptr);
+        return nullptr;
+    }
+
+    auto node = extractBlock(ptr);
+    if (node.empty())
+    {
+        // Not allocated by CSFML, the block comes from the C standard library
+        return std::realloc(ptr, size);
+    }
+
+    const BlockInfo info = node.mapped();
+    if (!allocator.realloc)
+    {
+        insertBlock(std::move(node));
+
+        void* newPtr = sfAllocateForCaller(info.module, size);
+        if (!newPtr)
+            return nullptr;
+
+        std::memcpy(newPtr, ptr, std::min(info.size, size));
+        sfFree(ptr);
+        return newPtr;
+    }
+
+    // The block stays out of the table while it is being moved, as its
+    // address can be reused by another thread as soon as it is released
+    void* newPtr = allocator.realloc(ptr, size, allocator.userData);
+    if (newPtr)
+    {
+        node.key()         = newPtr;
+        node.mapped().size = size;
+    }
+    insertBlock(std::move(node));
+    if (!newPtr)
+        return nullptr;
+
+    countDeallocation(info.module, info.size);
+    countAllocation(info.module, size);
+    return newPtr;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFree(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    const auto node = extractBlock(ptr);
+    if (node.empty())
+    {
+        // Not allocated by CSFML, the block comes from the C standard library
+        std::free(ptr);
+        return;
+    }
+
+    sfDeallocateFor(node.mapped().module, ptr, node.mapped().size);
+}
+
+
+////////////////////////////////////////////////////////////
+sfAllocationStats sfGetAllocationStats(sfAllocModule module)
+{
+    assert(module >= sfAllocModuleSystem && module < sfAllocModuleCount);
+
+    const ModuleCounters& moduleCounters = counters[module];
+    return {moduleCounters.allocations.load(std::memory_order_relaxed),
+            moduleCounters.deallocations.load(std::memory_order_relaxed),
+            moduleCounters.allocatedBytes.load(std::memory_order_relaxed),
+            moduleCounters.currentBytes.load(std::memory_order_relaxed)};
+}
+
+
+////////////////////////////////////////////////////////////
+void sfResetAllocationStats()
+{
+    for (ModuleCounters& moduleCounters : counters)
+    {
+        moduleCounters.allocations.store(0, std::memory_order_relaxed);
+        moduleCounters.deallocations.store(0, std::memory_order_relaxed);
+        moduleCounters.allocatedBytes.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <CSFML/System/Alloc.h>
+
+#include <new>
+#include <string>
+
+#include <cstddef>
+#include <cstring>
+
+
+////////////////////////////////////////////////////////////
+// Export macro of the functions that the CSFML modules share
+// but that are not part of the C API: they have C++ linkage
+////////////////////////////////////////////////////////////
+#if defined(CSFML_STATIC)
+
+#define CSFML_SYSTEM_INTERNAL_API
+
+#elif defined(CSFML_SYSTEM_WINDOWS)
+
+#if defined(CSFML_SYSTEM_EXPORTS)
+#define CSFML_SYSTEM_INTERNAL_API __declspec(dllexport)
+#else
+#define CSFML_SYSTEM_INTERNAL_API __declspec(dllimport)
+#endif
+
+#else
+
+#define CSFML_SYSTEM_INTERNAL_API __attribute__((__visibility__("default")))
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory counted against a module
+///
+/// The memory is released with sfDeallocateFor, given the
+/// same module and size; it is not known to sfFree.
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_INTERNAL_API void* sfAllocateFor(sfAllocModule module, size_t size);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Release memory returned by sfAllocateFor
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_INTERNAL_API void sfDeallocateFor(sfAllocModule module, void* ptr, size_t size);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory returned to the caller, counted against a module
+///
+/// The memory is released by the caller with sfFree, which
+/// finds its module and size in a table: only use this for
+/// the strings and arrays that the C API hands over.
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_INTERNAL_API void* sfAllocateForCaller(sfAllocModule module, size_t size);
+
+
+////////////////////////////////////////////////////////////
+// Base of the internal structures, routing their
+// allocations to the functions given to sfSetAllocator
+////////////////////////////////////////////////////////////
+template <sfAllocModule Module>
+struct Allocated
+{
+    [[nodiscard]] static void* operator new(std::size_t size)
+    {
+        void* ptr = sfAllocateFor(Module, size);
+        if (!ptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    // The structures are always deleted through their own type,
+    // so the size given here is the one passed to operator new
+    static void operator delete(void* ptr, std::size_t size) noexcept
+    {
+        sfDeallocateFor(Module, ptr, size);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+// Copy a string to memory released with sfFree
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline char* copyToCString(sfAllocModule module, const std::string& str)
+{
+    auto* copy = static_cast<char*>(sfAllocateForCaller(module, str.size() + 1));
+    if (copy)
+        std::memcpy(copy, str.c_str(), str.size() + 1);
+    return copy;
+}
@@ -28,13 +28,39 @@
 #include <CSFML/System/Buffer.h>
 #include <CSFML/System/BufferStruct.hpp>
 
+#include <new>
+#include <stdexcept>
+
 #include <cassert>
 
 
 ////////////////////////////////////////////////////////////
 sfBuffer* sfBuffer_create()
 {
-    return new sfBuffer;
+    try
+    {
+        return new sfBuffer;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfBuffer* sfBuffer_createWithAllocator(sfBufferAllocFunc allocFunc, sfBufferFreeFunc freeFunc, void* userData)
+{
+    assert(allocFunc);
+    assert(freeFunc);
+    try
+    {
+        return new sfBuffer(BufferAllocator<std::uint8_t>(allocFunc, freeFunc, userData));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
 }
 
 
@@ -59,3 +85,39 @@ const uint8_t* sfBuffer_getData(const sfBuffer* buffer)
     assert(buffer);
     return !buffer->empty() ? buffer->data() : nullptr;
 }
+
+
+////////////////////////////////////////////////////////////
+bool sfBuffer_reserve(sfBuffer* buffer, size_t size)
+{
+    assert(buffer);
+    try
+    {
+        buffer->reserve(size);
+        return true;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+    catch (const std::length_error&)
+    {
+        return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfBuffer_getCapacity(const sfBuffer* buffer)
+{
+    assert(buffer);
+    return buffer->capacity();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfBuffer_clear(sfBuffer* buffer)
+{
+    assert(buffer);
+    buffer->clear();
+}
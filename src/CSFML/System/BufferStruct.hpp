@@ -27,15 +27,83 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+#include <CSFML/System/Buffer.h>
+
 #include <SFML/Config.hpp>
 
-#include <cstdint>
+#include <new>
 #include <vector>
 
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Allocator forwarding to the user functions of a buffer,
+// or to the global CSFML allocator if there are none
+////////////////////////////////////////////////////////////
+template <typename T>
+struct BufferAllocator
+{
+    using value_type = T;
+
+    BufferAllocator() = default;
+
+    BufferAllocator(sfBufferAllocFunc alloc, sfBufferFreeFunc free, void* data) :
+    allocFunc(alloc),
+    freeFunc(free),
+    userData(data)
+    {
+    }
+
+    template <typename U>
+    BufferAllocator(const BufferAllocator<U>& other) :
+    allocFunc(other.allocFunc),
+    freeFunc(other.freeFunc),
+    userData(other.userData)
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t count)
+    {
+        void* ptr = allocFunc ? allocFunc(count * sizeof(T), userData)
+                              : sfAllocateFor(sfAllocModuleSystem, count * sizeof(T));
+        if (!ptr)
+            throw std::bad_alloc();
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* ptr, std::size_t count)
+    {
+        if (freeFunc)
+            freeFunc(ptr, userData);
+        else
+            sfDeallocateFor(sfAllocModuleSystem, ptr, count * sizeof(T));
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const BufferAllocator<U>& other) const
+    {
+        return allocFunc == other.allocFunc && freeFunc == other.freeFunc && userData == other.userData;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator!=(const BufferAllocator<U>& other) const
+    {
+        return !(*this == other);
+    }
+
+    sfBufferAllocFunc allocFunc{};
+    sfBufferFreeFunc  freeFunc{};
+    void*             userData{};
+};
+
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfBuffer
 ////////////////////////////////////////////////////////////
-struct sfBuffer : std::vector<std::uint8_t>
+struct sfBuffer : std::vector<std::uint8_t, BufferAllocator<std::uint8_t>>, Allocated<sfAllocModuleSystem>
 {
+    using vector::vector;
 };
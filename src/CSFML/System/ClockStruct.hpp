@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/System/Clock.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfClock
 ////////////////////////////////////////////////////////////
-struct sfClock : sf::Clock
+struct sfClock : sf::Clock, Allocated<sfAllocModuleSystem>
 {
 };
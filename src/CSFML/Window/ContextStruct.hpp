@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Window/Context.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfContext
 ////////////////////////////////////////////////////////////
-struct sfContext : sf::Context
+struct sfContext : sf::Context, Allocated<sfAllocModuleWindow>
 {
 };
@@ -37,7 +37,7 @@ sfCursor* sfCursor_createFromPixels(const uint8_t* pixels, sfVector2u size, sfVe
     if (!cursor)
         return nullptr;
 
-    return new sfCursor{std::move(*cursor)};
+    return new sfCursor{std::move(*cursor), {}};
 }
 
 
@@ -48,7 +48,7 @@ sfCursor* sfCursor_createFromSystem(sfCursorType type)
     if (!cursor)
         return nullptr;
 
-    return new sfCursor{std::move(*cursor)};
+    return new sfCursor{std::move(*cursor), {}};
 }
 
 
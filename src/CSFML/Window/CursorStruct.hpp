@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Window/Cursor.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfCursor
 ////////////////////////////////////////////////////////////
-struct sfCursor : sf::Cursor
+struct sfCursor : sf::Cursor, Allocated<sfAllocModuleWindow>
 {
 };
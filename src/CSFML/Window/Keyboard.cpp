@@ -25,13 +25,12 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
 #include <CSFML/Window/Keyboard.h>
 
 #include <SFML/System/String.hpp>
 #include <SFML/Window/Keyboard.hpp>
 
-#include <cstring>
-
 
 ////////////////////////////////////////////////////////////
 bool sfKeyboard_isKeyPressed(sfKeyCode key)
@@ -64,7 +63,8 @@ sfScancode sfKeyboard_delocalize(sfKeyCode key)
 ////////////////////////////////////////////////////////////
 const char* sfKeyboard_getDescription(sfScancode code)
 {
-    return strdup(sf::Keyboard::getDescription(static_cast<sf::Keyboard::Scancode>(code)).toAnsiString().c_str());
+    return copyToCString(sfAllocModuleWindow,
+                         sf::Keyboard::getDescription(static_cast<sf::Keyboard::Scancode>(code)).toAnsiString());
 }
 
 
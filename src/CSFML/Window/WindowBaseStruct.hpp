@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Window/WindowBase.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfWindowBase
 ////////////////////////////////////////////////////////////
-struct sfWindowBase : sf::WindowBase
+struct sfWindowBase : sf::WindowBase, Allocated<sfAllocModuleWindow>
 {
 };
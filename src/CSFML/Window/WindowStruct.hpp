@@ -27,12 +27,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <CSFML/System/Allocated.hpp>
+
 #include <SFML/Window/Window.hpp>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfWindow
 ////////////////////////////////////////////////////////////
-struct sfWindow : sf::Window
+struct sfWindow : sf::Window, Allocated<sfAllocModuleWindow>
 {
 };
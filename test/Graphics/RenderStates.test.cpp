@@ -1,7 +1,11 @@
+#include <CSFML/Graphics/ConvertRenderStates.hpp>
 #include <CSFML/Graphics/RenderStates.h>
+#include <CSFML/Graphics/RenderStatesHandleStruct.hpp>
+#include <CSFML/Graphics/Texture.h>
 
 #include <SFML/Graphics/RenderStates.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "CSFML/Graphics/CoordinateType.h"
@@ -39,3 +43,90 @@ TEST_CASE("[Graphics] sfRenderStates")
         CHECK(sfRenderStates_default.blendMode.alphaEquation == sfBlendAlpha.alphaEquation);
     }
 }
+
+TEST_CASE("[Graphics] sfRenderStatesHandle")
+{
+    SECTION("sfRenderStatesHandle_create")
+    {
+        const sfRenderStatesHandle* handle = sfRenderStatesHandle_create(&sfRenderStates_default);
+        CHECK(handle != nullptr);
+        sfRenderStatesHandle_destroy(handle);
+
+        const sfRenderStatesHandle* defaultHandle = sfRenderStatesHandle_create(nullptr);
+        CHECK(defaultHandle != nullptr);
+        sfRenderStatesHandle_destroy(defaultHandle);
+    }
+
+    SECTION("sfRenderStatesHandle_update")
+    {
+        sfRenderStatesHandle* handle = sfRenderStatesHandle_create(nullptr);
+        CHECK(handle->This.blendMode == sf::BlendAlpha);
+        CHECK(handle->This.transform == sf::Transform::Identity);
+
+        sfRenderStates states = sfRenderStates_default;
+        states.blendMode      = sfBlendAdd;
+        sfTransform_translate(&states.transform, {10.f, 20.f});
+        sfTransform_scale(&states.transform, {2.f, 3.f});
+        states.coordinateType = sfCoordinateTypeNormalized;
+        sfRenderStatesHandle_update(handle, &states);
+        CHECK(handle->This.blendMode == sf::BlendAdd);
+        CHECK(handle->This.transform == sf::Transform().translate({10.f, 20.f}).scale({2.f, 3.f}));
+        CHECK(handle->This.coordinateType == sf::CoordinateType::Normalized);
+        CHECK(handle->This.texture == nullptr);
+        CHECK(handle->This.shader == nullptr);
+
+        sfRenderStatesHandle_update(handle, nullptr);
+        CHECK(handle->This.blendMode == sf::BlendAlpha);
+        CHECK(handle->This.transform == sf::Transform::Identity);
+        CHECK(handle->This.coordinateType == sf::CoordinateType::Pixels);
+        sfRenderStatesHandle_destroy(handle);
+    }
+}
+
+TEST_CASE("[Graphics] sfRenderStatesHandle texture", "[.display]")
+{
+    // Creating a texture requires an OpenGL context
+    sfTexture*            texture = sfTexture_create({16, 16});
+    sfRenderStatesHandle* handle  = sfRenderStatesHandle_create(nullptr);
+    REQUIRE(texture);
+
+    sfRenderStates states = sfRenderStates_default;
+    states.texture        = texture;
+    sfRenderStatesHandle_update(handle, &states);
+    CHECK(handle->This.texture == texture->This);
+
+    states.texture = nullptr;
+    sfRenderStatesHandle_update(handle, &states);
+    CHECK(handle->This.texture == nullptr);
+
+    sfRenderStatesHandle_destroy(handle);
+    sfTexture_destroy(texture);
+}
+
+TEST_CASE("[Graphics] sfRenderStatesHandle benchmark", "[.benchmark]")
+{
+    // A draw call taking a sfRenderStates* converts the states every time,
+    // a draw call taking a handle only reads the states converted beforehand
+    sfRenderStatesHandle* handle = sfRenderStatesHandle_create(nullptr);
+    sfRenderStates        states = sfRenderStates_default;
+    sfTransform_translate(&states.transform, {10.f, 20.f});
+    sfRenderStatesHandle_update(handle, &states);
+
+    BENCHMARK("Per draw call, converting sfRenderStates*")
+    {
+        return convertRenderStates(&states);
+    };
+
+    BENCHMARK("Per draw call, reading sfRenderStatesHandle*")
+    {
+        return &getRenderStates(handle);
+    };
+
+    BENCHMARK("sfRenderStatesHandle_update")
+    {
+        sfRenderStatesHandle_update(handle, &states);
+        return handle;
+    };
+
+    sfRenderStatesHandle_destroy(handle);
+}
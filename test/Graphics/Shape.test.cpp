@@ -104,4 +104,22 @@ TEST_CASE("[Graphics] sfShape")
         CHECK(origin.y == 90);
         sfShape_destroy(shape);
     }
+
+    SECTION("Transform updates")
+    {
+        sfShape* shape = sfShape_create(getPointCount, getPoint, &points);
+        CHECK(sfShape_getTransform(shape).matrix[2] == 0);
+        CHECK(sfShape_getInverseTransform(shape).matrix[2] == 0);
+        sfShape_setPosition(shape, {10, 20});
+        CHECK(sfShape_getTransform(shape).matrix[2] == 10);
+        CHECK(sfShape_getTransform(shape).matrix[5] == 20);
+        CHECK(sfShape_getInverseTransform(shape).matrix[2] == -10);
+        sfShape_move(shape, {5, 5});
+        CHECK(sfShape_getTransform(shape).matrix[2] == 15);
+        CHECK(sfShape_getInverseTransform(shape).matrix[5] == -25);
+        sfShape_scale(shape, {2, 2});
+        CHECK(sfShape_getTransform(shape).matrix[0] == 2);
+        CHECK(sfShape_getInverseTransform(shape).matrix[0] == 0.5f);
+        sfShape_destroy(shape);
+    }
 }
@@ -0,0 +1,55 @@
+#include <CSFML/Graphics/Sprite.h>
+#include <CSFML/Graphics/Texture.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+namespace
+{
+void checkEqual(const sfTransform& transform, const sfTransform& expected)
+{
+    for (std::size_t i = 0; i < std::size(expected.matrix); ++i)
+        CHECK(transform.matrix[i] == expected.matrix[i]);
+}
+} // namespace
+
+// Creating a texture requires an OpenGL context
+TEST_CASE("[Graphics] sfSprite", "[.display]")
+{
+    sfTexture* texture = sfTexture_create({16, 16});
+    REQUIRE(texture);
+
+    std::array<sfSprite*, 3> sprites{};
+    for (auto& sprite : sprites)
+        sprite = sfSprite_create(texture);
+    sfSprite_setPosition(sprites[0], {10, 20});
+    sfSprite_setRotation(sprites[1], 45);
+    sfSprite_setScale(sprites[1], {2, 3});
+    sfSprite_setOrigin(sprites[2], {8, 8});
+    sfSprite_move(sprites[2], {-5, 5});
+
+    SECTION("sfSprite_getTransforms")
+    {
+        std::array<sfTransform, sprites.size()> transforms{};
+        sfSprite_getTransforms(sprites.data(), sprites.size(), transforms.data());
+        for (std::size_t i = 0; i < sprites.size(); ++i)
+            checkEqual(transforms[i], sfSprite_getTransform(sprites[i]));
+
+        // The cached transforms follow the changes made to the sprites
+        sfSprite_setPosition(sprites[0], {-1, -2});
+        sfSprite_rotate(sprites[2], 90);
+        sfSprite_getTransforms(sprites.data(), sprites.size(), transforms.data());
+        sfTransform expected = sfTransform_Identity;
+        sfTransform_translate(&expected, {-1, -2});
+        checkEqual(transforms[0], expected);
+        for (std::size_t i = 0; i < sprites.size(); ++i)
+            checkEqual(transforms[i], sfSprite_getTransform(sprites[i]));
+
+        sfSprite_getTransforms(nullptr, 0, nullptr);
+    }
+
+    for (const auto* sprite : sprites)
+        sfSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+}
@@ -1,8 +1,57 @@
 #include <CSFML/Graphics/Transform.h>
 
+#include <SFML/Graphics/Transform.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+sf::Transform toSfml(const sfTransform& transform)
+{
+    const float* m = transform.matrix;
+    return {m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]};
+}
+
+// The 3x3 math performs the same operations in the same order as sf::Transform,
+// only the products by the constant zeros of the affine matrices are skipped: they
+// can change the sign of a zero result, which compares equal, so the results are exact
+void checkEqual(const sfTransform& transform, const sf::Transform& expected)
+{
+    const float* m = expected.getMatrix();
+    const std::array<float, 9> expectedMatrix{m[0], m[4], m[12], m[1], m[5], m[13], m[3], m[7], m[15]};
+    for (std::size_t i = 0; i < expectedMatrix.size(); ++i)
+        CHECK(transform.matrix[i] == expectedMatrix[i]);
+}
+
+// Random transforms, with a fixed seed to keep the test reproducible
+class TransformGenerator
+{
+public:
+    sfTransform transform()
+    {
+        return sfTransform_fromMatrix(value(), value(), value(), value(), value(), value(), value(), value(), value());
+    }
+
+    sfVector2f vector()
+    {
+        return {value(), value()};
+    }
+
+    float value()
+    {
+        return m_distribution(m_engine);
+    }
+
+private:
+    std::mt19937                          m_engine{42};
+    std::uniform_real_distribution<float> m_distribution{-10.f, 10.f};
+};
+} // namespace
 
 TEST_CASE("[Graphics] sfTransform")
 {
@@ -92,37 +141,243 @@ TEST_CASE("[Graphics] sfTransform")
 
     SECTION("sfTransform_transformPoint")
     {
+        CHECK(sfTransform_transformPoint(&sfTransform_Identity, {-10, -10}).x == -10);
+        CHECK(sfTransform_transformPoint(&sfTransform_Identity, {-10, -10}).y == -10);
+
+        const auto transform = sfTransform_fromMatrix(1, 2, 3, 4, 5, 4, 3, 2, 1);
+        const auto point     = sfTransform_transformPoint(&transform, {-10, -10});
+        CHECK(point.x == -27);
+        CHECK(point.y == -86);
+    }
+
+    SECTION("sfTransform_transformPoints")
+    {
+        const auto                transform = sfTransform_fromMatrix(1, 2, 3, 4, 5, 4, 3, 2, 1);
+        std::array<sfVector2f, 5> points    = {{{-10, -10}, {0, 0}, {1, 2}, {3, -4}, {0.5f, 8}}};
+        std::array<sfVector2f, 5> transformedPoints{};
+        sfTransform_transformPoints(&transform, points.data(), transformedPoints.data(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto expected = sfTransform_transformPoint(&transform, points[i]);
+            CHECK(transformedPoints[i].x == expected.x);
+            CHECK(transformedPoints[i].y == expected.y);
+        }
+
+        // In place
+        sfTransform_transformPoints(&transform, points.data(), points.data(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            CHECK(points[i].x == transformedPoints[i].x);
+            CHECK(points[i].y == transformedPoints[i].y);
+        }
+    }
+
+    SECTION("sfTransform_transformVertices")
+    {
+        const auto              transform = sfTransform_fromMatrix(1, 2, 3, 4, 5, 4, 3, 2, 1);
+        std::array<sfVertex, 2> vertices  = {{{{-10, -10}, {1, 2, 3, 4}, {5, 6}}, {{1, 2}, {}, {}}}};
+        sfTransform_transformVertices(&transform, vertices.data(), vertices.size());
+        CHECK(vertices[0].position.x == -27);
+        CHECK(vertices[0].position.y == -86);
+        CHECK(+vertices[0].color.r == 1);
+        CHECK(+vertices[0].color.a == 4);
+        CHECK(vertices[0].texCoords.x == 5);
+        CHECK(vertices[0].texCoords.y == 6);
+        CHECK(vertices[1].position.x == 8);
+        CHECK(vertices[1].position.y == 18);
     }
 
     SECTION("sfTransform_transformRect")
     {
     }
 
+    // The functions below implement the 3x3 math directly,
+    // check that they match sf::Transform on random inputs
+    TransformGenerator generator;
+
     SECTION("sfTransform_combine")
     {
+        for (int i = 0; i < 100; ++i)
+        {
+            auto       transform = generator.transform();
+            const auto other     = generator.transform();
+            const auto expected  = toSfml(transform).combine(toSfml(other));
+            sfTransform_combine(&transform, &other);
+            checkEqual(transform, expected);
+        }
+    }
+
+    SECTION("sfTransform_combineMany")
+    {
+        const auto               transform = generator.transform();
+        std::vector<sfTransform> others(10);
+        for (auto& other : others)
+            other = generator.transform();
+
+        std::vector<sfTransform> results(others.size());
+        sfTransform_combineMany(&transform, others.data(), results.data(), others.size());
+        for (std::size_t i = 0; i < others.size(); ++i)
+            checkEqual(results[i], toSfml(transform) * toSfml(others[i]));
+
+        // In place
+        sfTransform_combineMany(&transform, others.data(), others.data(), others.size());
+        for (std::size_t i = 0; i < others.size(); ++i)
+            CHECK(sfTransform_equal(&others[i], &results[i]));
     }
 
     SECTION("sfTransform_translate")
     {
+        for (int i = 0; i < 100; ++i)
+        {
+            auto       transform = generator.transform();
+            const auto offset    = generator.vector();
+            const auto expected  = toSfml(transform).translate({offset.x, offset.y});
+            sfTransform_translate(&transform, offset);
+            checkEqual(transform, expected);
+        }
     }
 
     SECTION("sfTransform_rotate")
     {
+        for (int i = 0; i < 100; ++i)
+        {
+            auto        transform = generator.transform();
+            const float angle     = generator.value() * 36;
+            const auto  expected  = toSfml(transform).rotate(sf::degrees(angle));
+            sfTransform_rotate(&transform, angle);
+            checkEqual(transform, expected);
+        }
     }
 
     SECTION("sfTransform_rotateWithCenter")
     {
+        for (int i = 0; i < 100; ++i)
+        {
+            auto        transform = generator.transform();
+            const float angle     = generator.value() * 36;
+            const auto  center    = generator.vector();
+            const auto  expected  = toSfml(transform).rotate(sf::degrees(angle), {center.x, center.y});
+            sfTransform_rotateWithCenter(&transform, angle, center);
+            checkEqual(transform, expected);
+        }
     }
 
     SECTION("sfTransform_scale")
     {
+        for (int i = 0; i < 100; ++i)
+        {
+            auto       transform = generator.transform();
+            const auto scale     = generator.vector();
+            const auto expected  = toSfml(transform).scale({scale.x, scale.y});
+            sfTransform_scale(&transform, scale);
+            checkEqual(transform, expected);
+        }
     }
 
     SECTION("sfTransform_scaleWithCenter")
     {
+        for (int i = 0; i < 100; ++i)
+        {
+            auto       transform = generator.transform();
+            const auto scale     = generator.vector();
+            const auto center    = generator.vector();
+            const auto expected  = toSfml(transform).scale({scale.x, scale.y}, {center.x, center.y});
+            sfTransform_scaleWithCenter(&transform, scale, center);
+            checkEqual(transform, expected);
+        }
     }
 
     SECTION("sfTransform_equal")
     {
     }
 }
+
+TEST_CASE("[Graphics] sfTransform benchmark", "[.benchmark]")
+{
+    TransformGenerator generator;
+    const auto         other     = generator.transform();
+    auto               transform = generator.transform();
+
+    BENCHMARK("sfTransform_combine")
+    {
+        sfTransform_combine(&transform, &other);
+        return transform;
+    };
+
+    BENCHMARK("sf::Transform round-trip")
+    {
+        // What sfTransform_combine used to do
+        const float* m = toSfml(transform).combine(toSfml(other)).getMatrix();
+        transform      = {{m[0], m[4], m[12], m[1], m[5], m[13], m[3], m[7], m[15]}};
+        return transform;
+    };
+
+    BENCHMARK("sfTransform_rotate")
+    {
+        sfTransform_rotate(&transform, 0.1f);
+        return transform;
+    };
+
+    std::vector<sfTransform> children(10'000);
+    for (auto& child : children)
+        child = generator.transform();
+    std::vector<sfTransform> results(children.size());
+
+    BENCHMARK("sfTransform_combineMany (10k)")
+    {
+        sfTransform_combineMany(&transform, children.data(), results.data(), children.size());
+        return results.data();
+    };
+
+    BENCHMARK("sfTransform_combine loop (10k)")
+    {
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+            results[i] = transform;
+            sfTransform_combine(&results[i], &children[i]);
+        }
+        return results.data();
+    };
+
+    std::vector<sfVector2f> points(10'000);
+    for (auto& point : points)
+        point = generator.vector();
+    std::vector<sfVector2f> transformedPoints(points.size());
+
+    BENCHMARK("sfTransform_transformPoints (10k)")
+    {
+        sfTransform_transformPoints(&transform, points.data(), transformedPoints.data(), points.size());
+        return transformedPoints.data();
+    };
+
+    BENCHMARK("sf::Transform per point (10k)")
+    {
+        // What sfTransform_transformPoint used to do for every point
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const sf::Vector2f point = toSfml(transform).transformPoint({points[i].x, points[i].y});
+            transformedPoints[i]     = {point.x, point.y};
+        }
+        return transformedPoints.data();
+    };
+
+    std::vector<sfVertex> vertices(points.size());
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+        vertices[i].position = points[i];
+
+    BENCHMARK("sfTransform_transformVertices (10k)")
+    {
+        sfTransform_transformVertices(&transform, vertices.data(), vertices.size());
+        return vertices.data();
+    };
+
+    BENCHMARK("sf::Transform per vertex (10k)")
+    {
+        for (auto& vertex : vertices)
+        {
+            const sf::Vector2f position = toSfml(transform).transformPoint({vertex.position.x, vertex.position.y});
+            vertex.position             = {position.x, position.y};
+        }
+        return vertices.data();
+    };
+}
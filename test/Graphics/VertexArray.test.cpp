@@ -78,6 +78,57 @@ TEST_CASE("[Graphics] sfVertexArray")
         sfVertexArray_destroy(vertexArray);
     }
 
+    SECTION("sfVertexArray_appendRange")
+    {
+        sfVertexArray* vertexArray = sfVertexArray_create();
+        sfVertexArray_append(vertexArray, {{1, 2}, {}, {}});
+        const sfVertex vertices[] = {{{3, 4}, {}, {}}, {{5, 6}, {}, {}}, {{7, 8}, {}, {}}};
+        sfVertexArray_appendRange(vertexArray, vertices, 3);
+        CHECK(sfVertexArray_getVertexCount(vertexArray) == 4);
+        CHECK(sfVertexArray_getVertex(vertexArray, 0)->position.x == 1);
+        CHECK(sfVertexArray_getVertex(vertexArray, 1)->position.x == 3);
+        CHECK(sfVertexArray_getVertex(vertexArray, 3)->position.y == 8);
+        sfVertexArray_appendRange(vertexArray, nullptr, 0);
+        CHECK(sfVertexArray_getVertexCount(vertexArray) == 4);
+
+        // Appending the array to itself reads the vertices before they move
+        sfVertexArray_appendRange(vertexArray, sfVertexArray_getVertices(vertexArray), 4);
+        CHECK(sfVertexArray_getVertexCount(vertexArray) == 8);
+        CHECK(sfVertexArray_getVertex(vertexArray, 4)->position.x == 1);
+        CHECK(sfVertexArray_getVertex(vertexArray, 7)->position.y == 8);
+        sfVertexArray_appendRange(vertexArray, sfVertexArray_getVertex(vertexArray, 6), 2);
+        CHECK(sfVertexArray_getVertexCount(vertexArray) == 10);
+        CHECK(sfVertexArray_getVertex(vertexArray, 8)->position.x == 5);
+        CHECK(sfVertexArray_getVertex(vertexArray, 9)->position.x == 7);
+        sfVertexArray_destroy(vertexArray);
+    }
+
+    SECTION("sfVertexArray_reserve")
+    {
+        sfVertexArray* vertexArray = sfVertexArray_create();
+        sfVertexArray_append(vertexArray, {{1, 2}, {}, {}});
+        sfVertexArray_reserve(vertexArray, 100);
+        CHECK(sfVertexArray_getVertexCount(vertexArray) == 1);
+        const sfVertex* vertices = sfVertexArray_getVertices(vertexArray);
+        sfVertexArray_resize(vertexArray, 100);
+        CHECK(sfVertexArray_getVertices(vertexArray) == vertices);
+        CHECK(sfVertexArray_getVertex(vertexArray, 0)->position.x == 1);
+        sfVertexArray_destroy(vertexArray);
+    }
+
+    SECTION("sfVertexArray_getVertices")
+    {
+        sfVertexArray* vertexArray = sfVertexArray_create();
+        CHECK(sfVertexArray_getVertices(vertexArray) == nullptr);
+        sfVertexArray_resize(vertexArray, 3);
+        sfVertex* vertices   = sfVertexArray_getVertices(vertexArray);
+        vertices[2].position = {9, 10};
+        CHECK(vertices == sfVertexArray_getVertex(vertexArray, 0));
+        CHECK(sfVertexArray_getVertex(vertexArray, 2)->position.x == 9);
+        CHECK(sfVertexArray_getVertex(vertexArray, 2)->position.y == 10);
+        sfVertexArray_destroy(vertexArray);
+    }
+
     SECTION("sfVertexArray_getBounds")
     {
         sfVertexArray* vertexArray = sfVertexArray_create();
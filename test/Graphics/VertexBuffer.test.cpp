@@ -0,0 +1,208 @@
+#include <CSFML/Graphics/Image.h>
+#include <CSFML/Graphics/RenderTexture.h>
+#include <CSFML/Graphics/Texture.h>
+#include <CSFML/Graphics/VertexBuffer.h>
+#include <CSFML/Graphics/VertexBufferStruct.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace
+{
+// Square of 2x2 pixels, as two triangles and as a strip
+const std::array<sfVertex, 6> square = {{
+    {{0, 0}, sfWhite, {}},
+    {{2, 0}, sfWhite, {}},
+    {{0, 2}, sfWhite, {}},
+    {{0, 2}, sfWhite, {}},
+    {{2, 0}, sfWhite, {}},
+    {{2, 2}, sfWhite, {}},
+}};
+
+const std::array<sfVertex, 4> strip = {{
+    {{0, 0}, sfWhite, {}},
+    {{2, 0}, sfWhite, {}},
+    {{0, 2}, sfWhite, {}},
+    {{2, 2}, sfWhite, {}},
+}};
+
+constexpr auto squareSize = static_cast<unsigned int>(square.size());
+
+void checkLocalCopy(const sfVertexBuffer* vertexBuffer, const sfVertex* expected, std::size_t count)
+{
+    REQUIRE(vertexBuffer->Vertices.size() == count);
+    CHECK(std::memcmp(vertexBuffer->Vertices.data(), expected, count * sizeof(sfVertex)) == 0);
+}
+
+void checkPixel(const sfImage* image, sfVector2u coords, sfColor expected)
+{
+    const sfColor color = sfImage_getPixel(image, coords);
+    CHECK(color.r == expected.r);
+    CHECK(color.g == expected.g);
+    CHECK(color.b == expected.b);
+    CHECK(color.a == expected.a);
+}
+} // namespace
+
+// Creating a vertex buffer requires an OpenGL context
+TEST_CASE("[Graphics] sfVertexBuffer", "[.display]")
+{
+    sfVertexBuffer* vertexBuffer = sfVertexBuffer_create(square.size(), sfTriangles, sfVertexBufferStatic);
+    REQUIRE(vertexBuffer);
+    CHECK(!sfVertexBuffer_isLocalCopyEnabled(vertexBuffer));
+    CHECK(vertexBuffer->Vertices.empty());
+
+    SECTION("sfVertexBuffer_setLocalCopyEnabled")
+    {
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, true);
+        CHECK(sfVertexBuffer_isLocalCopyEnabled(vertexBuffer));
+        CHECK(vertexBuffer->Vertices.size() == square.size());
+
+        // Disabling the copy releases its memory
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, false);
+        CHECK(!sfVertexBuffer_isLocalCopyEnabled(vertexBuffer));
+        CHECK(vertexBuffer->Vertices.empty());
+        CHECK(vertexBuffer->Vertices.capacity() == 0);
+    }
+
+    SECTION("sfVertexBuffer_update")
+    {
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, true);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 0));
+        checkLocalCopy(vertexBuffer, square.data(), square.size());
+
+        // A partial update only changes its own range
+        std::array<sfVertex, 6> expected = square;
+        expected[4].position             = {3, 3};
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, &expected[4], 1, 4));
+        checkLocalCopy(vertexBuffer, expected.data(), expected.size());
+
+        // A failed update leaves the copy untouched
+        CHECK(!sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 1));
+        checkLocalCopy(vertexBuffer, expected.data(), expected.size());
+
+        // A larger update grows the copy with the buffer
+        std::array<sfVertex, 12> larger{};
+        larger.back().position = {5, 5};
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, larger.data(), squareSize * 2, 0));
+        CHECK(sfVertexBuffer_getVertexCount(vertexBuffer) == larger.size());
+        checkLocalCopy(vertexBuffer, larger.data(), larger.size());
+
+        // Updates made without a copy are not tracked
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, false);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 0));
+        CHECK(vertexBuffer->Vertices.empty());
+    }
+
+    SECTION("sfVertexBuffer_updateFromVertexBuffer")
+    {
+        sfVertexBuffer* other = sfVertexBuffer_create(square.size(), sfTriangles, sfVertexBufferStatic);
+        REQUIRE(other);
+        sfVertexBuffer_setLocalCopyEnabled(other, true);
+        REQUIRE(sfVertexBuffer_update(other, square.data(), squareSize, 0));
+
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, true);
+        REQUIRE(sfVertexBuffer_updateFromVertexBuffer(vertexBuffer, other));
+        checkLocalCopy(vertexBuffer, square.data(), square.size());
+
+        // The contents of a buffer without a copy are unknown, the copy is disabled
+        sfVertexBuffer_setLocalCopyEnabled(other, false);
+        REQUIRE(sfVertexBuffer_updateFromVertexBuffer(vertexBuffer, other));
+        CHECK(!sfVertexBuffer_isLocalCopyEnabled(vertexBuffer));
+        CHECK(vertexBuffer->Vertices.empty());
+
+        sfVertexBuffer_destroy(other);
+    }
+
+    SECTION("sfVertexBuffer_swap")
+    {
+        sfVertexBuffer* other = sfVertexBuffer_create(2, sfLines, sfVertexBufferStatic);
+        REQUIRE(other);
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, true);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 0));
+
+        sfVertexBuffer_swap(vertexBuffer, other);
+        CHECK(!sfVertexBuffer_isLocalCopyEnabled(vertexBuffer));
+        CHECK(vertexBuffer->Vertices.empty());
+        CHECK(sfVertexBuffer_getVertexCount(vertexBuffer) == 2);
+        CHECK(sfVertexBuffer_isLocalCopyEnabled(other));
+        CHECK(sfVertexBuffer_getVertexCount(other) == square.size());
+        checkLocalCopy(other, square.data(), square.size());
+
+        sfVertexBuffer_destroy(other);
+    }
+
+    SECTION("sfVertexBuffer_copy")
+    {
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, true);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 0));
+        sfVertexBuffer* copy = sfVertexBuffer_copy(vertexBuffer);
+        REQUIRE(copy);
+        CHECK(sfVertexBuffer_isLocalCopyEnabled(copy));
+        checkLocalCopy(copy, square.data(), square.size());
+        sfVertexBuffer_destroy(copy);
+    }
+
+    SECTION("sfRenderTexture_drawVertexBufferInstanced")
+    {
+        sfRenderTexture* renderTexture = sfRenderTexture_create({8, 8}, nullptr);
+        REQUIRE(renderTexture);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 0));
+
+        std::array<sfTransform, 3> transforms{};
+        transforms.fill(sfTransform_Identity);
+        sfTransform_translate(&transforms[1], {4, 0});
+        sfTransform_translate(&transforms[2], {0, 4});
+        const std::array<sfColor, 3> colors = {sfRed, sfGreen, sfBlue};
+
+        const auto draw = [&]
+        {
+            sfRenderTexture_clear(renderTexture, sfBlack);
+            sfRenderTexture_drawVertexBufferInstanced(renderTexture,
+                                                      vertexBuffer,
+                                                      transforms.data(),
+                                                      colors.data(),
+                                                      transforms.size(),
+                                                      nullptr);
+            sfRenderTexture_display(renderTexture);
+            return sfTexture_copyToImage(sfRenderTexture_getTexture(renderTexture));
+        };
+
+        // Without a copy of the vertices, the instance colors are ignored
+        sfImage* image = draw();
+        REQUIRE(image);
+        checkPixel(image, {0, 0}, sfWhite);
+        checkPixel(image, {4, 0}, sfWhite);
+        checkPixel(image, {0, 4}, sfWhite);
+        checkPixel(image, {4, 4}, sfBlack);
+        sfImage_destroy(image);
+
+        // With a copy, the instances are expanded and modulated by their colors
+        sfVertexBuffer_setLocalCopyEnabled(vertexBuffer, true);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, square.data(), squareSize, 0));
+        image = draw();
+        REQUIRE(image);
+        checkPixel(image, {0, 0}, sfRed);
+        checkPixel(image, {4, 0}, sfGreen);
+        checkPixel(image, {0, 4}, sfBlue);
+        checkPixel(image, {4, 4}, sfBlack);
+        sfImage_destroy(image);
+
+        // Strips are drawn with one call per instance
+        sfVertexBuffer_setPrimitiveType(vertexBuffer, sfTriangleStrip);
+        REQUIRE(sfVertexBuffer_update(vertexBuffer, strip.data(), static_cast<unsigned int>(strip.size()), 0));
+        image = draw();
+        REQUIRE(image);
+        checkPixel(image, {1, 1}, sfRed);
+        checkPixel(image, {5, 1}, sfGreen);
+        checkPixel(image, {1, 5}, sfBlue);
+        checkPixel(image, {5, 5}, sfBlack);
+        sfImage_destroy(image);
+
+        sfRenderTexture_destroy(renderTexture);
+    }
+
+    sfVertexBuffer_destroy(vertexBuffer);
+}
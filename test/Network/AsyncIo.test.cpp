@@ -0,0 +1,273 @@
+#include <CSFML/Network/AsyncIo.h>
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/TcpListener.h>
+#include <CSFML/Network/TcpSocket.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <cstring>
+
+namespace
+{
+// Connected client and server sockets over the loopback interface, where the server
+// echoes everything it receives
+class EchoLoopback
+{
+public:
+    static constexpr std::size_t messageSize = 16;
+
+    EchoLoopback(sfAsyncIo* asyncIo, std::size_t connections) : m_asyncIo(asyncIo)
+    {
+        REQUIRE(sfTcpListener_listen(m_listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+
+        const unsigned short port = sfTcpListener_getLocalPort(m_listener);
+        for (std::size_t i = 0; i < connections; ++i)
+        {
+            sfTcpSocket* client = sfTcpSocket_create();
+            sfTcpSocket* server = nullptr;
+            if (sfTcpSocket_connect(client, sfIpAddress_LocalHost, port, sfTime_Zero) != sfSocketDone ||
+                sfTcpListener_accept(m_listener, &server) != sfSocketDone)
+            {
+                sfTcpSocket_destroy(client);
+                break;
+            }
+
+            m_clients.push_back(client);
+            m_servers.push_back(server);
+        }
+
+        m_buffers.resize(m_clients.size());
+        m_tokens.resize(m_clients.size() * 2);
+        for (std::size_t i = 0; i < m_servers.size(); ++i)
+            sfAsyncIo_receive(m_asyncIo, m_servers[i], m_buffers[i].server.data(), messageSize, serverToken(i));
+    }
+
+    ~EchoLoopback()
+    {
+        for (std::size_t i = 0; i < m_clients.size(); ++i)
+        {
+            sfAsyncIo_cancelTcpSocket(m_asyncIo, m_clients[i]);
+            sfAsyncIo_cancelTcpSocket(m_asyncIo, m_servers[i]);
+            sfTcpSocket_destroy(m_clients[i]);
+            sfTcpSocket_destroy(m_servers[i]);
+        }
+        sfTcpListener_destroy(m_listener);
+    }
+
+    std::size_t getConnectionCount() const
+    {
+        return m_clients.size();
+    }
+
+    // Send one request from each client and wait for all the answers
+    bool run()
+    {
+        for (std::size_t i = 0; i < m_clients.size(); ++i)
+        {
+            std::memset(m_buffers[i].client.data(), static_cast<int>(i), messageSize);
+            sfAsyncIo_send(m_asyncIo, m_clients[i], m_buffers[i].client.data(), messageSize, nullptr);
+            sfAsyncIo_receive(m_asyncIo, m_clients[i], m_buffers[i].client.data(), messageSize, clientToken(i));
+        }
+
+        std::size_t                        answers = 0;
+        std::array<sfAsyncIoCompletion, 64> completions{};
+        while (answers < m_clients.size())
+        {
+            const std::size_t count = sfAsyncIo_reap(m_asyncIo, completions.data(), completions.size(), sfSeconds(5));
+            if (count == 0)
+                return false;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const sfAsyncIoCompletion& completion = completions[i];
+                if (completion.status != sfSocketDone)
+                    return false;
+                if (completion.userData == nullptr)
+                    continue;
+
+                const auto token = static_cast<std::size_t>(static_cast<char*>(completion.userData) - m_tokens.data());
+                const std::size_t index = token / 2;
+                if (token % 2 == 0)
+                {
+                    auto& buffer = m_buffers[index].server;
+                    sfAsyncIo_send(m_asyncIo, completion.socket, buffer.data(), completion.transferred, nullptr);
+                    sfAsyncIo_receive(m_asyncIo, completion.socket, buffer.data(), messageSize, completion.userData);
+                }
+                else
+                {
+                    if (completion.transferred != messageSize ||
+                        m_buffers[index].client[0] != static_cast<char>(index))
+                        return false;
+                    ++answers;
+                }
+            }
+        }
+
+        return true;
+    }
+
+private:
+    struct Buffers
+    {
+        std::array<char, messageSize> client;
+        std::array<char, messageSize> server;
+    };
+
+    // Tokens are addresses in a dummy array, even for servers and odd for clients
+    void* serverToken(std::size_t index)
+    {
+        return &m_tokens[index * 2];
+    }
+
+    void* clientToken(std::size_t index)
+    {
+        return &m_tokens[index * 2 + 1];
+    }
+
+    sfAsyncIo*                m_asyncIo;
+    sfTcpListener*            m_listener{sfTcpListener_create()};
+    std::vector<sfTcpSocket*> m_clients;
+    std::vector<sfTcpSocket*> m_servers;
+    std::vector<Buffers>      m_buffers;
+    std::vector<char>         m_tokens;
+};
+} // namespace
+
+TEST_CASE("[Network] sfAsyncIo")
+{
+    const bool emulate = GENERATE(false, true);
+    sfAsyncIo* asyncIo = sfAsyncIo_create(emulate);
+    REQUIRE(asyncIo);
+    if (emulate)
+        CHECK(sfAsyncIo_isEmulated(asyncIo));
+
+    SECTION("sfAsyncIo_reap")
+    {
+        std::array<sfAsyncIoCompletion, 4> completions{};
+        CHECK(sfAsyncIo_getPendingCount(asyncIo) == 0);
+        CHECK(sfAsyncIo_reap(asyncIo, completions.data(), completions.size(), sfTime_Zero) == 0);
+    }
+
+    SECTION("sfAsyncIo_send")
+    {
+        sfTcpSocket* socket = sfTcpSocket_create();
+        CHECK(!sfAsyncIo_send(asyncIo, socket, "CSFML", 5, nullptr));
+        CHECK(sfAsyncIo_getPendingCount(asyncIo) == 0);
+        sfTcpSocket_destroy(socket);
+    }
+
+    SECTION("sfAsyncIo_accept")
+    {
+        sfTcpListener* listener = sfTcpListener_create();
+        REQUIRE(sfTcpListener_listen(listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        CHECK(sfAsyncIo_accept(asyncIo, listener, listener));
+        CHECK(sfAsyncIo_getPendingCount(asyncIo) == 1);
+
+        std::array<sfAsyncIoCompletion, 4> completions{};
+        CHECK(sfAsyncIo_reap(asyncIo, completions.data(), completions.size(), sfMilliseconds(1)) == 0);
+
+        sfTcpSocket* client = sfTcpSocket_create();
+        REQUIRE(sfTcpSocket_connect(client, sfIpAddress_LocalHost, sfTcpListener_getLocalPort(listener), sfTime_Zero) ==
+                sfSocketDone);
+        REQUIRE(sfAsyncIo_reap(asyncIo, completions.data(), completions.size(), sfSeconds(1)) == 1);
+        CHECK(completions[0].operation == sfAsyncIoAccept);
+        CHECK(completions[0].status == sfSocketDone);
+        CHECK(completions[0].listener == listener);
+        CHECK(completions[0].userData == listener);
+        REQUIRE(completions[0].socket);
+        CHECK(sfTcpSocket_getRemotePort(completions[0].socket) == sfTcpSocket_getLocalPort(client));
+        CHECK(sfAsyncIo_getPendingCount(asyncIo) == 0);
+
+        sfTcpSocket_destroy(completions[0].socket);
+        sfTcpSocket_destroy(client);
+        sfAsyncIo_cancelTcpListener(asyncIo, listener);
+        sfTcpListener_destroy(listener);
+    }
+
+    SECTION("sfAsyncIo_cancelTcpSocket")
+    {
+        EchoLoopback loopback(asyncIo, 1);
+        REQUIRE(loopback.getConnectionCount() == 1);
+        CHECK(sfAsyncIo_getPendingCount(asyncIo) == 1);
+    }
+
+    SECTION("Blocking state")
+    {
+        sfTcpListener* listener = sfTcpListener_create();
+        sfTcpSocket*   client   = sfTcpSocket_create();
+        sfTcpSocket*   server   = nullptr;
+        REQUIRE(sfTcpListener_listen(listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        REQUIRE(sfTcpSocket_connect(client, sfIpAddress_LocalHost, sfTcpListener_getLocalPort(listener), sfTime_Zero) ==
+                sfSocketDone);
+        REQUIRE(sfTcpListener_accept(listener, &server) == sfSocketDone);
+        sfTcpSocket_setBlocking(client, false);
+
+        // Cancelling running receives gives the sockets back as they were
+        std::array<char, 16> buffer{};
+        CHECK(sfAsyncIo_receive(asyncIo, server, buffer.data(), buffer.size(), nullptr));
+        CHECK(sfAsyncIo_receive(asyncIo, client, buffer.data(), buffer.size(), nullptr));
+        CHECK(sfAsyncIo_accept(asyncIo, listener, nullptr));
+        sfAsyncIo_cancelTcpSocket(asyncIo, server);
+        sfAsyncIo_cancelTcpSocket(asyncIo, client);
+        sfAsyncIo_cancelTcpListener(asyncIo, listener);
+        CHECK(sfTcpSocket_isBlocking(server));
+        CHECK(!sfTcpSocket_isBlocking(client));
+        CHECK(sfTcpListener_isBlocking(listener));
+
+        // The sockets are still usable
+        REQUIRE(sfTcpSocket_send(server, "CSFML", 5) == sfSocketDone);
+        sfTcpSocket_setBlocking(client, true);
+        std::size_t received = 0;
+        CHECK(sfTcpSocket_receive(client, buffer.data(), buffer.size(), &received) == sfSocketDone);
+        CHECK(received == 5);
+
+        sfTcpSocket_destroy(server);
+        sfTcpSocket_destroy(client);
+        sfTcpListener_destroy(listener);
+    }
+
+    SECTION("Echo")
+    {
+        EchoLoopback loopback(asyncIo, 10);
+        REQUIRE(loopback.getConnectionCount() == 10);
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(loopback.run());
+    }
+
+    CHECK(sfAsyncIo_getPendingCount(asyncIo) == 0);
+    sfAsyncIo_destroy(asyncIo);
+}
+
+TEST_CASE("[Network] sfAsyncIo benchmark", "[.benchmark]")
+{
+    // Each iteration sends one request on every connection, so the number of
+    // requests per second is the number of connections divided by the mean time;
+    // 10000 connections need a limit of more than 20000 open files
+    const bool emulate = GENERATE(false, true);
+    sfAsyncIo* asyncIo = sfAsyncIo_create(emulate);
+    REQUIRE(asyncIo);
+
+    for (const std::size_t connections : std::array<std::size_t, 3>{1, 100, 10000})
+    {
+        EchoLoopback loopback(asyncIo, connections);
+        if (loopback.getConnectionCount() < connections)
+        {
+            WARN("Could not open " << connections << " connections");
+            continue;
+        }
+
+        BENCHMARK((sfAsyncIo_isEmulated(asyncIo) ? "Emulated, connections: " : "io_uring, connections: ") +
+                  std::to_string(connections))
+        {
+            return loopback.run();
+        };
+    }
+
+    sfAsyncIo_destroy(asyncIo);
+}
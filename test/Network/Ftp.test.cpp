@@ -1,9 +1,314 @@
 #include <CSFML/Network/Ftp.h>
+#include <CSFML/Network/TcpListener.h>
+#include <CSFML/Network/TcpSocket.h>
 
 #include <SFML/Network/Ftp.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Stand-in FTP server over the loopback interface, serving each session in its own thread;
+// it stores the files in memory, in paths relative to the working directory of the session,
+// and supports the commands needed by the transfers in passive mode
+class FtpServer
+{
+public:
+    FtpServer()
+    {
+        REQUIRE(sfTcpListener_listen(m_listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        m_thread = std::thread([this] { run(); });
+    }
+
+    ~FtpServer()
+    {
+        // Wake the server up from its wait for a connection
+        m_stop              = true;
+        sfTcpSocket* wakeUp = sfTcpSocket_create();
+        sfTcpSocket_connect(wakeUp, sfIpAddress_LocalHost, getPort(), sfTime_Zero);
+        m_thread.join();
+        sfTcpSocket_destroy(wakeUp);
+        sfTcpListener_destroy(m_listener);
+
+        // The sessions end once the clients close them
+        for (std::thread& session : m_sessions)
+            session.join();
+    }
+
+    unsigned short getPort() const
+    {
+        return sfTcpListener_getLocalPort(m_listener);
+    }
+
+    void setFile(const std::string& name, std::string content)
+    {
+        const std::lock_guard lock(m_mutex);
+        m_files[name] = std::move(content);
+    }
+
+    std::string getFile(const std::string& name)
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_files[name];
+    }
+
+    int getSessionCount() const
+    {
+        return m_sessionCount;
+    }
+
+private:
+    // State of a session
+    struct Session
+    {
+        sfTcpSocket*   socket{};
+        sfTcpListener* dataListener{};
+        std::string    directory;
+
+        std::string getPath(const std::string& name) const
+        {
+            return directory.empty() ? name : directory + "/" + name;
+        }
+    };
+
+    void run()
+    {
+        sfTcpSocket* socket = nullptr;
+        while (sfTcpListener_accept(m_listener, &socket) == sfSocketDone)
+        {
+            if (m_stop)
+            {
+                sfTcpSocket_destroy(socket);
+                return;
+            }
+
+            ++m_sessionCount;
+            m_sessions.emplace_back(
+                [this, socket]
+                {
+                    Session session;
+                    session.socket = socket;
+                    serve(session);
+                    sfTcpListener_destroy(session.dataListener);
+                    sfTcpSocket_destroy(socket);
+                });
+        }
+    }
+
+    void serve(Session& session)
+    {
+        sfTcpSocket* socket = session.socket;
+        reply(socket, "220 Ready");
+        std::string received;
+        for (;;)
+        {
+            const std::size_t end = received.find("\r\n");
+            if (end == std::string::npos)
+            {
+                std::array<char, 1024> buffer{};
+                std::size_t            count = 0;
+                if (sfTcpSocket_receive(socket, buffer.data(), buffer.size(), &count) != sfSocketDone)
+                    break;
+                received.append(buffer.data(), count);
+                continue;
+            }
+
+            const std::string line = received.substr(0, end);
+            received.erase(0, end + 2);
+            const std::size_t space     = line.find(' ');
+            const std::string command   = line.substr(0, space);
+            const std::string parameter = space == std::string::npos ? "" : line.substr(space + 1);
+            if (command == "QUIT")
+            {
+                reply(socket, "221 Bye");
+                break;
+            }
+            execute(session, command, parameter);
+        }
+    }
+
+    void execute(Session& session, const std::string& command, const std::string& parameter)
+    {
+        sfTcpSocket* socket = session.socket;
+        if (command == "PASV")
+        {
+            sfTcpListener_destroy(session.dataListener);
+            session.dataListener = sfTcpListener_create();
+            if (sfTcpListener_listen(session.dataListener, 0, sfIpAddress_LocalHost) != sfSocketDone)
+                return reply(socket, "425 Can't open data connection");
+
+            const unsigned short port = sfTcpListener_getLocalPort(session.dataListener);
+            reply(socket,
+                  "227 Entering Passive Mode (127,0,0,1," + std::to_string(port / 256) + "," +
+                      std::to_string(port % 256) + ")");
+        }
+        else if (command == "SIZE" || command == "RETR")
+        {
+            std::string content;
+            {
+                const std::lock_guard lock(m_mutex);
+                const auto            file = m_files.find(session.getPath(parameter));
+                if (file == m_files.end())
+                    return reply(socket, "550 No such file");
+                content = file->second;
+            }
+
+            if (command == "SIZE")
+                return reply(socket, "213 " + std::to_string(content.size()));
+
+            sendData(session, content);
+        }
+        else if (command == "NLST")
+        {
+            std::string listing;
+            {
+                const std::lock_guard lock(m_mutex);
+                for (const auto& [name, content] : m_files)
+                    listing += name + "\r\n";
+            }
+            sendData(session, listing);
+        }
+        else if (command == "STOR" || command == "APPE")
+        {
+            reply(socket, "150 Opening data connection");
+            sfTcpSocket* data = nullptr;
+            if (sfTcpListener_accept(session.dataListener, &data) != sfSocketDone)
+                return reply(socket, "425 Can't open data connection");
+
+            std::string            content;
+            std::array<char, 4096> buffer{};
+            std::size_t            count = 0;
+            while (sfTcpSocket_receive(data, buffer.data(), buffer.size(), &count) == sfSocketDone)
+                content.append(buffer.data(), count);
+            sfTcpSocket_destroy(data);
+
+            const std::lock_guard lock(m_mutex);
+            if (command == "STOR")
+                m_files[session.getPath(parameter)] = content;
+            else
+                m_files[session.getPath(parameter)] += content;
+            reply(socket, "226 Transfer complete");
+        }
+        else if (command == "CWD")
+        {
+            const std::size_t start = parameter.find_first_not_of('/');
+            session.directory       = start == std::string::npos ? "" : parameter.substr(start);
+            reply(socket, "250 Ok");
+        }
+        else if (command == "HELP")
+        {
+            reply(socket, "214-Commands:\r\n RETR STOR\r\n214 End");
+        }
+        else if (command == "PWD")
+        {
+            reply(socket, "257 \"/" + session.directory + "\" is the current directory");
+        }
+        else
+        {
+            reply(socket, "200 Ok");
+        }
+    }
+
+    void sendData(Session& session, const std::string& content)
+    {
+        sfTcpSocket* socket = session.socket;
+        reply(socket, "150 Opening data connection");
+        sfTcpSocket* data = nullptr;
+        if (sfTcpListener_accept(session.dataListener, &data) != sfSocketDone)
+            return reply(socket, "425 Can't open data connection");
+
+        const bool sent = content.empty() || sfTcpSocket_send(data, content.data(), content.size()) == sfSocketDone;
+        sfTcpSocket_destroy(data);
+        reply(socket, sent ? "226 Transfer complete" : "426 Transfer aborted");
+    }
+
+    static void reply(sfTcpSocket* socket, const std::string& message)
+    {
+        const std::string line = message + "\r\n";
+        sfTcpSocket_send(socket, line.data(), line.size());
+    }
+
+    sfTcpListener*                     m_listener{sfTcpListener_create()};
+    std::thread                        m_thread;
+    std::vector<std::thread>           m_sessions;
+    std::atomic<bool>                  m_stop{};
+    std::atomic<int>                   m_sessionCount{};
+    std::mutex                         m_mutex;
+    std::map<std::string, std::string> m_files;
+};
+
+// Content of the given size, which can be checked as it arrives
+std::string makeContent(std::size_t size)
+{
+    std::string content(size, '\0');
+    for (std::size_t i = 0; i < size; ++i)
+        content[i] = static_cast<char>(i * 7 % 251);
+    return content;
+}
+
+// Progress reported by a transfer
+struct Progress
+{
+    std::uint64_t transferred{};
+    std::uint64_t total{};
+    int           calls{};
+    int           stopAfter{-1};
+};
+
+bool onProgress(std::uint64_t transferred, std::uint64_t total, void* userData)
+{
+    auto& progress = *static_cast<Progress*>(userData);
+    CHECK(transferred > progress.transferred);
+    progress.transferred = transferred;
+    progress.total       = total;
+    return ++progress.calls != progress.stopAfter;
+}
+
+// Stream reading from a string
+struct StringStream
+{
+    std::string content;
+    std::size_t position{};
+};
+
+sfInputStream makeStream(StringStream& stream)
+{
+    return {[](void* data, std::size_t size, void* userData) -> std::int64_t
+            {
+                auto&             string = *static_cast<StringStream*>(userData);
+                const std::size_t count  = std::min(size, string.content.size() - string.position);
+                std::copy_n(string.content.data() + string.position, count, static_cast<char*>(data));
+                string.position += count;
+                return static_cast<std::int64_t>(count);
+            },
+            [](std::size_t position, void* userData) -> std::int64_t
+            {
+                auto& string    = *static_cast<StringStream*>(userData);
+                string.position = std::min(position, string.content.size());
+                return static_cast<std::int64_t>(string.position);
+            },
+            [](void* userData) -> std::int64_t
+            { return static_cast<std::int64_t>(static_cast<StringStream*>(userData)->position); },
+            [](void* userData) -> std::int64_t
+            { return static_cast<std::int64_t>(static_cast<StringStream*>(userData)->content.size()); },
+            &stream};
+}
+} // namespace
+
 TEST_CASE("[Network] sfFtp")
 {
     SECTION("sfFtpTransferMode")
@@ -66,4 +371,224 @@ TEST_CASE("[Network] sfFtp")
         STATIC_CHECK(sfFtpConnectionClosed == static_cast<int>(sf::Ftp::Response::Status::ConnectionClosed));
         STATIC_CHECK(sfFtpInvalidFile == static_cast<int>(sf::Ftp::Response::Status::InvalidFile));
     }
+
+    SECTION("Response reuse")
+    {
+        FtpServer server;
+        server.setFile("a.txt", "a");
+        server.setFile("b.txt", "b");
+
+        sfFtp*         ftp      = sfFtp_create();
+        sfFtpResponse* response = sfFtp_connect(ftp, sfIpAddress_LocalHost, server.getPort(), sfTime_Zero);
+        REQUIRE(sfFtpResponse_isOk(response));
+        sfFtp_releaseResponse(ftp, response);
+        sfFtpResponse* reused = sfFtp_keepAlive(ftp);
+        CHECK(reused == response);
+        CHECK(sfFtpResponse_getStatus(reused) == sfFtpOk);
+        sfFtpResponse_destroy(reused);
+
+        sfFtpDirectoryResponse* directory = sfFtp_getWorkingDirectory(ftp);
+        REQUIRE(sfFtpDirectoryResponse_isOk(directory));
+        sfFtp_releaseDirectoryResponse(ftp, directory);
+        CHECK(sfFtp_getWorkingDirectory(ftp) == directory);
+        sfFtpDirectoryResponse_destroy(directory);
+
+        sfFtpListingResponse* listing = sfFtp_getDirectoryListing(ftp, "");
+        REQUIRE(sfFtpListingResponse_getStatus(listing) == sfFtpClosingDataConnection);
+        CHECK(sfFtpListingResponse_getCount(listing) == 2);
+        sfFtp_releaseListingResponse(ftp, listing);
+        server.setFile("c.txt", "c");
+        CHECK(sfFtp_getDirectoryListing(ftp, "") == listing);
+        CHECK(sfFtpListingResponse_getCount(listing) == 3);
+        CHECK(std::string(sfFtpListingResponse_getName(listing, 2)) == "c.txt");
+        sfFtpListingResponse_destroy(listing);
+
+        // Multiline replies are read whole, the next reply follows them
+        sfFtpResponse* help = sfFtp_sendCommand(ftp, "HELP", nullptr);
+        CHECK(sfFtpResponse_getStatus(help) == sfFtpHelpMessage);
+        CHECK(std::string(sfFtpResponse_getMessage(help)) == "-Commands:\n RETR STOR\n214 End");
+        sfFtpResponse_destroy(help);
+
+        // Released responses are destroyed with the Ftp object
+        sfFtp_releaseResponse(ftp, sfFtp_keepAlive(ftp));
+        sfFtp_releaseDirectoryResponse(ftp, sfFtp_getWorkingDirectory(ftp));
+        sfFtp_releaseListingResponse(ftp, nullptr);
+        sfFtpResponse_destroy(sfFtp_disconnect(ftp));
+        sfFtp_destroy(ftp);
+    }
+
+    SECTION("Transfers to memory and streams")
+    {
+        FtpServer         server;
+        const std::string content = makeContent(1'000'000);
+        server.setFile("patch.bin", content);
+
+        sfFtp*         ftp      = sfFtp_create();
+        sfFtpResponse* response = sfFtp_connect(ftp, sfIpAddress_LocalHost, server.getPort(), sfTime_Zero);
+        REQUIRE(sfFtpResponse_isOk(response));
+        sfFtpResponse_destroy(response);
+
+        SECTION("sfFtp_downloadToBuffer")
+        {
+            sfBuffer* buffer = sfBuffer_create();
+            Progress  progress;
+            response = sfFtp_downloadToBuffer(ftp, "patch.bin", sfFtpBinary, buffer, onProgress, &progress);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpClosingDataConnection);
+            sfFtpResponse_destroy(response);
+            CHECK(std::string(reinterpret_cast<const char*>(sfBuffer_getData(buffer)), sfBuffer_getSize(buffer)) ==
+                  content);
+            CHECK(progress.transferred == content.size());
+            CHECK(progress.total == content.size());
+            CHECK(progress.calls > 1);
+
+            // The total size is unknown in ASCII mode
+            progress = {};
+            response = sfFtp_downloadToBuffer(ftp, "patch.bin", sfFtpAscii, buffer, onProgress, &progress);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            CHECK(sfBuffer_getSize(buffer) == content.size());
+            CHECK(progress.total == 0);
+
+            response = sfFtp_downloadToBuffer(ftp, "missing.bin", sfFtpBinary, buffer, nullptr, nullptr);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpFileUnavailable);
+            sfFtpResponse_destroy(response);
+            CHECK(sfBuffer_getSize(buffer) == 0);
+            sfBuffer_destroy(buffer);
+        }
+
+        SECTION("sfFtp_downloadToCallback")
+        {
+            struct Received
+            {
+                std::string data;
+                std::size_t maxSize{};
+                std::size_t stopAt{};
+            } received;
+
+            const auto onData = [](const void* data, std::size_t size, void* userData)
+            {
+                auto& into = *static_cast<Received*>(userData);
+                into.data.append(static_cast<const char*>(data), size);
+                into.maxSize = std::max(into.maxSize, size);
+                return into.stopAt == 0 || into.data.size() < into.stopAt;
+            };
+
+            response = sfFtp_downloadToCallback(ftp, "patch.bin", sfFtpBinary, onData, nullptr, &received);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            CHECK(received.data == content);
+            CHECK(received.maxSize <= 16384);
+
+            // The server still answers the next commands after an aborted download
+            received        = {};
+            received.stopAt = 1;
+            response = sfFtp_downloadToCallback(ftp, "patch.bin", sfFtpBinary, onData, nullptr, &received);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpTransferAborted);
+            sfFtpResponse_destroy(response);
+            CHECK(received.data.size() < content.size());
+
+            received = {};
+            response = sfFtp_downloadToCallback(ftp, "patch.bin", sfFtpBinary, onData, nullptr, &received);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            CHECK(received.data == content);
+        }
+
+        SECTION("sfFtp_uploadFromStream")
+        {
+            StringStream  stream{content, 1234};
+            sfInputStream inputStream = makeStream(stream);
+            Progress      progress;
+            response = sfFtp_uploadFromStream(ftp,
+                                              &inputStream,
+                                              "upload.bin",
+                                              sfFtpBinary,
+                                              false,
+                                              onProgress,
+                                              &progress);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpClosingDataConnection);
+            sfFtpResponse_destroy(response);
+            CHECK(server.getFile("upload.bin") == content);
+            CHECK(progress.transferred == content.size());
+            CHECK(progress.total == content.size());
+
+            response = sfFtp_uploadFromStream(ftp, &inputStream, "upload.bin", sfFtpBinary, true, nullptr, nullptr);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            CHECK(server.getFile("upload.bin") == content + content);
+
+            progress           = {};
+            progress.stopAfter = 2;
+            response = sfFtp_uploadFromStream(ftp,
+                                              &inputStream,
+                                              "aborted.bin",
+                                              sfFtpBinary,
+                                              false,
+                                              onProgress,
+                                              &progress);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpTransferAborted);
+            sfFtpResponse_destroy(response);
+            CHECK(progress.calls == 2);
+        }
+
+        SECTION("sfFtp_download and sfFtp_upload")
+        {
+            const std::filesystem::path directory = std::filesystem::temp_directory_path() / "csfml-ftp-test";
+            std::filesystem::create_directories(directory);
+
+            response = sfFtp_download(ftp, "patch.bin", directory.string().c_str(), sfFtpBinary);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpClosingDataConnection);
+            sfFtpResponse_destroy(response);
+            std::ifstream file(directory / "patch.bin", std::ios_base::binary);
+            CHECK(std::string(std::istreambuf_iterator<char>(file), {}) == content);
+            file.close();
+
+            const std::string localFile = (directory / "patch.bin").string();
+            response = sfFtp_upload(ftp, localFile.c_str(), "copy", sfFtpBinary, false);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpClosingDataConnection);
+            sfFtpResponse_destroy(response);
+            CHECK(server.getFile("copy/patch.bin") == content);
+
+            // A failed download leaves no file
+            response = sfFtp_download(ftp, "missing.bin", directory.string().c_str(), sfFtpBinary);
+            CHECK(sfFtpResponse_getStatus(response) == sfFtpFileUnavailable);
+            sfFtpResponse_destroy(response);
+            CHECK(!std::filesystem::exists(directory / "missing.bin"));
+
+            std::filesystem::remove_all(directory);
+        }
+
+        SECTION("Working directory")
+        {
+            // The transfers use the connection of the Ftp object, in its working directory
+            server.setFile("sub/patch.bin", "sub");
+            response = sfFtp_loginAnonymous(ftp);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            response = sfFtp_changeDirectory(ftp, "/sub");
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+
+            sfBuffer* buffer = sfBuffer_create();
+            response         = sfFtp_downloadToBuffer(ftp, "patch.bin", sfFtpBinary, buffer, nullptr, nullptr);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            CHECK(std::string(reinterpret_cast<const char*>(sfBuffer_getData(buffer)), sfBuffer_getSize(buffer)) ==
+                  "sub");
+            sfBuffer_destroy(buffer);
+
+            StringStream  stream{"uploaded", 0};
+            sfInputStream inputStream = makeStream(stream);
+            response = sfFtp_uploadFromStream(ftp, &inputStream, "upload.txt", sfFtpBinary, false, nullptr, nullptr);
+            CHECK(sfFtpResponse_isOk(response));
+            sfFtpResponse_destroy(response);
+            CHECK(server.getFile("sub/upload.txt") == "uploaded");
+            CHECK(server.getSessionCount() == 1);
+        }
+
+        response = sfFtp_disconnect(ftp);
+        CHECK(sfFtpResponse_isOk(response));
+        sfFtpResponse_destroy(response);
+        sfFtp_destroy(ftp);
+    }
 }
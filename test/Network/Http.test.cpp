@@ -1,9 +1,208 @@
 #include <CSFML/Network/Http.h>
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/TcpListener.h>
+#include <CSFML/Network/TcpSocket.h>
 
 #include <SFML/Network/Http.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+// Body of the given size, which can be checked as it arrives
+char getBodyByte(std::size_t position)
+{
+    return static_cast<char>('a' + position % 26);
+}
+
+// Stand-in HTTP server over the loopback interface, serving one connection at a time;
+// it answers every request with its URI as body, or with a body of n bytes for the
+// URIs "/length/n", "/chunked/n" and "/eof/n", the second with the chunked transfer
+// encoding and the third ending with the connection, or with the header of the request
+// in lower case for the URI "/header"; it closes the connection after requests which
+// don't ask for keep-alive or whose URI is "/close", and stops in the middle of the
+// body of the URI "/stall" for a second before closing the connection
+class HttpServer
+{
+public:
+    HttpServer()
+    {
+        REQUIRE(sfTcpListener_listen(m_listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        m_thread = std::thread([this] { run(); });
+    }
+
+    ~HttpServer()
+    {
+        // Wake the server up from its wait for a connection
+        m_stop              = true;
+        sfTcpSocket* wakeUp = sfTcpSocket_create();
+        sfTcpSocket_connect(wakeUp, sfIpAddress_LocalHost, getPort(), sfTime_Zero);
+        m_thread.join();
+        sfTcpSocket_destroy(wakeUp);
+        sfTcpListener_destroy(m_listener);
+    }
+
+    unsigned short getPort() const
+    {
+        return sfTcpListener_getLocalPort(m_listener);
+    }
+
+    int getConnectionCount() const
+    {
+        return m_connections;
+    }
+
+private:
+    void run()
+    {
+        sfTcpSocket* socket = nullptr;
+        while (sfTcpListener_accept(m_listener, &socket) == sfSocketDone)
+        {
+            if (m_stop)
+            {
+                sfTcpSocket_destroy(socket);
+                return;
+            }
+
+            ++m_connections;
+            serve(socket);
+            sfTcpSocket_destroy(socket);
+        }
+    }
+
+    static void serve(sfTcpSocket* socket)
+    {
+        std::string             received;
+        std::array<char, 16384> buffer{};
+        for (;;)
+        {
+            const std::size_t headerEnd = received.find("\r\n\r\n");
+            if (headerEnd == std::string::npos)
+            {
+                std::size_t count = 0;
+                if (sfTcpSocket_receive(socket, buffer.data(), buffer.size(), &count) != sfSocketDone)
+                    return;
+                received.append(buffer.data(), count);
+                continue;
+            }
+
+            std::string header = received.substr(0, headerEnd + 4);
+            for (char& character : header)
+                character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+
+            const std::size_t lengthField = header.find("content-length: ");
+            const std::size_t length      = lengthField == std::string::npos
+                                                ? 0
+                                                : std::strtoul(header.c_str() + lengthField + 16, nullptr, 10);
+            if (received.size() < header.size() + length)
+            {
+                std::size_t count = 0;
+                if (sfTcpSocket_receive(socket, buffer.data(), buffer.size(), &count) != sfSocketDone)
+                    return;
+                received.append(buffer.data(), count);
+                continue;
+            }
+            received.erase(0, header.size() + length);
+
+            const std::size_t uriStart  = header.find(' ') + 1;
+            const std::string uri       = header.substr(uriStart, header.find(' ', uriStart) - uriStart);
+            const bool        keepAlive = header.find("connection: keep-alive") != std::string::npos && uri != "/close";
+
+            if (!respond(socket, uri, header, keepAlive) || !keepAlive)
+                return;
+        }
+    }
+
+    static bool respond(sfTcpSocket* socket, const std::string& uri, const std::string& header, bool keepAlive)
+    {
+        const bool  isHead  = header.compare(0, 5, "head ") == 0;
+        const bool  chunked    = uri.compare(0, 9, "/chunked/") == 0;
+        const bool  untilClose = uri.compare(0, 5, "/eof/") == 0;
+        std::string body       = uri == "/header" ? header : uri;
+        if (chunked || untilClose || uri.compare(0, 8, "/length/") == 0)
+        {
+            body.resize(std::strtoul(uri.c_str() + uri.rfind('/') + 1, nullptr, 10));
+            for (std::size_t i = 0; i < body.size(); ++i)
+                body[i] = getBodyByte(i);
+        }
+
+        std::string response = "HTTP/1.1 200 OK\r\n";
+        if (untilClose || uri == "/stall")
+        {
+            response += "\r\n" + body.substr(0, uri == "/stall" ? 3 : body.size());
+            sfTcpSocket_send(socket, response.data(), response.size());
+            if (uri == "/stall")
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+            return false;
+        }
+
+        if (chunked)
+            response += "Transfer-Encoding: chunked\r\n";
+        else
+            response += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        response += keepAlive ? "\r\n" : "Connection: close\r\n\r\n";
+        if (!isHead && chunked)
+        {
+            for (std::size_t i = 0; i < body.size(); i += 1000)
+            {
+                const std::size_t size = std::min<std::size_t>(1000, body.size() - i);
+                std::array<char, 16> line{};
+                std::snprintf(line.data(), line.size(), "%zx\r\n", size);
+                response += line.data() + body.substr(i, size) + "\r\n";
+            }
+            response += "0\r\nX-Trailer: true\r\n\r\n";
+        }
+        else if (!isHead)
+        {
+            response += body;
+        }
+
+        return sfTcpSocket_send(socket, response.data(), response.size()) == sfSocketDone;
+    }
+
+    sfTcpListener*    m_listener{sfTcpListener_create()};
+    std::thread       m_thread;
+    std::atomic<bool> m_stop{};
+    std::atomic<int>  m_connections{};
+};
+
+// Send requests for the given URIs, and check that the body of each response is its URI
+void checkRequests(sfHttp* http, const std::vector<std::string>& uris, sfHttpMethod method = sfHttpGet)
+{
+    std::vector<sfHttpRequest*> requests(uris.size());
+    for (std::size_t i = 0; i < uris.size(); ++i)
+    {
+        requests[i] = sfHttpRequest_create();
+        sfHttpRequest_setUri(requests[i], uris[i].c_str());
+        sfHttpRequest_setMethod(requests[i], uris[i] == "/post" ? sfHttpPost : method);
+    }
+
+    std::vector<sfHttpResponse*> responses(uris.size());
+    sfHttp_sendRequests(http, requests.data(), requests.size(), responses.data(), sfSeconds(5));
+    for (std::size_t i = 0; i < uris.size(); ++i)
+    {
+        CHECK(sfHttpResponse_getStatus(responses[i]) == sfHttpOk);
+        CHECK(sfHttpResponse_getBody(responses[i]) == (method == sfHttpHead ? "" : uris[i]));
+        sfHttpResponse_destroy(responses[i]);
+        sfHttpRequest_destroy(requests[i]);
+    }
+}
+} // namespace
+
 TEST_CASE("[Network] sfHttp")
 {
     SECTION("sfHttpMethod")
@@ -45,4 +244,240 @@ TEST_CASE("[Network] sfHttp")
         STATIC_CHECK(sfHttpInvalidResponse == static_cast<int>(sf::Http::Response::Status::InvalidResponse));
         STATIC_CHECK(sfHttpConnectionFailed == static_cast<int>(sf::Http::Response::Status::ConnectionFailed));
     }
+
+    SECTION("sfHttp_sendRequest")
+    {
+        HttpServer server;
+        sfHttp*    http = sfHttp_create();
+        sfHttp_setHost(http, "http://127.0.0.1/", server.getPort());
+
+        sfHttpRequest* request = sfHttpRequest_create();
+        sfHttpRequest_setUri(request, "header");
+        sfHttpRequest_setMethod(request, sfHttpPost);
+        sfHttpRequest_setHttpVersion(request, 1, 1);
+        sfHttpRequest_setField(request, "X-Custom", "Value");
+        sfHttpRequest_setBody(request, "body");
+
+        // The missing mandatory fields are added to the request
+        sfHttpResponse* response = sfHttp_sendRequest(http, request, sfSeconds(5));
+        CHECK(sfHttpResponse_getStatus(response) == sfHttpOk);
+        CHECK(sfHttpResponse_getMajorVersion(response) == 1);
+        CHECK(sfHttpResponse_getMinorVersion(response) == 1);
+        CHECK(std::string(sfHttpResponse_getField(response, "CONTENT-LENGTH")) ==
+              std::to_string(std::string(sfHttpResponse_getBody(response)).size()));
+        CHECK(std::string(sfHttpResponse_getField(response, "X-Missing")).empty());
+
+        const std::string header = sfHttpResponse_getBody(response);
+        CHECK(header.rfind("post /header http/1.1\r\n", 0) == 0);
+        CHECK(header.find("\r\nx-custom: value\r\n") != std::string::npos);
+        CHECK(header.find("\r\nhost: 127.0.0.1\r\n") != std::string::npos);
+        CHECK(header.find("\r\ncontent-length: 4\r\n") != std::string::npos);
+        CHECK(header.find("\r\ncontent-type: application/x-www-form-urlencoded\r\n") != std::string::npos);
+        CHECK(header.find("\r\nconnection: close\r\n") != std::string::npos);
+        CHECK(header.find("\r\nuser-agent: libsfml-network/3.x\r\n") != std::string::npos);
+        CHECK(header.find("\r\nfrom: user@sfml-dev.org\r\n") != std::string::npos);
+        sfHttpResponse_destroy(response);
+
+        // A body ending with the connection is complete only if the server closes it
+        sfHttpRequest_setMethod(request, sfHttpGet);
+        sfHttpRequest_setUri(request, "/eof/100000");
+        response = sfHttp_sendRequest(http, request, sfSeconds(5));
+        CHECK(sfHttpResponse_getStatus(response) == sfHttpOk);
+        CHECK(std::string(sfHttpResponse_getBody(response)).size() == 100'000);
+        sfHttpResponse_destroy(response);
+
+        sfHttpRequest_setUri(request, "/stall");
+        response = sfHttp_sendRequest(http, request, sfMilliseconds(100));
+        CHECK(sfHttpResponse_getStatus(response) == sfHttpConnectionFailed);
+        CHECK(std::string(sfHttpResponse_getBody(response)).empty());
+        sfHttpResponse_destroy(response);
+
+        // HTTPS is not supported, the request fails without connecting
+        const int connectionCount = server.getConnectionCount();
+        const std::string host    = "https://127.0.0.1";
+        sfHttp_setHost(http, host.c_str(), server.getPort());
+        response = sfHttp_sendRequest(http, request, sfSeconds(5));
+        CHECK(sfHttpResponse_getStatus(response) == sfHttpConnectionFailed);
+        CHECK(server.getConnectionCount() == connectionCount);
+        sfHttpResponse_destroy(response);
+
+        sfHttpRequest_destroy(request);
+        sfHttp_destroy(http);
+    }
+
+    SECTION("sfHttp_setPersistent")
+    {
+        HttpServer server;
+        sfHttp*    http = sfHttp_create();
+        sfHttp_setHost(http, "127.0.0.1", server.getPort());
+
+        for (int i = 0; i < 3; ++i)
+            checkRequests(http, {"/" + std::to_string(i)});
+        CHECK(server.getConnectionCount() == 3);
+
+        sfHttp_setPersistent(http, true);
+        for (int i = 0; i < 3; ++i)
+            checkRequests(http, {"/" + std::to_string(i)});
+        checkRequests(http, {"/head"}, sfHttpHead);
+        CHECK(server.getConnectionCount() == 4);
+
+        // The server closes the connection, the next request opens a new one
+        checkRequests(http, {"/close"});
+        checkRequests(http, {"/after"});
+        CHECK(server.getConnectionCount() == 5);
+
+        sfHttp_destroy(http);
+    }
+
+    SECTION("sfHttp_sendRequests")
+    {
+        HttpServer server;
+        sfHttp*    http = sfHttp_create();
+        sfHttp_setHost(http, "127.0.0.1", server.getPort());
+        sfHttp_setPersistent(http, true);
+
+        std::vector<std::string> uris;
+        for (int i = 0; i < 100; ++i)
+            uris.push_back("/" + std::to_string(i));
+        checkRequests(http, uris);
+        CHECK(server.getConnectionCount() == 1);
+
+        // Requests pipelined after a closing response are sent again on a new connection
+        checkRequests(http, {"/a", "/post", "/b", "/close", "/c", "/d"});
+        CHECK(server.getConnectionCount() == 2);
+
+        // Chunked bodies are decoded
+        sfHttpRequest* request = sfHttpRequest_create();
+        sfHttpRequest_setUri(request, "/chunked/100000");
+        sfHttpResponse* response = sfHttp_sendRequest(http, request, sfSeconds(5));
+        CHECK(sfHttpResponse_getStatus(response) == sfHttpOk);
+        CHECK(std::string(sfHttpResponse_getBody(response)).size() == 100'000);
+        CHECK(server.getConnectionCount() == 2);
+        sfHttpResponse_destroy(response);
+        sfHttpRequest_destroy(request);
+
+        sfHttp_destroy(http);
+    }
+
+    SECTION("sfHttp_sendRequestStreaming")
+    {
+        // Body received so far, checked as it arrives
+        struct Stream
+        {
+            bool        headers{};
+            std::size_t size{};
+            std::size_t largestChunk{};
+            bool        valid{true};
+            std::size_t limit{std::numeric_limits<std::size_t>::max()};
+        };
+
+        const auto onHeaders = [](const sfHttpResponse* response, void* userData)
+        {
+            static_cast<Stream*>(userData)->headers = sfHttpResponse_getStatus(response) == sfHttpOk;
+            return true;
+        };
+
+        const auto onBodyChunk = [](const void* data, size_t size, void* userData)
+        {
+            auto& stream = *static_cast<Stream*>(userData);
+            for (std::size_t i = 0; i < size; ++i)
+                stream.valid = stream.valid && static_cast<const char*>(data)[i] == getBodyByte(stream.size + i);
+            stream.size += size;
+            stream.largestChunk = std::max(stream.largestChunk, size);
+            return stream.size < stream.limit;
+        };
+
+        HttpServer     server;
+        sfHttp*        http    = sfHttp_create();
+        sfHttpRequest* request = sfHttpRequest_create();
+        sfHttp_setHost(http, "127.0.0.1", server.getPort());
+
+        for (const bool persistent : {false, true})
+        {
+            sfHttp_setPersistent(http, persistent);
+
+            for (const char* uri : {"/length/5000000", "/chunked/5000000"})
+            {
+                Stream stream;
+                sfHttpRequest_setUri(request, uri);
+                sfHttpResponse* response =
+                    sfHttp_sendRequestStreaming(http, request, onHeaders, onBodyChunk, &stream, sfSeconds(5));
+                CHECK(sfHttpResponse_getStatus(response) == sfHttpOk);
+                CHECK(std::string(sfHttpResponse_getBody(response)).empty());
+                CHECK(stream.headers);
+                CHECK(stream.size == 5'000'000);
+                CHECK(stream.largestChunk <= 16384);
+                CHECK(stream.valid);
+                sfHttpResponse_destroy(response);
+            }
+
+            // Stopping in the middle of the body closes the connection
+            Stream stream;
+            stream.limit = 100'000;
+            sfHttpRequest_setUri(request, "/chunked/5000000");
+            sfHttpResponse* response =
+                sfHttp_sendRequestStreaming(http, request, onHeaders, onBodyChunk, &stream, sfSeconds(5));
+            CHECK(sfHttpResponse_getStatus(response) == sfHttpConnectionFailed);
+            CHECK(stream.size < 5'000'000);
+            sfHttpResponse_destroy(response);
+
+            checkRequests(http, {"/after"});
+        }
+
+        sfHttpRequest_destroy(request);
+        sfHttp_destroy(http);
+    }
+}
+
+TEST_CASE("[Network] sfHttp benchmark", "[.benchmark]")
+{
+    // Each iteration sends 100 small requests, so the number of requests per second
+    // is 100 divided by the mean time
+    HttpServer server;
+    sfHttp*    http = sfHttp_create();
+    sfHttp_setHost(http, "127.0.0.1", server.getPort());
+
+    std::vector<sfHttpRequest*>  requests(100);
+    std::vector<sfHttpResponse*> responses(requests.size());
+    for (sfHttpRequest*& request : requests)
+    {
+        request = sfHttpRequest_create();
+        sfHttpRequest_setUri(request, "/telemetry");
+    }
+
+    const auto sendAll = [&](bool pipelined)
+    {
+        if (pipelined)
+        {
+            sfHttp_sendRequests(http, requests.data(), requests.size(), responses.data(), sfTime_Zero);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < requests.size(); ++i)
+                responses[i] = sfHttp_sendRequest(http, requests[i], sfTime_Zero);
+        }
+
+        for (sfHttpResponse* response : responses)
+            sfHttp_releaseResponse(http, response);
+    };
+
+    BENCHMARK("Connection per request")
+    {
+        sendAll(false);
+    };
+
+    sfHttp_setPersistent(http, true);
+    BENCHMARK("Persistent connection")
+    {
+        sendAll(false);
+    };
+
+    BENCHMARK("Persistent connection, pipelined")
+    {
+        sendAll(true);
+    };
+
+    for (sfHttpRequest* request : requests)
+        sfHttpRequest_destroy(request);
+    sfHttp_destroy(http);
 }
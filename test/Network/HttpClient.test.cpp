@@ -0,0 +1,268 @@
+#include <CSFML/Network/Http.h>
+#include <CSFML/Network/HttpClient.h>
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/TcpListener.h>
+#include <CSFML/Network/TcpSocket.h>
+#include <CSFML/System/Sleep.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdlib>
+
+namespace
+{
+// Stand-in HTTP server over the loopback interface, serving each connection in its own thread;
+// it answers every request with its URI as body, after waiting n milliseconds for the URIs
+// "/sleep/n", and keeps track of the maximum number of connections open at the same time
+class HttpServer
+{
+public:
+    HttpServer()
+    {
+        REQUIRE(sfTcpListener_listen(m_listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        m_thread = std::thread([this] { run(); });
+    }
+
+    ~HttpServer()
+    {
+        // Wake the server up from its wait for a connection
+        m_stop              = true;
+        sfTcpSocket* wakeUp = sfTcpSocket_create();
+        sfTcpSocket_connect(wakeUp, sfIpAddress_LocalHost, getPort(), sfTime_Zero);
+        m_thread.join();
+        sfTcpSocket_destroy(wakeUp);
+        sfTcpListener_destroy(m_listener);
+
+        // The connections end once the clients close them
+        for (std::thread& connection : m_connections)
+            connection.join();
+    }
+
+    unsigned short getPort() const
+    {
+        return sfTcpListener_getLocalPort(m_listener);
+    }
+
+    int getMaxOpenConnections() const
+    {
+        return m_maxOpenConnections;
+    }
+
+private:
+    void run()
+    {
+        sfTcpSocket* socket = nullptr;
+        while (sfTcpListener_accept(m_listener, &socket) == sfSocketDone)
+        {
+            if (m_stop)
+            {
+                sfTcpSocket_destroy(socket);
+                return;
+            }
+
+            const int open = ++m_openConnections;
+            for (int max = m_maxOpenConnections; max < open && !m_maxOpenConnections.compare_exchange_weak(max, open);)
+                ;
+
+            m_connections.emplace_back(
+                [this, socket]
+                {
+                    serve(socket);
+                    sfTcpSocket_destroy(socket);
+                    --m_openConnections;
+                });
+        }
+    }
+
+    static void serve(sfTcpSocket* socket)
+    {
+        std::string             received;
+        std::array<char, 16384> buffer{};
+        for (;;)
+        {
+            const std::size_t headerEnd = received.find("\r\n\r\n");
+            if (headerEnd == std::string::npos)
+            {
+                std::size_t count = 0;
+                if (sfTcpSocket_receive(socket, buffer.data(), buffer.size(), &count) != sfSocketDone)
+                    return;
+                received.append(buffer.data(), count);
+                continue;
+            }
+
+            const std::size_t uriStart = received.find(' ') + 1;
+            const std::string uri      = received.substr(uriStart, received.find(' ', uriStart) - uriStart);
+            received.erase(0, headerEnd + 4);
+
+            if (uri.compare(0, 7, "/sleep/") == 0)
+                sfSleep(sfMilliseconds(std::atoi(uri.c_str() + 7)));
+
+            const std::string response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(uri.size()) +
+                                         "\r\n\r\n" + uri;
+            if (sfTcpSocket_send(socket, response.data(), response.size()) != sfSocketDone)
+                return;
+        }
+    }
+
+    sfTcpListener*           m_listener{sfTcpListener_create()};
+    std::thread              m_thread;
+    std::vector<std::thread> m_connections;
+    std::atomic<bool>        m_stop{};
+    std::atomic<int>         m_openConnections{};
+    std::atomic<int>         m_maxOpenConnections{};
+};
+
+sfHttpFuture* submit(sfHttpClient* client, const HttpServer& server, const std::string& uri)
+{
+    sfHttpRequest* request = sfHttpRequest_create();
+    sfHttpRequest_setUri(request, uri.c_str());
+    sfHttpFuture* future = sfHttpClient_submit(client, "127.0.0.1", server.getPort(), request, sfSeconds(5));
+    sfHttpRequest_destroy(request);
+    return future;
+}
+
+// Wait for the response of a future, and check that its body is the given URI
+void checkResponse(sfHttpFuture* future, const std::string& uri)
+{
+    REQUIRE(sfHttpFuture_wait(future, sfTime_Zero) == sfHttpFutureReady);
+    const sfHttpResponse* response = sfHttpFuture_getResponse(future);
+    REQUIRE(response);
+    CHECK(sfHttpResponse_getStatus(response) == sfHttpOk);
+    CHECK(sfHttpResponse_getBody(response) == uri);
+}
+
+// Wait until a worker took the request of a future
+bool waitUntilRunning(const sfHttpFuture* future)
+{
+    for (int i = 0; i < 5000 && sfHttpFuture_getStatus(future) == sfHttpFuturePending; ++i)
+        sfSleep(sfMilliseconds(1));
+    return sfHttpFuture_getStatus(future) == sfHttpFutureRunning;
+}
+} // namespace
+
+TEST_CASE("[Network] sfHttpClient")
+{
+    HttpServer    server;
+    sfHttpClient* client = sfHttpClient_create(4, 2);
+
+    SECTION("Responses")
+    {
+        std::vector<sfHttpFuture*> futures;
+        for (int i = 0; i < 50; ++i)
+            futures.push_back(submit(client, server, "/" + std::to_string(i)));
+
+        for (std::size_t i = 0; i < futures.size(); ++i)
+        {
+            checkResponse(futures[i], "/" + std::to_string(i));
+            CHECK(!sfHttpFuture_cancel(futures[i]));
+            sfHttpFuture_destroy(futures[i]);
+        }
+    }
+
+    SECTION("sfHttpFuture_wait")
+    {
+        sfHttpFuture* future = submit(client, server, "/sleep/300");
+        CHECK(sfHttpFuture_getResponse(future) == nullptr);
+        CHECK(sfHttpFuture_wait(future, sfMilliseconds(10)) != sfHttpFutureReady);
+        CHECK(sfHttpFuture_getResponse(future) == nullptr);
+        checkResponse(future, "/sleep/300");
+        CHECK(sfHttpFuture_getStatus(future) == sfHttpFutureReady);
+        sfHttpFuture_destroy(future);
+    }
+
+    SECTION("Connections per host")
+    {
+        HttpServer    other;
+        sfHttpClient* limited = sfHttpClient_create(4, 1);
+
+        std::vector<sfHttpFuture*> futures;
+        for (int i = 0; i < 8; ++i)
+        {
+            futures.push_back(submit(limited, server, "/sleep/20"));
+            futures.push_back(submit(limited, other, "/sleep/20"));
+            futures.push_back(submit(client, server, "/sleep/20"));
+        }
+
+        for (sfHttpFuture* future : futures)
+        {
+            checkResponse(future, "/sleep/20");
+            sfHttpFuture_destroy(future);
+        }
+
+        sfHttpClient_destroy(limited);
+        CHECK(server.getMaxOpenConnections() <= 3);
+        CHECK(other.getMaxOpenConnections() == 1);
+    }
+
+    SECTION("sfHttpFuture_cancel")
+    {
+        // Requests are taken in order, and a single connection is allowed to the server
+        sfHttpClient* single = sfHttpClient_create(1, 1);
+        sfHttpFuture* slow   = submit(single, server, "/sleep/3000");
+        sfHttpFuture* next   = submit(single, server, "/next");
+        sfHttpFuture* last   = submit(single, server, "/last");
+
+        // A pending request is never sent
+        CHECK(sfHttpFuture_cancel(next));
+        CHECK(sfHttpFuture_getStatus(next) == sfHttpFutureCancelled);
+        CHECK(sfHttpFuture_wait(next, sfTime_Zero) == sfHttpFutureCancelled);
+        CHECK(!sfHttpFuture_cancel(next));
+
+        // A running request is interrupted, and its worker moves on to the next request
+        REQUIRE(waitUntilRunning(slow));
+        CHECK(sfHttpFuture_cancel(slow));
+        CHECK(sfHttpFuture_getStatus(slow) == sfHttpFutureCancelled);
+        CHECK(sfHttpFuture_getResponse(slow) == nullptr);
+        CHECK(sfHttpFuture_wait(last, sfSeconds(1)) == sfHttpFutureReady);
+        checkResponse(last, "/last");
+        CHECK(sfHttpFuture_getResponse(next) == nullptr);
+
+        sfHttpFuture_destroy(last);
+        sfHttpFuture_destroy(next);
+        sfHttpFuture_destroy(slow);
+
+        // Destroying the client cancels the requests without a response
+        slow = submit(single, server, "/sleep/3000");
+        next = submit(single, server, "/next");
+        REQUIRE(waitUntilRunning(slow));
+        sfHttpClient_destroy(single);
+        CHECK(sfHttpFuture_getStatus(slow) == sfHttpFutureCancelled);
+        CHECK(sfHttpFuture_getStatus(next) == sfHttpFutureCancelled);
+        sfHttpFuture_destroy(next);
+        sfHttpFuture_destroy(slow);
+
+        // Destroying a future cancels its request
+        sfHttpFuture_destroy(submit(client, server, "/sleep/3000"));
+    }
+
+    SECTION("Cancelling a request being sent")
+    {
+        // The server waits before reading the body, which is too large for the buffers of the connection
+        sfHttpClient*  single  = sfHttpClient_create(1, 1);
+        sfHttpRequest* request = sfHttpRequest_create();
+        sfHttpRequest_setMethod(request, sfHttpPost);
+        sfHttpRequest_setUri(request, "/sleep/3000");
+        sfHttpRequest_setBody(request, std::string(64 * 1024 * 1024, 'a').c_str());
+        sfHttpFuture* slow = sfHttpClient_submit(single, "127.0.0.1", server.getPort(), request, sfSeconds(5));
+        sfHttpFuture* last = submit(single, server, "/last");
+        sfHttpRequest_destroy(request);
+
+        REQUIRE(waitUntilRunning(slow));
+        sfSleep(sfMilliseconds(100));
+        CHECK(sfHttpFuture_cancel(slow));
+        CHECK(sfHttpFuture_wait(last, sfSeconds(1)) == sfHttpFutureReady);
+        checkResponse(last, "/last");
+
+        sfHttpFuture_destroy(last);
+        sfHttpFuture_destroy(slow);
+        sfHttpClient_destroy(single);
+    }
+
+    sfHttpClient_destroy(client);
+}
@@ -41,4 +41,22 @@ TEST_CASE("[Network] sfIpAddress")
         CHECK(sfIpAddress_toInteger(sfIpAddress_fromInteger(0xC0A80001)) == 0xC0A80001);
         CHECK(sfIpAddress_toInteger(sfIpAddress_fromInteger(0x08080808)) == 0x08080808);
     }
+    SECTION("sfIpAddress_toPacked")
+    {
+        const sfIpAddressPacked localHost = sfIpAddress_toPacked(sfIpAddress_LocalHost);
+        CHECK(std::strcmp(localHost.address.address, "127.0.0.1") == 0);
+        CHECK(localHost.integer == 0x7F000001);
+
+        const sfIpAddressPacked none = sfIpAddress_toPacked(sfIpAddress_None);
+        CHECK(std::strcmp(none.address.address, "") == 0);
+        CHECK(none.integer == 0);
+    }
+
+    SECTION("sfIpAddressPacked_fromInteger")
+    {
+        CHECK(std::strcmp(sfIpAddressPacked_fromInteger(0).address.address, "0.0.0.0") == 0);
+        CHECK(std::strcmp(sfIpAddressPacked_fromInteger(0xC0A80001).address.address, "192.168.0.1") == 0);
+        CHECK(std::strcmp(sfIpAddressPacked_fromInteger(0xFFFFFFFF).address.address, "255.255.255.255") == 0);
+        CHECK(sfIpAddressPacked_fromInteger(0x0A640A09).integer == 0x0A640A09);
+    }
 }
@@ -0,0 +1,471 @@
+#include <CSFML/Network/Packet.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+
+TEST_CASE("[Network] sfPacket")
+{
+    sfPacket* packet = sfPacket_create();
+
+    SECTION("Same encoding as sf::Packet")
+    {
+        sfPacket_writeBool(packet, true);
+        sfPacket_writeInt16(packet, -2);
+        sfPacket_writeUint32(packet, 0x01020304);
+        sfPacket_writeUint64(packet, 0x0102030405060708);
+        sfPacket_writeString(packet, "ab");
+        sfPacket_writeWideString(packet, L"é");
+
+        // Integers in big endian, strings prefixed by their length, wide characters as 32-bit integers
+        constexpr std::array<unsigned char, 29> expected{
+            1,                          // bool
+            0xFF, 0xFE,                 // int16
+            1, 2, 3, 4,                 // uint32
+            1, 2, 3, 4, 5, 6, 7, 8,     // uint64
+            0, 0, 0, 2, 'a', 'b',       // string
+            0, 0, 0, 1, 0, 0, 0, 0xE9}; // wide string
+        REQUIRE(sfPacket_getDataSize(packet) == expected.size());
+        CHECK(std::memcmp(sfPacket_getData(packet), expected.data(), expected.size()) == 0);
+
+        std::array<char, 4>    string{};
+        std::array<wchar_t, 4> wideString{};
+        CHECK(sfPacket_readBool(packet));
+        CHECK(sfPacket_readInt16(packet) == -2);
+        CHECK(sfPacket_readUint32(packet) == 0x01020304);
+        CHECK(sfPacket_readUint64(packet) == 0x0102030405060708);
+        sfPacket_readString(packet, string.data());
+        CHECK(std::strcmp(string.data(), "ab") == 0);
+        sfPacket_readWideString(packet, wideString.data());
+        CHECK(std::wcscmp(wideString.data(), L"é") == 0);
+        CHECK(sfPacket_canRead(packet));
+        CHECK(sfPacket_endOfPacket(packet));
+        CHECK(sfPacket_getReadPosition(packet) == expected.size());
+
+        // A read past the end makes the packet invalid, and leaves the value untouched
+        CHECK(sfPacket_readUint8(packet) == 0);
+        CHECK(!sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_readStringView")
+    {
+        sfPacket_writeString(packet, "CSFML");
+        sfPacket_writeString(packet, "");
+        sfPacket_writeUint8(packet, 42);
+
+        const char* data   = nullptr;
+        std::size_t length = 0;
+        sfPacket_readStringView(packet, &data, &length);
+        CHECK(std::string_view(data, length) == "CSFML");
+        CHECK(data > sfPacket_getData(packet));
+        sfPacket_readStringView(packet, &data, &length);
+        CHECK(data);
+        CHECK(length == 0);
+        CHECK(sfPacket_readUint8(packet) == 42);
+        CHECK(sfPacket_canRead(packet));
+
+        sfPacket_readStringView(packet, &data, &length);
+        CHECK(!data);
+        CHECK(length == 0);
+        CHECK(!sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_readBlob")
+    {
+        constexpr std::array<unsigned char, 4> bytes{1, 2, 3, 4};
+        sfPacket_writeBlob(packet, bytes.data(), bytes.size());
+        sfPacket_writeBlob(packet, "text", 4);
+
+        const void* data = nullptr;
+        std::size_t size = 0;
+        sfPacket_readBlob(packet, &data, &size);
+        REQUIRE(size == bytes.size());
+        CHECK(std::memcmp(data, bytes.data(), size) == 0);
+
+        // Blobs of characters are strings
+        std::array<char, 8> string{};
+        sfPacket_readString(packet, string.data());
+        CHECK(std::strcmp(string.data(), "text") == 0);
+        CHECK(sfPacket_endOfPacket(packet));
+    }
+
+    SECTION("Truncated blob")
+    {
+        sfPacket_writeUint32(packet, 100);
+        sfPacket_writeUint32(packet, 0);
+
+        const void* data = nullptr;
+        std::size_t size = 0;
+        sfPacket_readBlob(packet, &data, &size);
+        CHECK(!data);
+        CHECK(size == 0);
+        CHECK(!sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_writeInt32Array")
+    {
+        // An odd count also goes through the scalar tail of the conversion
+        constexpr std::array<std::int32_t, 7> values{0, 1, -1, 0x12345678, -0x12345678, 2147483647, -2147483647 - 1};
+        sfPacket_writeInt32Array(packet, values.data(), values.size());
+        CHECK(sfPacket_getDataSize(packet) == values.size() * sizeof(std::int32_t));
+        CHECK(static_cast<const unsigned char*>(sfPacket_getData(packet))[7] == 1);
+
+        for (const std::int32_t value : values)
+            CHECK(sfPacket_readInt32(packet) == value);
+        CHECK(sfPacket_endOfPacket(packet));
+    }
+
+    SECTION("sfPacket_readUint16Array")
+    {
+        for (std::uint16_t i = 0; i < 19; ++i)
+            sfPacket_writeUint16(packet, static_cast<std::uint16_t>(i * 0x0102));
+
+        std::array<std::uint16_t, 19> values{};
+        sfPacket_readUint16Array(packet, values.data(), values.size());
+        for (std::uint16_t i = 0; i < 19; ++i)
+            CHECK(values[i] == i * 0x0102);
+        CHECK(sfPacket_endOfPacket(packet));
+    }
+
+    SECTION("Arrays of every type")
+    {
+        constexpr std::array<std::int8_t, 3>   int8s{-1, 0, 1};
+        constexpr std::array<std::uint8_t, 3>  uint8s{0, 1, 255};
+        constexpr std::array<std::int16_t, 3>  int16s{-32768, 0, 32767};
+        constexpr std::array<std::uint64_t, 3> uint64s{0, 0x0102030405060708, 0xFFFFFFFFFFFFFFFF};
+        constexpr std::array<std::int64_t, 3>  int64s{-1, 0x0102030405060708, -0x0102030405060708};
+        constexpr std::array<std::uint32_t, 3> uint32s{0, 0x01020304, 0xFFFFFFFF};
+        constexpr std::array<float, 3>         floats{-1.5f, 0.f, 3.25f};
+        constexpr std::array<double, 3>        doubles{-1.5, 0., 1e300};
+        sfPacket_writeInt8Array(packet, int8s.data(), int8s.size());
+        sfPacket_writeUint8Array(packet, uint8s.data(), uint8s.size());
+        sfPacket_writeInt16Array(packet, int16s.data(), int16s.size());
+        sfPacket_writeUint16Array(packet, nullptr, 0);
+        sfPacket_writeUint32Array(packet, uint32s.data(), uint32s.size());
+        sfPacket_writeInt64Array(packet, int64s.data(), int64s.size());
+        sfPacket_writeUint64Array(packet, uint64s.data(), uint64s.size());
+        sfPacket_writeFloatArray(packet, floats.data(), floats.size());
+        sfPacket_writeDoubleArray(packet, doubles.data(), doubles.size());
+
+        std::array<std::int8_t, 3>   readInt8s{};
+        std::array<std::uint8_t, 3>  readUint8s{};
+        std::array<std::int16_t, 3>  readInt16s{};
+        std::array<std::uint32_t, 3> readUint32s{};
+        std::array<std::uint64_t, 3> readUint64s{};
+        std::array<double, 3>        readDoubles{};
+        sfPacket_readInt8Array(packet, readInt8s.data(), readInt8s.size());
+        sfPacket_readUint8Array(packet, readUint8s.data(), readUint8s.size());
+        sfPacket_readInt16Array(packet, readInt16s.data(), readInt16s.size());
+        sfPacket_readUint32Array(packet, readUint32s.data(), readUint32s.size());
+        for (const std::int64_t value : int64s)
+            CHECK(sfPacket_readInt64(packet) == value);
+        sfPacket_readUint64Array(packet, readUint64s.data(), readUint64s.size());
+        for (const float value : floats)
+            CHECK(sfPacket_readFloat(packet) == value);
+        sfPacket_readDoubleArray(packet, readDoubles.data(), readDoubles.size());
+
+        CHECK(readInt8s == int8s);
+        CHECK(readUint8s == uint8s);
+        CHECK(readInt16s == int16s);
+        CHECK(readUint32s == uint32s);
+        CHECK(readUint64s == uint64s);
+        CHECK(readDoubles == doubles);
+        CHECK(sfPacket_endOfPacket(packet));
+        CHECK(sfPacket_canRead(packet));
+    }
+
+    SECTION("Truncated array")
+    {
+        sfPacket_writeUint32(packet, 1);
+        sfPacket_writeUint32(packet, 2);
+
+        std::array<std::uint32_t, 3> values{7, 7, 7};
+        sfPacket_readUint32Array(packet, values.data(), values.size());
+        CHECK(values == std::array<std::uint32_t, 3>{7, 7, 7});
+        CHECK(!sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_writeVarUint")
+    {
+        sfPacket_writeVarUint(packet, 0);
+        sfPacket_writeVarUint(packet, 127);
+        sfPacket_writeVarUint(packet, 300);
+        CHECK(sfPacket_getDataSize(packet) == 4);
+        sfPacket_writeVarUint(packet, 0xFFFFFFFFFFFFFFFF);
+        CHECK(sfPacket_getDataSize(packet) == 14);
+
+        CHECK(sfPacket_readVarUint(packet) == 0);
+        CHECK(sfPacket_readVarUint(packet) == 127);
+        CHECK(sfPacket_readVarUint(packet) == 300);
+        CHECK(sfPacket_getReadPosition(packet) == 4);
+        CHECK(sfPacket_readVarUint(packet) == 0xFFFFFFFFFFFFFFFF);
+        CHECK(sfPacket_endOfPacket(packet));
+        CHECK(sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_writeVarInt")
+    {
+        constexpr std::array<std::int64_t, 6> values{0, -1, 1, -64, 63, -9223372036854775807 - 1};
+        for (const std::int64_t value : values)
+            sfPacket_writeVarInt(packet, value);
+        CHECK(sfPacket_getDataSize(packet) == 15);
+
+        for (const std::int64_t value : values)
+            CHECK(sfPacket_readVarInt(packet) == value);
+        CHECK(sfPacket_endOfPacket(packet));
+    }
+
+    SECTION("Truncated varint")
+    {
+        sfPacket_writeUint8(packet, 0x80);
+        CHECK(sfPacket_readVarUint(packet) == 0);
+        CHECK(sfPacket_getReadPosition(packet) == 0);
+        CHECK(!sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_writeBits")
+    {
+        sfPacket_writeBit(packet, true);
+        sfPacket_writeBits(packet, 5, 3);
+        sfPacket_writeBits(packet, 0x1FF, 9);
+        CHECK(sfPacket_getDataSize(packet) == 2);
+
+        // Other data starts a new byte
+        sfPacket_writeUint8(packet, 42);
+        sfPacket_writeBit(packet, false);
+        sfPacket_writeBits(packet, 0xFFFFFFFF, 32);
+        CHECK(sfPacket_getDataSize(packet) == 8);
+
+        CHECK(sfPacket_readBit(packet));
+        CHECK(sfPacket_getReadPosition(packet) == 1);
+        CHECK(sfPacket_readBits(packet, 3) == 5);
+        CHECK(sfPacket_readBits(packet, 9) == 0x1FF);
+        CHECK(sfPacket_getReadPosition(packet) == 2);
+        CHECK(sfPacket_readUint8(packet) == 42);
+        CHECK(!sfPacket_readBit(packet));
+        CHECK(sfPacket_readBits(packet, 32) == 0xFFFFFFFF);
+        CHECK(sfPacket_endOfPacket(packet));
+        CHECK(sfPacket_canRead(packet));
+
+        // The last byte has 7 unused bits, but nothing more
+        CHECK(sfPacket_readBits(packet, 7) == 0);
+        CHECK(sfPacket_canRead(packet));
+        CHECK(sfPacket_readBit(packet) == false);
+        CHECK(!sfPacket_canRead(packet));
+    }
+
+    SECTION("sfPacket_clear")
+    {
+        sfPacket_writeBit(packet, true);
+        sfPacket_clear(packet);
+        sfPacket_writeUint8(packet, 0);
+        sfPacket_writeBit(packet, true);
+        CHECK(sfPacket_getDataSize(packet) == 2);
+    }
+
+    SECTION("sfPacket_writeQuantizedFloat")
+    {
+        sfPacket_writeQuantizedFloat(packet, 0.f, -512.f, 512.f, 16);
+        sfPacket_writeQuantizedFloat(packet, 100.3f, -512.f, 512.f, 16);
+        sfPacket_writeQuantizedFloat(packet, -1000.f, -512.f, 512.f, 16);
+        sfPacket_writeQuantizedFloat(packet, 1000.f, -512.f, 512.f, 16);
+        sfPacket_writeQuantizedFloat(packet, 0.75f, 0.f, 1.f, 2);
+        sfPacket_writeQuantizedFloat(packet, 0.5f, 0.f, 1.f, 32);
+        CHECK(sfPacket_getDataSize(packet) == 13);
+
+        CHECK(std::abs(sfPacket_readQuantizedFloat(packet, -512.f, 512.f, 16)) <= 1.f / 64);
+        CHECK(std::abs(sfPacket_readQuantizedFloat(packet, -512.f, 512.f, 16) - 100.3f) <= 1.f / 64);
+        CHECK(sfPacket_readQuantizedFloat(packet, -512.f, 512.f, 16) == -512.f);
+        CHECK(sfPacket_readQuantizedFloat(packet, -512.f, 512.f, 16) == 512.f);
+        CHECK(std::abs(sfPacket_readQuantizedFloat(packet, 0.f, 1.f, 2) - 0.75f) <= 1.f / 6);
+        CHECK(std::abs(sfPacket_readQuantizedFloat(packet, 0.f, 1.f, 32) - 0.5f) <= 1e-6f);
+        CHECK(sfPacket_endOfPacket(packet));
+    }
+
+    SECTION("sfPacket_compress")
+    {
+        for (std::uint32_t i = 0; i < 1000; ++i)
+        {
+            sfPacket_writeUint32(packet, i);
+            sfPacket_writeString(packet, "entity");
+        }
+
+        sfPacket* compressed = sfPacket_create();
+        sfPacket_compress(sfPacket_getData(packet), sfPacket_getDataSize(packet), compressed, nullptr);
+        CHECK(sfPacket_getDataSize(compressed) < sfPacket_getDataSize(packet) / 2);
+
+        sfPacket* decompressed = sfPacket_create();
+        const void* data = sfPacket_getData(compressed);
+        CHECK(sfPacket_decompress(data, sfPacket_getDataSize(compressed), decompressed, nullptr));
+        REQUIRE(sfPacket_getDataSize(decompressed) == sfPacket_getDataSize(packet));
+        CHECK(std::memcmp(sfPacket_getData(decompressed), sfPacket_getData(packet), sfPacket_getDataSize(packet)) == 0);
+
+        // Corrupted data is rejected
+        const auto*                bytes = static_cast<const unsigned char*>(data);
+        std::vector<unsigned char> corrupted(bytes, bytes + sfPacket_getDataSize(compressed));
+        corrupted[4] ^= 1;
+        sfPacket_clear(decompressed);
+        CHECK(!sfPacket_decompress(corrupted.data(), corrupted.size(), decompressed, nullptr));
+        CHECK(sfPacket_getDataSize(decompressed) == 0);
+        CHECK(!sfPacket_decompress(corrupted.data(), 3, decompressed, nullptr));
+        CHECK(!sfPacket_decompress(corrupted.data(), 0, decompressed, nullptr));
+
+        sfPacket_destroy(decompressed);
+        sfPacket_destroy(compressed);
+    }
+
+    SECTION("Incompressible data")
+    {
+        std::uint32_t random = 12345;
+        for (int i = 0; i < 1000; ++i)
+        {
+            random = random * 1664525 + 1013904223;
+            sfPacket_writeUint8(packet, static_cast<std::uint8_t>(random >> 24));
+        }
+
+        sfPacket* compressed = sfPacket_create();
+        sfPacket_compress(sfPacket_getData(packet), sfPacket_getDataSize(packet), compressed, nullptr);
+        CHECK(sfPacket_getDataSize(compressed) == sfPacket_getDataSize(packet) + 1);
+
+        sfPacket* decompressed = sfPacket_create();
+        const void* data = sfPacket_getData(compressed);
+        CHECK(sfPacket_decompress(data, sfPacket_getDataSize(compressed), decompressed, nullptr));
+        REQUIRE(sfPacket_getDataSize(decompressed) == sfPacket_getDataSize(packet));
+        CHECK(std::memcmp(sfPacket_getData(decompressed), sfPacket_getData(packet), sfPacket_getDataSize(packet)) == 0);
+
+        sfPacket_destroy(decompressed);
+        sfPacket_destroy(compressed);
+    }
+
+    sfPacket_destroy(packet);
+}
+
+TEST_CASE("[Network] sfPacket benchmark", "[.benchmark]")
+{
+    // A chat message: a sender name and a line of text
+    sfPacket* packet = sfPacket_create();
+    for (int i = 0; i < 64; ++i)
+    {
+        sfPacket_writeString(packet, "player");
+        sfPacket_writeString(packet, "a typical line of chat sent by a player");
+    }
+
+    std::array<char, 64> buffer{};
+
+    BENCHMARK("sfPacket_readString")
+    {
+        sfPacket* copy = sfPacket_copy(packet);
+        for (int i = 0; i < 128; ++i)
+            sfPacket_readString(copy, buffer.data());
+        sfPacket_destroy(copy);
+        return buffer[0];
+    };
+
+    BENCHMARK("sfPacket_readStringView")
+    {
+        sfPacket*   copy   = sfPacket_copy(packet);
+        const char* data   = nullptr;
+        std::size_t length = 0;
+        for (int i = 0; i < 128; ++i)
+            sfPacket_readStringView(copy, &data, &length);
+        sfPacket_destroy(copy);
+        return length;
+    };
+
+    sfPacket_destroy(packet);
+
+    // A snapshot of 4096 entity positions
+    constexpr std::size_t     count = 4096;
+    std::vector<float>        positions(count * 2, 1.5f);
+    std::vector<std::int32_t> identifiers(count, 0x01020304);
+
+    BENCHMARK("sfPacket_writeFloat")
+    {
+        sfPacket* snapshot = sfPacket_create();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sfPacket_writeInt32(snapshot, identifiers[i]);
+            sfPacket_writeFloat(snapshot, positions[i * 2]);
+            sfPacket_writeFloat(snapshot, positions[i * 2 + 1]);
+        }
+        const std::size_t size = sfPacket_getDataSize(snapshot);
+        sfPacket_destroy(snapshot);
+        return size;
+    };
+
+    BENCHMARK("sfPacket_writeFloatArray")
+    {
+        sfPacket* snapshot = sfPacket_create();
+        sfPacket_writeInt32Array(snapshot, identifiers.data(), identifiers.size());
+        sfPacket_writeFloatArray(snapshot, positions.data(), positions.size());
+        const std::size_t size = sfPacket_getDataSize(snapshot);
+        sfPacket_destroy(snapshot);
+        return size;
+    };
+
+    sfPacket* snapshot = sfPacket_create();
+    sfPacket_writeInt32Array(snapshot, identifiers.data(), identifiers.size());
+
+    BENCHMARK("sfPacket_readInt32")
+    {
+        sfPacket* copy = sfPacket_copy(snapshot);
+        for (std::size_t i = 0; i < count; ++i)
+            identifiers[i] = sfPacket_readInt32(copy);
+        sfPacket_destroy(copy);
+        return identifiers[0];
+    };
+
+    BENCHMARK("sfPacket_readInt32Array")
+    {
+        sfPacket* copy = sfPacket_copy(snapshot);
+        sfPacket_readInt32Array(copy, identifiers.data(), identifiers.size());
+        sfPacket_destroy(copy);
+        return identifiers[0];
+    };
+
+    sfPacket_destroy(snapshot);
+
+    // A full state sync of 1 MB: entities with an identifier, a position on a grid, a health and a name
+    sfPacket* state = sfPacket_create();
+    for (std::uint32_t i = 0; sfPacket_getDataSize(state) < 1024 * 1024; ++i)
+    {
+        sfPacket_writeUint32(state, i);
+        sfPacket_writeFloat(state, static_cast<float>(i % 64) * 16.f);
+        sfPacket_writeFloat(state, static_cast<float>(i / 64 % 64) * 16.f);
+        sfPacket_writeUint8(state, i % 7 == 0 ? 50 : 100);
+        sfPacket_writeString(state, i % 3 == 0 ? "orc" : "goblin");
+    }
+
+    sfPacket* compressed = sfPacket_create();
+    sfPacket_compress(sfPacket_getData(state), sfPacket_getDataSize(state), compressed, nullptr);
+    WARN("Bytes on the wire: " << sfPacket_getDataSize(state) << " -> " << sfPacket_getDataSize(compressed));
+
+    BENCHMARK("sfPacket_compress (1 MB)")
+    {
+        sfPacket* output = sfPacket_create();
+        sfPacket_compress(sfPacket_getData(state), sfPacket_getDataSize(state), output, nullptr);
+        const std::size_t size = sfPacket_getDataSize(output);
+        sfPacket_destroy(output);
+        return size;
+    };
+
+    BENCHMARK("sfPacket_decompress (1 MB)")
+    {
+        sfPacket* output = sfPacket_create();
+        sfPacket_decompress(sfPacket_getData(compressed), sfPacket_getDataSize(compressed), output, nullptr);
+        const std::size_t size = sfPacket_getDataSize(output);
+        sfPacket_destroy(output);
+        return size;
+    };
+
+    sfPacket_destroy(compressed);
+    sfPacket_destroy(state);
+}
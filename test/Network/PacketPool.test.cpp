@@ -0,0 +1,101 @@
+#include <CSFML/Network/Packet.h>
+#include <CSFML/Network/PacketPool.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+TEST_CASE("[Network] sfPacketPool")
+{
+    SECTION("sfPacketPool_create")
+    {
+        sfPacketPool* pool = sfPacketPool_create(0);
+        CHECK(sfPacketPool_getAvailableCount(pool) == 0);
+        sfPacketPool_destroy(pool);
+    }
+
+    SECTION("sfPacketPool_acquire")
+    {
+        sfPacketPool* pool   = sfPacketPool_create(0);
+        sfPacket*     packet = sfPacketPool_acquire(pool);
+        REQUIRE(packet);
+        CHECK(sfPacket_getDataSize(packet) == 0);
+        sfPacket_writeUint32(packet, 42);
+        sfPacketPool_release(pool, packet);
+        CHECK(sfPacketPool_getAvailableCount(pool) == 1);
+
+        sfPacket* recycled = sfPacketPool_acquire(pool);
+        CHECK(recycled == packet);
+        CHECK(sfPacket_getDataSize(recycled) == 0);
+        CHECK(sfPacket_getReadPosition(recycled) == 0);
+        CHECK(sfPacket_canRead(recycled));
+        CHECK(sfPacketPool_getAvailableCount(pool) == 0);
+        sfPacket_destroy(recycled);
+        sfPacketPool_destroy(pool);
+    }
+
+    SECTION("sfPacketPool_release")
+    {
+        sfPacketPool* pool = sfPacketPool_create(2);
+        sfPacketPool_release(pool, sfPacket_create());
+        sfPacketPool_release(pool, sfPacket_create());
+        sfPacketPool_release(pool, sfPacket_create());
+        sfPacketPool_release(pool, nullptr);
+        CHECK(sfPacketPool_getAvailableCount(pool) == 2);
+        sfPacketPool_destroy(pool);
+    }
+
+    SECTION("sfPacketPool_reserve")
+    {
+        sfPacketPool* pool = sfPacketPool_create(8);
+        sfPacketPool_reserve(pool, 4);
+        CHECK(sfPacketPool_getAvailableCount(pool) == 4);
+        sfPacketPool_reserve(pool, 16);
+        CHECK(sfPacketPool_getAvailableCount(pool) == 8);
+        sfPacketPool_destroy(pool);
+    }
+}
+
+TEST_CASE("[Network] sfPacketPool benchmark", "[.benchmark]")
+{
+    // A typical server packet: a header and a few fields
+    const auto fillPacket = [](sfPacket* packet)
+    {
+        sfPacket_writeUint16(packet, 7);
+        sfPacket_writeUint32(packet, 123456);
+        sfPacket_writeFloat(packet, 1.5f);
+        sfPacket_writeString(packet, "player position update");
+    };
+
+    std::array<sfPacket*, 64> packets{};
+
+    BENCHMARK("Unpooled")
+    {
+        for (auto& packet : packets)
+        {
+            packet = sfPacket_create();
+            fillPacket(packet);
+        }
+        for (auto* packet : packets)
+            sfPacket_destroy(packet);
+        return packets.size();
+    };
+
+    sfPacketPool* pool = sfPacketPool_create(0);
+    sfPacketPool_reserve(pool, packets.size());
+
+    BENCHMARK("Pooled")
+    {
+        for (auto& packet : packets)
+        {
+            packet = sfPacketPool_acquire(pool);
+            fillPacket(packet);
+        }
+        for (auto* packet : packets)
+            sfPacketPool_release(pool, packet);
+        return packets.size();
+    };
+
+    sfPacketPool_destroy(pool);
+}
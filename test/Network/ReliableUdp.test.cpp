@@ -0,0 +1,201 @@
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/Packet.h>
+#include <CSFML/Network/ReliableUdp.h>
+#include <CSFML/Network/UdpSocket.h>
+#include <CSFML/System/Sleep.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Update both ends over loopback until a condition holds, or until a timeout
+bool pump(sfReliableUdp*               first,
+          sfReliableUdp*               second,
+          const std::function<bool()>& condition,
+          int                          timeoutMs = 30'000)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (sfReliableUdp_update(first) != sfSocketDone || sfReliableUdp_update(second) != sfSocketDone)
+            return false;
+        if (condition())
+            return true;
+        sfSleep(sfMilliseconds(1));
+    }
+    return false;
+}
+} // namespace
+
+TEST_CASE("[Network] sfReliableUdp")
+{
+    sfUdpSocket* clientSocket = sfUdpSocket_create();
+    sfUdpSocket* serverSocket = sfUdpSocket_create();
+    REQUIRE(sfUdpSocket_bind(clientSocket, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    REQUIRE(sfUdpSocket_bind(serverSocket, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    const sfIpAddressPacked localHost  = sfIpAddress_toPacked(sfIpAddress_LocalHost);
+    const unsigned short    clientPort = sfUdpSocket_getLocalPort(clientSocket);
+    const unsigned short    serverPort = sfUdpSocket_getLocalPort(serverSocket);
+
+    sfReliableUdp* client = sfReliableUdp_create(clientSocket);
+    sfReliableUdp* server = sfReliableUdp_create(serverSocket);
+    sfPacket*      packet = sfPacket_create();
+
+    const auto sendNumbers = [&](std::uint8_t channel, sfReliableUdpDelivery delivery, std::uint32_t count)
+    {
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            sfPacket_clear(packet);
+            sfPacket_writeUint32(packet, i);
+            REQUIRE(sfReliableUdp_send(client, localHost, serverPort, channel, delivery, packet));
+        }
+    };
+
+    std::vector<std::uint32_t> ordered;
+    std::multiset<std::uint32_t> unordered;
+    std::vector<std::uint32_t> unreliable;
+    const auto receiveAll = [&]
+    {
+        sfIpAddressPacked address{};
+        unsigned short    port    = 0;
+        std::uint8_t      channel = 0;
+        while (sfReliableUdp_receive(server, packet, &address, &port, &channel))
+        {
+            CHECK(address.integer == localHost.integer);
+            CHECK(port == clientPort);
+            const std::uint32_t value = sfPacket_readUint32(packet);
+            CHECK(sfPacket_endOfPacket(packet));
+            if (channel == 0)
+                ordered.push_back(value);
+            else if (channel == 1)
+                unordered.insert(value);
+            else
+                unreliable.push_back(value);
+        }
+    };
+
+    const auto pendingCount = [&]
+    {
+        sfReliableUdpStats stats{};
+        REQUIRE(sfReliableUdp_getStats(client, localHost, serverPort, &stats));
+        return stats.pendingCount;
+    };
+
+    SECTION("Delivery")
+    {
+        sfReliableUdpStats stats{};
+        CHECK(!sfReliableUdp_getStats(client, localHost, serverPort, &stats));
+        CHECK(!sfReliableUdp_receive(server, packet, nullptr, nullptr, nullptr));
+
+        sendNumbers(0, sfReliableUdpReliableOrdered, 500);
+        sendNumbers(1, sfReliableUdpReliableUnordered, 500);
+        sendNumbers(2, sfReliableUdpUnreliable, 10);
+        CHECK(pendingCount() == 1000);
+
+        CHECK(pump(client,
+                   server,
+                   [&]
+                   {
+                       receiveAll();
+                       return ordered.size() == 500 && unordered.size() == 500 && pendingCount() == 0;
+                   }));
+        for (std::uint32_t i = 0; i < ordered.size(); ++i)
+            CHECK(ordered[i] == i);
+        CHECK(std::set<std::uint32_t>(unordered.begin(), unordered.end()).size() == 500);
+        CHECK(unreliable.size() == 10);
+
+        REQUIRE(sfReliableUdp_getStats(client, localHost, serverPort, &stats));
+        CHECK(stats.rtt.microseconds >= 0);
+        CHECK(stats.datagramsSent > 1);
+        CHECK(stats.datagramsLost == 0);
+        CHECK(stats.pendingCount == 0);
+    }
+
+    SECTION("Message too large")
+    {
+        std::vector<std::uint8_t> data(sfReliableUdp_maxMessageSize() + 1);
+        sfPacket_append(packet, data.data(), data.size());
+        CHECK(!sfReliableUdp_send(client, localHost, serverPort, 0, sfReliableUdpReliableOrdered, packet));
+
+        sfPacket_clear(packet);
+        sfPacket_append(packet, data.data(), data.size() - 1);
+        CHECK(sfReliableUdp_send(client, localHost, serverPort, 0, sfReliableUdpReliableOrdered, packet));
+    }
+
+    SECTION("Lossy network")
+    {
+        const sfReliableUdpSimulation simulation{0.3f, sfMilliseconds(10), sfMilliseconds(5), 42};
+        sfReliableUdp_setSimulation(client, &simulation);
+        sfReliableUdp_setSimulation(server, &simulation);
+
+        sendNumbers(0, sfReliableUdpReliableOrdered, 300);
+        sendNumbers(1, sfReliableUdpReliableUnordered, 300);
+
+        CHECK(pump(client,
+                   server,
+                   [&]
+                   {
+                       receiveAll();
+                       return ordered.size() == 300 && unordered.size() == 300 && pendingCount() == 0;
+                   }));
+        for (std::uint32_t i = 0; i < ordered.size(); ++i)
+            CHECK(ordered[i] == i);
+        CHECK(std::set<std::uint32_t>(unordered.begin(), unordered.end()).size() == 300);
+
+        sfReliableUdpStats stats{};
+        REQUIRE(sfReliableUdp_getStats(client, localHost, serverPort, &stats));
+        CHECK(stats.rtt.microseconds >= 20'000);
+        CHECK(stats.datagramsLost > 0);
+        CHECK(stats.lossRate > 0.f);
+        CHECK(stats.messagesResent > 0);
+    }
+
+    SECTION("sfReliableUdp_setMaxPeers")
+    {
+        sfUdpSocket* otherSocket = sfUdpSocket_create();
+        REQUIRE(sfUdpSocket_bind(otherSocket, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        const unsigned short otherPort = sfUdpSocket_getLocalPort(otherSocket);
+        sfReliableUdp*       other     = sfReliableUdp_create(otherSocket);
+        sfReliableUdp_setMaxPeers(server, 1);
+
+        sendNumbers(0, sfReliableUdpReliableOrdered, 1);
+        CHECK(pump(client,
+                   server,
+                   [&]
+                   {
+                       receiveAll();
+                       return ordered.size() == 1;
+                   }));
+
+        // Datagrams from a new peer are ignored once the limit is reached
+        sfPacket_clear(packet);
+        sfPacket_writeUint32(packet, 42);
+        REQUIRE(sfReliableUdp_send(other, localHost, serverPort, 0, sfReliableUdpReliableOrdered, packet));
+        const auto receiveOther = [&] { return sfReliableUdp_receive(server, packet, nullptr, nullptr, nullptr); };
+        CHECK(!pump(other, server, receiveOther, 200));
+        sfReliableUdpStats stats{};
+        CHECK(!sfReliableUdp_getStats(server, localHost, otherPort, &stats));
+
+        // Forgetting a peer makes room for the new one, whose message is sent again
+        sfReliableUdp_disconnect(server, localHost, clientPort);
+        CHECK(pump(other, server, receiveOther));
+        CHECK(sfPacket_readUint32(packet) == 42);
+        CHECK(sfReliableUdp_getStats(server, localHost, otherPort, &stats));
+
+        sfReliableUdp_destroy(other);
+        sfUdpSocket_destroy(otherSocket);
+    }
+
+    sfPacket_destroy(packet);
+    sfReliableUdp_destroy(server);
+    sfReliableUdp_destroy(client);
+    sfUdpSocket_destroy(serverSocket);
+    sfUdpSocket_destroy(clientSocket);
+}
@@ -0,0 +1,228 @@
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/SocketPoller.h>
+#include <CSFML/Network/TcpListener.h>
+#include <CSFML/Network/TcpSocket.h>
+#include <CSFML/Network/UdpSocket.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <thread>
+
+#if defined(CSFML_SYSTEM_LINUX)
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+namespace
+{
+// Connected pair of TCP sockets over the loopback interface
+struct TcpPair
+{
+    TcpPair()
+    {
+        REQUIRE(sfTcpListener_listen(listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        REQUIRE(sfTcpSocket_connect(client, sfIpAddress_LocalHost, sfTcpListener_getLocalPort(listener), sfTime_Zero) ==
+                sfSocketDone);
+        REQUIRE(sfTcpListener_accept(listener, &server) == sfSocketDone);
+    }
+
+    ~TcpPair()
+    {
+        sfTcpSocket_destroy(server);
+        sfTcpSocket_destroy(client);
+        sfTcpListener_destroy(listener);
+    }
+
+    sfTcpListener* listener{sfTcpListener_create()};
+    sfTcpSocket*   client{sfTcpSocket_create()};
+    sfTcpSocket*   server{};
+};
+} // namespace
+
+TEST_CASE("[Network] sfSocketPoller")
+{
+    sfSocketPoller* poller = sfSocketPoller_create(sfSocketPollerLevelTriggered);
+    REQUIRE(poller);
+    CHECK(sfSocketPoller_getSocketCount(poller) == 0);
+
+    std::array<sfSocketPollerEvent, 4> events{};
+    std::size_t                        eventCount = 0;
+
+    SECTION("sfSocketPoller_addUdpSocket")
+    {
+        sfUdpSocket* receiver = sfUdpSocket_create();
+        sfUdpSocket* sender   = sfUdpSocket_create();
+        REQUIRE(sfUdpSocket_bind(receiver, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        REQUIRE(sfUdpSocket_bind(sender, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+
+        int userData = 0;
+        CHECK(sfSocketPoller_addUdpSocket(poller, receiver, &userData));
+        CHECK(sfSocketPoller_addUdpSocket(poller, receiver, &userData));
+        CHECK(sfSocketPoller_getSocketCount(poller) == 1);
+
+        CHECK(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfMilliseconds(1)) ==
+              sfSocketNotReady);
+        CHECK(eventCount == 0);
+
+        constexpr char message[] = "CSFML";
+        const auto     localHost = sfIpAddress_toPacked(sfIpAddress_LocalHost);
+        REQUIRE(sfUdpSocket_sendTo(sender, message, sizeof(message), localHost, sfUdpSocket_getLocalPort(receiver)) ==
+                sfSocketDone);
+
+        REQUIRE(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfSeconds(1)) == sfSocketDone);
+        REQUIRE(eventCount == 1);
+        CHECK(events[0].udpSocket == receiver);
+        CHECK(events[0].tcpSocket == nullptr);
+        CHECK(events[0].tcpListener == nullptr);
+        CHECK(events[0].userData == &userData);
+
+        sfSocketPoller_removeUdpSocket(poller, receiver);
+        CHECK(sfSocketPoller_getSocketCount(poller) == 0);
+
+        sfUdpSocket_destroy(sender);
+        sfUdpSocket_destroy(receiver);
+    }
+
+    SECTION("sfSocketPoller_addTcpListener / sfSocketPoller_addTcpSocket")
+    {
+        sfTcpListener* listener = sfTcpListener_create();
+        REQUIRE(sfTcpListener_listen(listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+        CHECK(sfSocketPoller_addTcpListener(poller, listener, listener));
+
+        // A pending connection makes the listener ready
+        sfTcpSocket* client = sfTcpSocket_create();
+        REQUIRE(sfTcpSocket_connect(client, sfIpAddress_LocalHost, sfTcpListener_getLocalPort(listener), sfTime_Zero) ==
+                sfSocketDone);
+        REQUIRE(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfSeconds(1)) == sfSocketDone);
+        REQUIRE(eventCount == 1);
+        CHECK(events[0].tcpListener == listener);
+        CHECK(events[0].userData == listener);
+
+        sfTcpSocket* server = nullptr;
+        REQUIRE(sfTcpListener_accept(listener, &server) == sfSocketDone);
+        CHECK(sfSocketPoller_addTcpSocket(poller, server, server));
+        CHECK(sfSocketPoller_getSocketCount(poller) == 2);
+        CHECK(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfMilliseconds(1)) ==
+              sfSocketNotReady);
+
+        // Received data makes the socket ready, until it is read
+        constexpr char message[] = "CSFML";
+        REQUIRE(sfTcpSocket_send(client, message, sizeof(message)) == sfSocketDone);
+        REQUIRE(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfSeconds(1)) == sfSocketDone);
+        REQUIRE(eventCount == 1);
+        CHECK(events[0].tcpSocket == server);
+        CHECK(events[0].userData == server);
+        CHECK(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfMilliseconds(1)) == sfSocketDone);
+
+        std::array<char, 64> buffer{};
+        std::size_t          received = 0;
+        REQUIRE(sfTcpSocket_receive(server, buffer.data(), buffer.size(), &received) == sfSocketDone);
+        CHECK(received == sizeof(message));
+        CHECK(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfMilliseconds(1)) ==
+              sfSocketNotReady);
+
+        // A disconnection makes the socket ready, and the receive reports it
+        sfTcpSocket_destroy(client);
+        REQUIRE(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfSeconds(1)) == sfSocketDone);
+        REQUIRE(eventCount == 1);
+        CHECK(events[0].tcpSocket == server);
+        CHECK(sfTcpSocket_receive(server, buffer.data(), buffer.size(), &received) == sfSocketDisconnected);
+
+        sfSocketPoller_removeTcpSocket(poller, server);
+        sfSocketPoller_removeTcpListener(poller, listener);
+        CHECK(sfSocketPoller_getSocketCount(poller) == 0);
+        sfTcpSocket_destroy(server);
+        sfTcpListener_destroy(listener);
+    }
+
+    SECTION("Unbound socket")
+    {
+        sfUdpSocket* socket = sfUdpSocket_create();
+        CHECK(!sfSocketPoller_addUdpSocket(poller, socket, nullptr));
+        CHECK(sfSocketPoller_getSocketCount(poller) == 0);
+        sfUdpSocket_destroy(socket);
+    }
+
+    SECTION("No room for events")
+    {
+        CHECK(sfSocketPoller_wait(poller, nullptr, 0, &eventCount, sfMilliseconds(1)) == sfSocketNotReady);
+        CHECK(eventCount == 0);
+    }
+
+    sfSocketPoller_destroy(poller);
+}
+
+#if defined(CSFML_SYSTEM_LINUX)
+
+TEST_CASE("[Network] sfSocketPoller edge-triggered")
+{
+    sfSocketPoller* poller = sfSocketPoller_create(sfSocketPollerEdgeTriggered);
+    REQUIRE(poller);
+
+    std::array<sfSocketPollerEvent, 4> events{};
+    std::size_t                        eventCount = 0;
+
+    TcpPair pair;
+    sfTcpSocket_setBlocking(pair.server, false);
+    REQUIRE(sfSocketPoller_addTcpSocket(poller, pair.server, nullptr));
+
+    // New data is reported once, even if it is not read
+    constexpr char message[] = "CSFML";
+    REQUIRE(sfTcpSocket_send(pair.client, message, sizeof(message)) == sfSocketDone);
+    REQUIRE(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfSeconds(1)) == sfSocketDone);
+    REQUIRE(eventCount == 1);
+    CHECK(events[0].tcpSocket == pair.server);
+    CHECK(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfMilliseconds(10)) ==
+          sfSocketNotReady);
+
+    // Once the socket is drained, new data is reported again
+    std::array<char, 64> buffer{};
+    std::size_t          received = 0;
+    CHECK(sfTcpSocket_receive(pair.server, buffer.data(), buffer.size(), &received) == sfSocketDone);
+    CHECK(sfTcpSocket_receive(pair.server, buffer.data(), buffer.size(), &received) == sfSocketNotReady);
+    REQUIRE(sfTcpSocket_send(pair.client, message, sizeof(message)) == sfSocketDone);
+    REQUIRE(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfSeconds(1)) == sfSocketDone);
+    CHECK(eventCount == 1);
+
+    sfSocketPoller_removeTcpSocket(poller, pair.server);
+    sfSocketPoller_destroy(poller);
+}
+
+TEST_CASE("[Network] sfSocketPoller interrupted wait")
+{
+    // A handler installed without SA_RESTART makes epoll_wait fail with EINTR
+    struct sigaction action{};
+    struct sigaction previous{};
+    action.sa_handler = [](int) {};
+    sigemptyset(&action.sa_mask);
+    REQUIRE(sigaction(SIGUSR1, &action, &previous) == 0);
+
+    sfSocketPoller* poller = sfSocketPoller_create(sfSocketPollerLevelTriggered);
+    TcpPair         pair;
+    REQUIRE(sfSocketPoller_addTcpSocket(poller, pair.server, nullptr));
+
+    const pthread_t waiter      = pthread_self();
+    std::thread     interrupter = std::thread(
+        [waiter]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            pthread_kill(waiter, SIGUSR1);
+        });
+
+    // The wait is resumed after the signal, and still times out
+    std::array<sfSocketPollerEvent, 4> events{};
+    std::size_t                        eventCount = 0;
+    const auto                         start      = std::chrono::steady_clock::now();
+    CHECK(sfSocketPoller_wait(poller, events.data(), events.size(), &eventCount, sfMilliseconds(300)) ==
+          sfSocketNotReady);
+    CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(300));
+    interrupter.join();
+
+    sfSocketPoller_removeTcpSocket(poller, pair.server);
+    sfSocketPoller_destroy(poller);
+    sigaction(SIGUSR1, &previous, nullptr);
+}
+
+#endif
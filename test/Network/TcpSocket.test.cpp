@@ -0,0 +1,132 @@
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/Packet.h>
+#include <CSFML/Network/TcpListener.h>
+#include <CSFML/Network/TcpSocket.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+
+#include <cstring>
+
+TEST_CASE("[Network] sfTcpSocket")
+{
+    sfTcpListener* listener = sfTcpListener_create();
+    REQUIRE(sfTcpListener_listen(listener, sfTcpListener_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+
+    sfTcpSocket* client = sfTcpSocket_create();
+    sfTcpSocket* server = nullptr;
+    REQUIRE(sfTcpSocket_connect(client, sfIpAddress_LocalHost, sfTcpListener_getLocalPort(listener), sfTime_Zero) ==
+            sfSocketDone);
+    REQUIRE(sfTcpListener_accept(listener, &server) == sfSocketDone);
+
+    SECTION("sfTcpSocket_sendv")
+    {
+        const std::array<sfIoVec, 4> vecs{{{"head", 4}, {nullptr, 0}, {"payload", 7}, {"tail", 4}}};
+        std::size_t                  sent = 0;
+        CHECK(sfTcpSocket_sendv(client, vecs.data(), vecs.size(), &sent) == sfSocketDone);
+        CHECK(sent == 15);
+
+        // Resuming a complete send doesn't send anything
+        CHECK(sfTcpSocket_sendv(client, vecs.data(), vecs.size(), &sent) == sfSocketDone);
+        CHECK(sent == 15);
+
+        std::string received;
+        while (received.size() < 15)
+        {
+            std::array<char, 32> buffer{};
+            std::size_t          count = 0;
+            REQUIRE(sfTcpSocket_receive(server, buffer.data(), buffer.size(), &count) == sfSocketDone);
+            received.append(buffer.data(), count);
+        }
+        CHECK(received == "headpayloadtail");
+    }
+
+    SECTION("sfTcpSocket_sendPacketsv")
+    {
+        std::array<sfPacket*, 100> packets{};
+        for (std::size_t i = 0; i < packets.size(); ++i)
+        {
+            packets[i] = sfPacket_create();
+            sfPacket_writeUint32(packets[i], static_cast<uint32_t>(i));
+            if (i % 2 == 0)
+                sfPacket_writeString(packets[i], "even");
+        }
+
+        std::size_t sent = 0;
+        CHECK(sfTcpSocket_sendPacketsv(client, packets.data(), packets.size(), &sent) == sfSocketDone);
+        CHECK(sent == 100 * 8 + 50 * 8);
+
+        sfPacket* received = sfPacket_create();
+        for (std::size_t i = 0; i < packets.size(); ++i)
+        {
+            REQUIRE(sfTcpSocket_receivePacket(server, received) == sfSocketDone);
+            CHECK(sfPacket_readUint32(received) == i);
+            if (i % 2 == 0)
+            {
+                std::array<char, 8> string{};
+                sfPacket_readString(received, string.data());
+                CHECK(std::strcmp(string.data(), "even") == 0);
+            }
+            CHECK(sfPacket_endOfPacket(received));
+        }
+        sfPacket_destroy(received);
+
+        for (sfPacket* packet : packets)
+            sfPacket_destroy(packet);
+    }
+
+    SECTION("Empty packet")
+    {
+        sfPacket* sent = sfPacket_create();
+        sfPacket_writeUint32(sent, 42);
+        CHECK(sfTcpSocket_sendPacket(client, sent) == sfSocketDone);
+        sfPacket_clear(sent);
+        CHECK(sfTcpSocket_sendPacket(client, sent) == sfSocketDone);
+
+        sfPacket* received = sfPacket_create();
+        REQUIRE(sfTcpSocket_receivePacket(server, received) == sfSocketDone);
+        CHECK(sfPacket_readUint32(received) == 42);
+        CHECK(sfPacket_endOfPacket(received));
+        sfPacket_readUint32(received);
+        CHECK(!sfPacket_canRead(received));
+
+        // An empty packet replaces the previous one, and resets its state
+        REQUIRE(sfTcpSocket_receivePacket(server, received) == sfSocketDone);
+        CHECK(sfPacket_getDataSize(received) == 0);
+        CHECK(sfPacket_getReadPosition(received) == 0);
+        CHECK(sfPacket_canRead(received));
+        CHECK(sfPacket_endOfPacket(received));
+
+        sfPacket_destroy(received);
+        sfPacket_destroy(sent);
+    }
+
+    SECTION("sfPacket_setTransform")
+    {
+        sfPacket* sent = sfPacket_create();
+        sfPacket_setTransform(sent, sfPacket_compress, sfPacket_decompress, nullptr);
+        for (int i = 0; i < 100; ++i)
+            sfPacket_writeString(sent, "state");
+
+        const std::array<const sfPacket*, 2> packets{sent, sent};
+        CHECK(sfTcpSocket_sendPacket(client, sent) == sfSocketDone);
+        CHECK(sfTcpSocket_sendPacketsv(client, packets.data(), packets.size(), nullptr) == sfSocketDone);
+
+        sfPacket* received = sfPacket_create();
+        sfPacket_setTransform(received, sfPacket_compress, sfPacket_decompress, nullptr);
+        for (int i = 0; i < 3; ++i)
+        {
+            REQUIRE(sfTcpSocket_receivePacket(server, received) == sfSocketDone);
+            REQUIRE(sfPacket_getDataSize(received) == sfPacket_getDataSize(sent));
+            CHECK(std::memcmp(sfPacket_getData(received), sfPacket_getData(sent), sfPacket_getDataSize(sent)) == 0);
+        }
+        sfPacket_destroy(received);
+        sfPacket_destroy(sent);
+    }
+
+    sfTcpSocket_destroy(server);
+    sfTcpSocket_destroy(client);
+    sfTcpListener_destroy(listener);
+}
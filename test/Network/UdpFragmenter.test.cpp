@@ -0,0 +1,140 @@
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/Packet.h>
+#include <CSFML/Network/UdpFragmenter.h>
+#include <CSFML/Network/UdpSocket.h>
+#include <CSFML/System/Sleep.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+// Receive a message, waiting for its fragments until a timeout
+sfSocketStatus receive(sfUdpFragmenter* fragmenter, sfPacket* packet, unsigned short* port = nullptr)
+{
+    const auto     deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    sfSocketStatus status   = sfSocketNotReady;
+    while (status == sfSocketNotReady && std::chrono::steady_clock::now() < deadline)
+    {
+        status = sfUdpFragmenter_receive(fragmenter, packet, nullptr, port);
+        if (status == sfSocketNotReady)
+            sfSleep(sfMilliseconds(1));
+    }
+    return status;
+}
+
+// Build a fragment by hand, as a hostile or broken sender would
+std::vector<std::uint8_t> makeFragment(std::uint32_t id,
+                                       std::uint32_t messageSize,
+                                       std::uint32_t index,
+                                       std::size_t   size)
+{
+    std::vector<std::uint8_t>          fragment(12 + size);
+    const std::array<std::uint32_t, 3> header{id, messageSize, index};
+    for (std::size_t i = 0; i < 12; ++i)
+        fragment[i] = static_cast<std::uint8_t>(header[i / 4] >> (24 - 8 * (i % 4)));
+    return fragment;
+}
+} // namespace
+
+TEST_CASE("[Network] sfUdpFragmenter")
+{
+    sfUdpSocket* clientSocket = sfUdpSocket_create();
+    sfUdpSocket* serverSocket = sfUdpSocket_create();
+    REQUIRE(sfUdpSocket_bind(clientSocket, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    REQUIRE(sfUdpSocket_bind(serverSocket, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    sfUdpSocket_setBlocking(serverSocket, false);
+    const sfIpAddressPacked localHost  = sfIpAddress_toPacked(sfIpAddress_LocalHost);
+    const unsigned short    clientPort = sfUdpSocket_getLocalPort(clientSocket);
+    const unsigned short    serverPort = sfUdpSocket_getLocalPort(serverSocket);
+
+    sfUdpFragmenter* client = sfUdpFragmenter_create(clientSocket);
+    sfUdpFragmenter* server = sfUdpFragmenter_create(serverSocket);
+    sfPacket*        packet = sfPacket_create();
+
+    SECTION("Messages of any size")
+    {
+        // Empty, single fragment, exactly one full fragment, just over it, and many fragments
+        for (const std::size_t size : std::array<std::size_t, 5>{0, 10, 1188, 1189, 100'000})
+        {
+            std::vector<std::uint8_t> message(size);
+            for (std::size_t i = 0; i < size; ++i)
+                message[i] = static_cast<std::uint8_t>(i * 7);
+
+            sfPacket_clear(packet);
+            sfPacket_append(packet, message.data(), message.size());
+            REQUIRE(sfUdpFragmenter_send(client, packet, localHost, serverPort) == sfSocketDone);
+
+            sfPacket_clear(packet);
+            unsigned short port = 0;
+            REQUIRE(receive(server, packet, &port) == sfSocketDone);
+            CHECK(port == clientPort);
+            REQUIRE(sfPacket_getDataSize(packet) == size);
+            CHECK((size == 0 || std::memcmp(sfPacket_getData(packet), message.data(), size) == 0));
+        }
+        CHECK(sfUdpFragmenter_getPendingMemory(server) == 0);
+    }
+
+    SECTION("Message too large")
+    {
+        sfUdpFragmenterLimits limits = sfUdpFragmenter_getLimits(client);
+        limits.maxMessageSize        = 2000;
+        sfUdpFragmenter_setLimits(client, &limits);
+
+        const std::vector<std::uint8_t> message(2001);
+        sfPacket_append(packet, message.data(), message.size());
+        CHECK(sfUdpFragmenter_send(client, packet, localHost, serverPort) == sfSocketError);
+    }
+
+    SECTION("Hostile fragments")
+    {
+        sfUdpFragmenterLimits limits = sfUdpFragmenter_getLimits(server);
+        limits.maxPeerMemory         = 300'000;
+        limits.timeout               = sfMilliseconds(100);
+        sfUdpFragmenter_setLimits(server, &limits);
+
+        // Messages which never complete, claiming a wrong size, or larger than the limit
+        std::vector<std::vector<std::uint8_t>> fragments;
+        for (std::uint32_t id = 0; id < 20; ++id)
+            fragments.push_back(makeFragment(1000 + id, 100'000, 0, 1188));
+        fragments.push_back(makeFragment(2000, 100'000, 0, 1000));
+        fragments.push_back(makeFragment(2001, 2000, 5, 1188));
+        fragments.push_back(makeFragment(2002, 2'000'000, 0, 1188));
+
+        for (const std::vector<std::uint8_t>& fragment : fragments)
+        {
+            const sfSocketStatus status =
+                sfUdpSocket_send(clientSocket, fragment.data(), fragment.size(), sfIpAddress_LocalHost, serverPort);
+            REQUIRE(status == sfSocketDone);
+        }
+
+        sfSleep(sfMilliseconds(10));
+        CHECK(sfUdpFragmenter_receive(server, packet, nullptr, nullptr) == sfSocketNotReady);
+        CHECK(sfUdpFragmenter_getPendingMemory(server) > 0);
+        CHECK(sfUdpFragmenter_getPendingMemory(server) <= limits.maxPeerMemory);
+
+        // Incomplete messages expire, and don't prevent the next ones from arriving
+        sfSleep(sfMilliseconds(150));
+        CHECK(sfUdpFragmenter_receive(server, packet, nullptr, nullptr) == sfSocketNotReady);
+        CHECK(sfUdpFragmenter_getPendingMemory(server) == 0);
+
+        const std::vector<std::uint8_t> message(5000, 42);
+        sfPacket_append(packet, message.data(), message.size());
+        REQUIRE(sfUdpFragmenter_send(client, packet, localHost, serverPort) == sfSocketDone);
+        sfPacket_clear(packet);
+        REQUIRE(receive(server, packet) == sfSocketDone);
+        CHECK(sfPacket_getDataSize(packet) == message.size());
+    }
+
+    sfPacket_destroy(packet);
+    sfUdpFragmenter_destroy(server);
+    sfUdpFragmenter_destroy(client);
+    sfUdpSocket_destroy(serverSocket);
+    sfUdpSocket_destroy(clientSocket);
+}
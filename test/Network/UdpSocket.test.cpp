@@ -0,0 +1,150 @@
+#include <CSFML/Network/IpAddress.h>
+#include <CSFML/Network/UdpSocket.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstring>
+
+TEST_CASE("[Network] sfUdpSocket")
+{
+    sfUdpSocket* receiver = sfUdpSocket_create();
+    sfUdpSocket* sender   = sfUdpSocket_create();
+    REQUIRE(sfUdpSocket_bind(receiver, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    REQUIRE(sfUdpSocket_bind(sender, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    const unsigned short    receiverPort = sfUdpSocket_getLocalPort(receiver);
+    const sfIpAddressPacked localHost    = sfIpAddress_toPacked(sfIpAddress_LocalHost);
+
+    SECTION("sfUdpSocket_sendTo")
+    {
+        constexpr char message[] = "CSFML";
+        CHECK(sfUdpSocket_sendTo(sender, message, sizeof(message), sfIpAddressPacked{}, receiverPort) == sfSocketError);
+        CHECK(sfUdpSocket_sendTo(sender, message, sizeof(message), localHost, receiverPort) == sfSocketDone);
+
+        std::array<char, 16> buffer{};
+        std::size_t          received = 0;
+        sfIpAddressPacked    address{};
+        unsigned short       port = 0;
+        CHECK(sfUdpSocket_receiveFrom(receiver, buffer.data(), buffer.size(), &received, &address, &port) ==
+              sfSocketDone);
+        CHECK(received == sizeof(message));
+        CHECK(std::strcmp(buffer.data(), message) == 0);
+        CHECK(std::strcmp(address.address.address, "127.0.0.1") == 0);
+        CHECK(address.integer == 0x7F000001);
+        CHECK(port == sfUdpSocket_getLocalPort(sender));
+    }
+
+    SECTION("sfUdpSocket_sendBatch")
+    {
+        std::array<std::array<char, 8>, 100> messages{};
+        std::array<sfUdpDatagram, 100>       datagrams{};
+        for (std::size_t i = 0; i < datagrams.size(); ++i)
+        {
+            messages[i][0] = static_cast<char>(i);
+            datagrams[i]   = {messages[i].data(), messages[i].size(), 0, localHost, receiverPort};
+        }
+
+        std::size_t sent = 0;
+        CHECK(sfUdpSocket_sendBatch(sender, datagrams.data(), datagrams.size(), &sent) == sfSocketDone);
+        CHECK(sent == datagrams.size());
+
+        std::array<std::array<char, 16>, 100> buffers{};
+        for (std::size_t i = 0; i < datagrams.size(); ++i)
+            datagrams[i] = {buffers[i].data(), buffers[i].size(), 0, {}, 0};
+
+        std::size_t received = 0;
+        while (received < datagrams.size())
+        {
+            std::size_t    count     = 0;
+            sfUdpDatagram* remaining = datagrams.data() + received;
+            REQUIRE(sfUdpSocket_receiveBatch(receiver, remaining, datagrams.size() - received, &count) == sfSocketDone);
+            received += count;
+        }
+
+        for (std::size_t i = 0; i < datagrams.size(); ++i)
+        {
+            CHECK(datagrams[i].received == 8);
+            CHECK(buffers[i][0] == static_cast<char>(i));
+            CHECK(datagrams[i].remoteAddress.integer == 0x7F000001);
+            CHECK(datagrams[i].remotePort == sfUdpSocket_getLocalPort(sender));
+        }
+    }
+
+    SECTION("sfUdpSocket_receiveBatch")
+    {
+        std::array<char, 16> buffer{};
+        sfUdpDatagram        datagram{buffer.data(), buffer.size(), 0, {}, 0};
+        std::size_t          received = 1;
+        sfUdpSocket_setBlocking(receiver, false);
+        CHECK(sfUdpSocket_receiveBatch(receiver, &datagram, 1, &received) == sfSocketNotReady);
+        CHECK(received == 0);
+    }
+
+    sfUdpSocket_destroy(sender);
+    sfUdpSocket_destroy(receiver);
+}
+
+TEST_CASE("[Network] sfUdpSocket benchmark", "[.benchmark]")
+{
+    // Round trip of one datagram through the loopback interface,
+    // which is where the per-datagram address conversions show
+    sfUdpSocket* receiver = sfUdpSocket_create();
+    sfUdpSocket* sender   = sfUdpSocket_create();
+    REQUIRE(sfUdpSocket_bind(receiver, sfUdpSocket_anyPort(), sfIpAddress_LocalHost) == sfSocketDone);
+    const unsigned short receiverPort = sfUdpSocket_getLocalPort(receiver);
+
+    std::array<char, 64> datagram{};
+    std::size_t          received = 0;
+    unsigned short       port     = 0;
+
+    BENCHMARK("String addresses")
+    {
+        sfIpAddress address{};
+        sfUdpSocket_send(sender, datagram.data(), datagram.size(), sfIpAddress_LocalHost, receiverPort);
+        return sfUdpSocket_receive(receiver, datagram.data(), datagram.size(), &received, &address, &port);
+    };
+
+    const sfIpAddressPacked localHost = sfIpAddress_toPacked(sfIpAddress_LocalHost);
+
+    BENCHMARK("Packed addresses")
+    {
+        sfIpAddressPacked address{};
+        sfUdpSocket_sendTo(sender, datagram.data(), datagram.size(), localHost, receiverPort);
+        return sfUdpSocket_receiveFrom(receiver, datagram.data(), datagram.size(), &received, &address, &port);
+    };
+
+    std::array<std::array<char, 64>, 32> buffers{};
+    std::array<sfUdpDatagram, 32>        outgoing{};
+    std::array<sfUdpDatagram, 32>        incoming{};
+    for (std::size_t i = 0; i < outgoing.size(); ++i)
+    {
+        outgoing[i] = {buffers[i].data(), buffers[i].size(), 0, localHost, receiverPort};
+        incoming[i] = {buffers[i].data(), buffers[i].size(), 0, {}, 0};
+    }
+
+    BENCHMARK("32 datagrams, one call each")
+    {
+        for (const auto& datagram : outgoing)
+            sfUdpSocket_sendTo(sender, datagram.data, datagram.size, localHost, receiverPort);
+        sfIpAddressPacked address{};
+        for (auto& datagram : incoming)
+            sfUdpSocket_receiveFrom(receiver, datagram.data, datagram.size, &datagram.received, &address, &port);
+        return incoming[0].received;
+    };
+
+    BENCHMARK("32 datagrams, batched")
+    {
+        sfUdpSocket_sendBatch(sender, outgoing.data(), outgoing.size(), nullptr);
+        std::size_t received = 0;
+        std::size_t count    = 0;
+        while (received < incoming.size() &&
+               sfUdpSocket_receiveBatch(receiver, incoming.data() + received, incoming.size() - received, &count) ==
+                   sfSocketDone)
+            received += count;
+        return received;
+    };
+
+    sfUdpSocket_destroy(sender);
+    sfUdpSocket_destroy(receiver);
+}
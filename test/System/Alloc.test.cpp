@@ -0,0 +1,131 @@
+#include <CSFML/System/Alloc.h>
+#include <CSFML/System/Buffer.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdlib>
+#include <cstring>
+
+TEST_CASE("[System] sfAlloc")
+{
+    SECTION("sfMalloc")
+    {
+        const sfAllocationStats before = sfGetAllocationStats(sfAllocModuleSystem);
+        void*                   ptr    = sfMalloc(64);
+        REQUIRE(ptr);
+        const sfAllocationStats during = sfGetAllocationStats(sfAllocModuleSystem);
+        CHECK(during.allocations == before.allocations + 1);
+        CHECK(during.allocatedBytes == before.allocatedBytes + 64);
+        CHECK(during.currentBytes == before.currentBytes + 64);
+        sfFree(ptr);
+        const sfAllocationStats after = sfGetAllocationStats(sfAllocModuleSystem);
+        CHECK(after.deallocations == before.deallocations + 1);
+        CHECK(after.currentBytes == before.currentBytes);
+    }
+
+    SECTION("sfRealloc")
+    {
+        auto* ptr = static_cast<char*>(sfRealloc(nullptr, 6));
+        REQUIRE(ptr);
+        std::memcpy(ptr, "CSFML", 6);
+        ptr = static_cast<char*>(sfRealloc(ptr, 4096));
+        REQUIRE(ptr);
+        CHECK(std::strcmp(ptr, "CSFML") == 0);
+        CHECK(sfRealloc(ptr, 0) == nullptr);
+    }
+
+    SECTION("sfFree")
+    {
+        sfFree(nullptr);
+    }
+
+    SECTION("Objects")
+    {
+        // Objects and their storage are released with their own size, without going through sfFree
+        const sfAllocationStats before = sfGetAllocationStats(sfAllocModuleSystem);
+        sfBuffer*               buffer = sfBuffer_create();
+        REQUIRE(sfBuffer_reserve(buffer, 100));
+        const sfAllocationStats during = sfGetAllocationStats(sfAllocModuleSystem);
+        CHECK(during.allocations == before.allocations + 2);
+        CHECK(during.currentBytes >= before.currentBytes + 100);
+        sfBuffer_destroy(buffer);
+        const sfAllocationStats after = sfGetAllocationStats(sfAllocModuleSystem);
+        CHECK(after.deallocations == before.deallocations + 2);
+        CHECK(after.currentBytes == before.currentBytes);
+    }
+
+    SECTION("C standard library")
+    {
+        // Blocks of the C standard library are accepted by CSFML
+        sfFree(std::malloc(16));
+        auto* ptr = static_cast<char*>(sfRealloc(std::malloc(6), 32));
+        REQUIRE(ptr);
+        std::free(ptr);
+
+        // Blocks of the default allocator are accepted by the C standard library
+        ptr = static_cast<char*>(std::realloc(sfMalloc(6), 32));
+        REQUIRE(ptr);
+        std::free(ptr);
+    }
+
+    SECTION("sfSetAllocator")
+    {
+        struct Counters
+        {
+            int allocations{};
+            int reallocations{};
+            int deallocations{};
+        } counters;
+
+        const auto allocFunc = [](size_t size, void* userData)
+        {
+            ++static_cast<Counters*>(userData)->allocations;
+            return std::malloc(size);
+        };
+        const auto reallocFunc = [](void* ptr, size_t size, void* userData)
+        {
+            ++static_cast<Counters*>(userData)->reallocations;
+            return std::realloc(ptr, size);
+        };
+        const auto freeFunc = [](void* ptr, void* userData)
+        {
+            ++static_cast<Counters*>(userData)->deallocations;
+            std::free(ptr);
+        };
+
+        sfSetAllocator(allocFunc, reallocFunc, freeFunc, &counters);
+        void* ptr = sfMalloc(16);
+        ptr       = sfRealloc(ptr, 32);
+        sfFree(ptr);
+        sfBuffer* buffer = sfBuffer_create();
+        sfBuffer_reserve(buffer, 256);
+        sfBuffer_destroy(buffer);
+        sfSetAllocator(nullptr, nullptr, nullptr, nullptr);
+
+        CHECK(counters.allocations == 3);
+        CHECK(counters.reallocations == 1);
+        CHECK(counters.deallocations == 3);
+
+        sfSetAllocator(allocFunc, nullptr, freeFunc, &counters);
+        ptr = sfMalloc(16);
+        ptr = sfRealloc(ptr, 32);
+        sfFree(ptr);
+        sfSetAllocator(nullptr, nullptr, nullptr, nullptr);
+
+        CHECK(counters.allocations == 5);
+        CHECK(counters.reallocations == 1);
+        CHECK(counters.deallocations == 5);
+    }
+
+    SECTION("sfResetAllocationStats")
+    {
+        void* ptr = sfMalloc(8);
+        sfResetAllocationStats();
+        const sfAllocationStats stats = sfGetAllocationStats(sfAllocModuleSystem);
+        CHECK(stats.allocations == 0);
+        CHECK(stats.deallocations == 0);
+        CHECK(stats.allocatedBytes == 0);
+        CHECK(stats.currentBytes >= 8);
+        sfFree(ptr);
+    }
+}
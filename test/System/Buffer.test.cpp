@@ -2,10 +2,69 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
+#include <cstdlib>
+
 TEST_CASE("[System] sfBuffer")
 {
-    sfBuffer* buffer = sfBuffer_create();
-    CHECK(sfBuffer_getSize(buffer) == 0);
-    CHECK(sfBuffer_getData(buffer) == 0);
-    sfBuffer_destroy(buffer);
+    SECTION("sfBuffer_create")
+    {
+        sfBuffer* buffer = sfBuffer_create();
+        CHECK(sfBuffer_getSize(buffer) == 0);
+        CHECK(sfBuffer_getData(buffer) == 0);
+        sfBuffer_destroy(buffer);
+    }
+
+    SECTION("sfBuffer_reserve")
+    {
+        sfBuffer* buffer = sfBuffer_create();
+        CHECK(sfBuffer_reserve(buffer, 1024));
+        CHECK(sfBuffer_getSize(buffer) == 0);
+        CHECK(sfBuffer_getCapacity(buffer) >= 1024);
+        sfBuffer_clear(buffer);
+        CHECK(sfBuffer_getCapacity(buffer) >= 1024);
+        sfBuffer_destroy(buffer);
+    }
+
+    SECTION("sfBuffer_createWithAllocator")
+    {
+        struct Counters
+        {
+            int allocations{};
+            int deallocations{};
+        } counters;
+
+        const auto allocFunc = [](size_t size, void* userData)
+        {
+            ++static_cast<Counters*>(userData)->allocations;
+            return std::malloc(size);
+        };
+        const auto freeFunc = [](void* ptr, void* userData)
+        {
+            ++static_cast<Counters*>(userData)->deallocations;
+            std::free(ptr);
+        };
+
+        sfBuffer* buffer = sfBuffer_createWithAllocator(allocFunc, freeFunc, &counters);
+        CHECK(sfBuffer_getSize(buffer) == 0);
+        CHECK(sfBuffer_reserve(buffer, 256));
+        CHECK(counters.allocations == 1);
+        sfBuffer_clear(buffer);
+        sfBuffer_destroy(buffer);
+        CHECK(counters.allocations == 1);
+        CHECK(counters.deallocations == 1);
+    }
+
+    SECTION("Allocation failure")
+    {
+        const auto allocFunc = [](size_t size, void*) { return size <= 64 ? std::malloc(size) : nullptr; };
+        const auto freeFunc  = [](void* ptr, void*) { std::free(ptr); };
+
+        sfBuffer* buffer = sfBuffer_createWithAllocator(allocFunc, freeFunc, nullptr);
+        CHECK(sfBuffer_reserve(buffer, 64));
+        CHECK(!sfBuffer_reserve(buffer, 1024));
+        CHECK(sfBuffer_getCapacity(buffer) == 64);
+        CHECK(!sfBuffer_reserve(buffer, SIZE_MAX));
+        sfBuffer_destroy(buffer);
+    }
 }